@@ -8,6 +8,39 @@
 namespace glm{
 namespace detail
 {
+	template<qualifier Q>
+	struct compute_exp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& base, vec<4, float, Q> const& exponent)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_pow(base.data, exponent.data);
+			return Result;
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_sqrt<4, float, Q, true>
 	{
@@ -30,6 +63,39 @@ namespace detail
 			return Result;
 		}
 	};
+
+	template<>
+	struct compute_exp<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_exp_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_log<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_log_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_pow<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& base, vec<4, float, aligned_lowp> const& exponent)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_pow_lowp(base.data, exponent.data);
+			return Result;
+		}
+	};
 #	endif
 }//namespace detail
 }//namespace glm
@@ -32,7 +32,11 @@ namespace detail
 		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
 		{
 			mat<4, 4, float, Q> Result;
-			glm_mat4_transpose(&m[0].data, &Result[0].data);
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				glm_mat4_transpose_avx2(&m[0].data, &Result[0].data);
+#			else
+				glm_mat4_transpose(&m[0].data, &Result[0].data);
+#			endif
 			return Result;
 		}
 	};
@@ -4,6 +4,10 @@
 #include "../common.hpp"
 #include "type_half.hpp"
 
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "func_packing_simd.inl"
+#endif
+
 namespace glm
 {
 	GLM_FUNC_QUALIFIER uint packUnorm2x16(vec2 const& v)
@@ -155,35 +159,40 @@ namespace glm
 
 	GLM_FUNC_QUALIFIER uint packHalf2x16(vec2 const& v)
 	{
-		union
-		{
-			signed short in[2];
-			uint out;
-		} u;
-
-		u.in[0] = detail::toFloat16(v.x);
-		u.in[1] = detail::toFloat16(v.y);
-
-		return u.out;
+#		if defined(GLM_PACKING_HALF_SIMD)
+			return static_cast<uint>(_mm_cvtsi128_si32(detail::packHalf4(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f))));
+#		else
+			union
+			{
+				signed short in[2];
+				uint out;
+			} u;
+
+			u.in[0] = detail::toFloat16(v.x);
+			u.in[1] = detail::toFloat16(v.y);
+
+			return u.out;
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER vec2 unpackHalf2x16(uint v)
 	{
-		union
-		{
-			uint in;
-			signed short out[2];
-		} u;
-
-		u.in = v;
-
-		return vec2(
-			detail::toFloat32(u.out[0]),
-			detail::toFloat32(u.out[1]));
+#		if defined(GLM_PACKING_HALF_SIMD)
+			__m128 const Unpack = detail::unpackHalf4(_mm_cvtsi32_si128(static_cast<int>(v)));
+			return vec2(_mm_cvtss_f32(Unpack), _mm_cvtss_f32(_mm_shuffle_ps(Unpack, Unpack, _MM_SHUFFLE(1, 1, 1, 1))));
+#		else
+			union
+			{
+				uint in;
+				signed short out[2];
+			} u;
+
+			u.in = v;
+
+			return vec2(
+				detail::toFloat32(u.out[0]),
+				detail::toFloat32(u.out[1]));
+#		endif
 	}
 }//namespace glm
 
-#if GLM_CONFIG_SIMD == GLM_ENABLE
-#	include "func_packing_simd.inl"
-#endif
-
@@ -1,6 +1,217 @@
+/// @ref core
+/// @file glm/detail/func_packing_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#define GLM_PACKING_HALF_SIMD
+#if defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#	define GLM_PACKING_HALF_F16C
+#endif
+
+#include "../ext/scalar_uint_sized.hpp"
+#include <cstddef>
+#include <immintrin.h>
+
 namespace glm{
 namespace detail
 {
+	// Integer and float operations on 32-bit lanes used by the half conversion kernels
+	struct half_sse2
+	{
+		typedef __m128 fvec;
+		typedef __m128i ivec;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static ivec set1(int x) { return _mm_set1_epi32(x); }
+		GLM_FUNC_QUALIFIER static ivec bits(fvec x) { return _mm_castps_si128(x); }
+		GLM_FUNC_QUALIFIER static fvec real(ivec x) { return _mm_castsi128_ps(x); }
+		GLM_FUNC_QUALIFIER static ivec and_(ivec a, ivec b) { return _mm_and_si128(a, b); }
+		GLM_FUNC_QUALIFIER static ivec or_(ivec a, ivec b) { return _mm_or_si128(a, b); }
+		GLM_FUNC_QUALIFIER static ivec xor_(ivec a, ivec b) { return _mm_xor_si128(a, b); }
+		GLM_FUNC_QUALIFIER static ivec add(ivec a, ivec b) { return _mm_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec sub(ivec a, ivec b) { return _mm_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec greater(ivec a, ivec b) { return _mm_cmpgt_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec select(ivec m, ivec a, ivec b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm_mul_ps(a, b); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec shiftLeft(ivec x) { return _mm_slli_epi32(x, N); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec shiftRight(ivec x) { return _mm_srli_epi32(x, N); }
+
+		GLM_FUNC_QUALIFIER static fvec load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, fvec x) { _mm_storeu_ps(p, x); }
+
+		// Zero extends four halves to 32-bit lanes
+		GLM_FUNC_QUALIFIER static ivec widen(__m128i h) { return _mm_unpacklo_epi16(h, _mm_setzero_si128()); }
+
+		// Narrows four 32-bit lanes holding halves to the low 64 bits
+		GLM_FUNC_QUALIFIER static __m128i narrow(ivec x)
+		{
+			ivec const Signed = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+			return _mm_packs_epi32(Signed, Signed);
+		}
+
+		GLM_FUNC_QUALIFIER static ivec loadHalf(uint16 const* p) { return widen(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p))); }
+		GLM_FUNC_QUALIFIER static void storeHalf(uint16* p, ivec x) { _mm_storel_epi64(reinterpret_cast<__m128i*>(p), narrow(x)); }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	struct half_avx2
+	{
+		typedef __m256 fvec;
+		typedef __m256i ivec;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static ivec set1(int x) { return _mm256_set1_epi32(x); }
+		GLM_FUNC_QUALIFIER static ivec bits(fvec x) { return _mm256_castps_si256(x); }
+		GLM_FUNC_QUALIFIER static fvec real(ivec x) { return _mm256_castsi256_ps(x); }
+		GLM_FUNC_QUALIFIER static ivec and_(ivec a, ivec b) { return _mm256_and_si256(a, b); }
+		GLM_FUNC_QUALIFIER static ivec or_(ivec a, ivec b) { return _mm256_or_si256(a, b); }
+		GLM_FUNC_QUALIFIER static ivec xor_(ivec a, ivec b) { return _mm256_xor_si256(a, b); }
+		GLM_FUNC_QUALIFIER static ivec add(ivec a, ivec b) { return _mm256_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec sub(ivec a, ivec b) { return _mm256_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec greater(ivec a, ivec b) { return _mm256_cmpgt_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec select(ivec m, ivec a, ivec b) { return _mm256_blendv_epi8(b, a, m); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm256_mul_ps(a, b); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec shiftLeft(ivec x) { return _mm256_slli_epi32(x, N); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec shiftRight(ivec x) { return _mm256_srli_epi32(x, N); }
+
+		GLM_FUNC_QUALIFIER static fvec load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, fvec x) { _mm256_storeu_ps(p, x); }
+
+		GLM_FUNC_QUALIFIER static ivec loadHalf(uint16 const* p) { return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))); }
+		GLM_FUNC_QUALIFIER static void storeHalf(uint16* p, ivec x)
+		{
+			__m256i const Packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(x, x), 0x08);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(Packed));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// Bit exact with F16C and with toFloat16 / toFloat32: round to nearest even, quiet NaNs
+	template<typename P>
+	struct compute_half_bits
+	{
+		typedef typename P::fvec fvec;
+		typedef typename P::ivec ivec;
+
+		// Returns the halves in the low 16 bits of each 32-bit lane
+		GLM_FUNC_QUALIFIER static ivec pack(fvec v)
+		{
+			ivec const Bits = P::bits(v);
+			ivec const Abs = P::and_(Bits, P::set1(0x7fffffff));
+			ivec const Sign = P::template shiftRight<16>(P::xor_(Bits, Abs));
 
+			// Below 65536, below the smallest normal half and NaN
+			ivec const Finite = P::greater(P::set1((127 + 16) << 23), Abs);
+			ivec const Subnormal = P::greater(P::set1((127 - 14) << 23), Abs);
+			ivec const NaN = P::greater(Abs, P::set1(0x7f800000));
+
+			// Adding 0.5f, whose ulp is the smallest denormal half, rounds the significand in the FPU
+			ivec const Magic = P::set1((127 - 1) << 23);
+			ivec const Denormal = P::sub(P::bits(P::add(P::real(Abs), P::real(Magic))), Magic);
+
+			// Rebias the exponent and round the 13 dropped bits, ties to even
+			ivec const Odd = P::and_(P::template shiftRight<13>(Abs), P::set1(1));
+			ivec const Normal = P::template shiftRight<13>(P::add(P::add(Abs, P::set1(0x0fff - ((127 - 15) << 23))), Odd));
+
+			ivec const Payload = P::or_(P::set1(0x0200), P::and_(P::template shiftRight<13>(Abs), P::set1(0x03ff)));
+			ivec const Special = P::or_(P::set1(0x7c00), P::and_(NaN, Payload));
+
+			return P::or_(Sign, P::select(Finite, P::select(Subnormal, Denormal, Normal), Special));
+		}
+
+		// Takes the halves in the low 16 bits of each 32-bit lane, upper bits cleared
+		GLM_FUNC_QUALIFIER static fvec unpack(ivec h)
+		{
+			ivec const Abs = P::and_(h, P::set1(0x7fff));
+			ivec const Sign = P::template shiftLeft<16>(P::xor_(h, Abs));
+
+			// Multiplying by 2^112 rebiases the exponent and normalizes denormal halves
+			fvec const Scaled = P::mul(P::real(P::template shiftLeft<13>(Abs)), P::real(P::set1((254 - 15) << 23)));
+
+			ivec const InfNaN = P::and_(P::greater(Abs, P::set1(0x7bff)), P::set1(0x7f800000));
+			ivec const Quiet = P::and_(P::greater(Abs, P::set1(0x7c00)), P::set1(0x00400000));
+
+			return P::real(P::or_(P::or_(P::bits(Scaled), Sign), P::or_(InfNaN, Quiet)));
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t packArray(float const* In, uint16* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + P::size <= Count; i += P::size)
+				P::storeHalf(Out + i, pack(P::load(In + i)));
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t unpackArray(uint16 const* In, float* Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + P::size <= Count; i += P::size)
+				P::store(Out + i, unpack(P::loadHalf(In + i)));
+			return i;
+		}
+	};
+
+	// Converts four floats to four halves in the low 64 bits
+	GLM_FUNC_QUALIFIER __m128i packHalf4(__m128 v)
+	{
+#		if defined(GLM_PACKING_HALF_F16C)
+			return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#		else
+			return half_sse2::narrow(compute_half_bits<half_sse2>::pack(v));
+#		endif
+	}
+
+	// Converts the four halves in the low 64 bits to floats
+	GLM_FUNC_QUALIFIER __m128 unpackHalf4(__m128i h)
+	{
+#		if defined(GLM_PACKING_HALF_F16C)
+			return _mm_cvtph_ps(h);
+#		else
+			return compute_half_bits<half_sse2>::unpack(half_sse2::widen(h));
+#		endif
+	}
+
+	// Convert the largest vectorizable prefix and return its size
+	GLM_FUNC_QUALIFIER std::size_t packHalfArray(float const* In, uint16* Out, std::size_t Count)
+	{
+#		if defined(GLM_PACKING_HALF_F16C) && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm256_cvtps_ph(_mm256_loadu_ps(In + i), _MM_FROUND_TO_NEAREST_INT));
+			return i;
+#		elif defined(GLM_PACKING_HALF_F16C)
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Out + i), _mm_cvtps_ph(_mm_loadu_ps(In + i), _MM_FROUND_TO_NEAREST_INT));
+			return i;
+#		elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return compute_half_bits<half_avx2>::packArray(In, Out, Count);
+#		else
+			return compute_half_bits<half_sse2>::packArray(In, Out, Count);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t unpackHalfArray(uint16 const* In, float* Out, std::size_t Count)
+	{
+#		if defined(GLM_PACKING_HALF_F16C) && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+			std::size_t i = 0;
+			for(; i + 8 <= Count; i += 8)
+				_mm256_storeu_ps(Out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+			return i;
+#		elif defined(GLM_PACKING_HALF_F16C)
+			std::size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+				_mm_storeu_ps(Out + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(In + i))));
+			return i;
+#		elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return compute_half_bits<half_avx2>::unpackArray(In, Out, Count);
+#		else
+			return compute_half_bits<half_sse2>::unpackArray(In, Out, Count);
+#		endif
+	}
 }//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
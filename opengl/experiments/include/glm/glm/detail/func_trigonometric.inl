@@ -2,8 +2,56 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::sin, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::cos, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sincos
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const& v, vec<L, T, Q>& s, vec<L, T, Q>& c)
+		{
+			s = detail::functor1<vec, L, T, T, Q>::call(std::sin, v);
+			c = detail::functor1<vec, L, T, T, Q>::call(std::cos, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_tan
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::tan, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_atan2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& y, vec<L, T, Q> const& x)
+		{
+			return detail::functor2<vec, L, T, Q>::call(std::atan2, y, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template<typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -40,7 +88,9 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> sin(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(sin, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sin' only accept floating-point input");
+
+		return detail::compute_sin<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// cos
@@ -49,7 +99,9 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> cos(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(cos, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cos' only accept floating-point input");
+
+		return detail::compute_cos<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// tan
@@ -58,7 +110,18 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> tan(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(tan, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'tan' only accept floating-point input");
+
+		return detail::compute_tan<L, T, Q, detail::is_aligned<Q>::value>::call(v);
+	}
+
+	// sincos
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sincos(vec<L, T, Q> const& v, vec<L, T, Q>& s, vec<L, T, Q>& c)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sincos' only accept floating-point input");
+
+		detail::compute_sincos<L, T, Q, detail::is_aligned<Q>::value>::call(v, s, c);
 	}
 
 	// asin
@@ -91,7 +154,9 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> atan(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 	{
-		return detail::functor2<vec, L, T, Q>::call(::std::atan2, a, b);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'atan' only accept floating-point input");
+
+		return detail::compute_atan2<L, T, Q, detail::is_aligned<Q>::value>::call(a, b);
 	}
 
 	using std::atan;
@@ -0,0 +1,122 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "type_vec4.hpp"
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_sincos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const& v, vec<4, float, Q>& s, vec<4, float, Q>& c)
+		{
+			glm_vec4_sincos(v.data, &s.data, &c.data);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_tan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& y, vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan2(y.data, x.data);
+			return Result;
+		}
+	};
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	template<>
+	struct compute_sin<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_sin_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_cos<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_cos_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_sincos<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, aligned_lowp> const& v, vec<4, float, aligned_lowp>& s, vec<4, float, aligned_lowp>& c)
+		{
+			glm_vec4_sincos_lowp(v.data, &s.data, &c.data);
+		}
+	};
+
+	template<>
+	struct compute_tan<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_tan_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_atan2<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& y, vec<4, float, aligned_lowp> const& x)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_atan2_lowp(y.data, x.data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
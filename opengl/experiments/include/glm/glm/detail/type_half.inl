@@ -77,11 +77,12 @@ namespace detail
 			else
 			{
 				//
-				// Nan -- preserve sign and significand bits
+				// Nan -- preserve sign and significand bits and
+				// return a quiet NaN, as F16C does
 				//
 
 				uif32 result;
-				result.i = static_cast<unsigned int>((s << 31) | 0x7f800000 | (m << 13));
+				result.i = static_cast<unsigned int>((s << 31) | 0x7fc00000 | (m << 13));
 				return result.f;
 			}
 		}
@@ -148,25 +149,29 @@ namespace detail
 			// We convert f to a denormalized half.
 			//
 
-			m = (m | 0x00800000) >> (1 - e);
+			m = m | 0x00800000;
+
+			int const Shift = 14 - e;
+			int const Half = 1 << (Shift - 1);
+			int const Rest = m & ((1 << Shift) - 1);
+			m >>= Shift;
 
 			//
-			// Round to nearest, round "0.5" up.
+			// Round to nearest, ties to even.
 			//
 			// Rounding may cause the significand to overflow and make
 			// our number normalized.  Because of the way a half's bits
-			// are laid out, we don't have to treat this case separately;
-			// the code below will handle it correctly.
+			// are laid out, we don't have to treat this case separately.
 			//
 
-			if(m & 0x00001000)
-				m += 0x00002000;
+			if(Rest > Half || (Rest == Half && (m & 1)))
+				m += 1;
 
 			//
 			// Assemble the half from s, e (zero) and m.
 			//
 
-			return hdata(s | (m >> 13));
+			return hdata(s | m);
 		}
 		else if(e == 0xff - (127 - 15))
 		{
@@ -182,17 +187,14 @@ namespace detail
 			else
 			{
 				//
-				// F is a NAN; we produce a half NAN that preserves
-				// the sign bit and the 10 leftmost bits of the
-				// significand of f, with one exception: If the 10
-				// leftmost bits are all zero, the NAN would turn
-				// into an infinity, so we have to set at least one
-				// bit in the significand.
+				// F is a NAN; we produce a quiet half NAN that
+				// preserves the sign bit and the 10 leftmost bits
+				// of the significand of f, as F16C does.
 				//
 
 				m >>= 13;
 
-				return hdata(s | 0x7c00 | m | (m == 0));
+				return hdata(s | 0x7e00 | m);
 			}
 		}
 		else
@@ -203,10 +205,10 @@ namespace detail
 			//
 
 			//
-			// Round to nearest, round "0.5" up
+			// Round to nearest, ties to even
 			//
 
-			if(m &  0x00001000)
+			if((m & 0x00001fff) > 0x00001000 || (m & 0x00003fff) == 0x00003000)
 			{
 				m += 0x00002000;
 
@@ -1,6 +1,31 @@
 /// @ref core
 
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
+
+#include "../simd/matrix.h"
+#include <type_traits>
+
 namespace glm
 {
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER typename std::enable_if<detail::is_aligned<Q>::value, mat<4, 4, float, Q> >::type
+	operator*(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+	{
+		// glm_mat4_mul_avx512 is not used here, aligned matrices are only 16 byte
+		// aligned so its 512-bit loads split cache lines and it measured slower
+		mat<4, 4, float, Q> Result;
+		glm_mat4_mul_avx2(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
 
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER typename std::enable_if<detail::is_aligned<Q>::value, vec<4, float, Q> >::type
+	operator*(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+	{
+		vec<4, float, Q> Result;
+		Result.data = glm_mat4_mul_vec4_avx2(&m[0].data, v.data);
+		return Result;
+	}
 }//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
@@ -0,0 +1,104 @@
+/// @ref ext_batch_transform
+/// @file glm/ext/batch_transform.hpp
+///
+/// @defgroup ext_batch_transform GLM_EXT_batch_transform
+/// @ingroup ext
+///
+/// Apply one 4x4 matrix to whole arrays of points, directions or normals,
+/// stored as vectors (AoS) or as separate x, y and z streams (SoA).
+///
+/// When GLM_FORCE_INTRINSICS is defined, float arrays go through SSE2
+/// kernels on x86, and AVX2 kernels when the CPU supports it. The choice is
+/// made at runtime unless GLM_FORCE_AVX2 or an AVX2 target already makes it
+/// at compile time. Other types, and builds without intrinsics, use the
+/// per-value operators.
+///
+/// The kernels evaluate the same expressions in the same order as the
+/// operators, so their results are bit identical to the scalar path as long
+/// as the compiler neither contracts them into FMA instructions nor keeps
+/// excess precision (FLT_EVAL_METHOD != 0, e.g. x87).
+///
+/// Input and output arrays may be the same array but must not otherwise
+/// overlap.
+///
+/// Include <glm/ext/batch_transform.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_transform
+
+#pragma once
+
+// Dependencies
+#include "../matrix.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_batch_transform extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_batch_transform
+	/// @{
+
+	/// Computes vec3(m * vec4(in[i], 1)) for count points, without any division by w.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes m * in[i] for count homogeneous points.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformPoints(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count);
+
+	/// Computes vec3(m * vec4(x[i], y[i], z[i], 1)) for count points stored as three streams.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformPoints(mat<4, 4, T, Q> const& m, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count);
+
+	/// Computes vec3(m * vec4(in[i], 0)), the translation of m is ignored.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformDirections(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes m * vec4(vec3(in[i]), 0), the w of the input is ignored.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformDirections(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count);
+
+	/// Computes vec3(m * vec4(x[i], y[i], z[i], 0)) for count directions stored as three streams.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformDirections(mat<4, 4, T, Q> const& m, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count);
+
+	/// Computes transpose(inverse(mat3(m))) * in[i]. The normal matrix is computed once
+	/// and the results are not normalized.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformNormals(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes transpose(inverse(mat3(m))) * vec3(x[i], y[i], z[i]) for count normals stored
+	/// as three streams. The results are not normalized.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformNormals(mat<4, 4, T, Q> const& m, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_transform.inl"
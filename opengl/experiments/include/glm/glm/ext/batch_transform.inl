@@ -0,0 +1,631 @@
+/// @ref ext_batch_transform
+
+#include <cstring>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#		define GLM_BATCH_TRANSFORM_SSE2
+#		define GLM_BATCH_TRANSFORM_AVX2
+#		define GLM_BATCH_TRANSFORM_AVX2_QUALIFIER GLM_FUNC_QUALIFIER
+#		include <immintrin.h>
+#	elif ((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC49)) || ((GLM_COMPILER & GLM_COMPILER_CLANG) && (GLM_COMPILER >= GLM_COMPILER_CLANG38))
+#		define GLM_BATCH_TRANSFORM_SSE2
+#		define GLM_BATCH_TRANSFORM_AVX2
+#		define GLM_BATCH_TRANSFORM_AVX2_QUALIFIER inline __attribute__((target("avx2")))
+#		include <immintrin.h>
+#	elif GLM_COMPILER & GLM_COMPILER_VC
+#		define GLM_BATCH_TRANSFORM_SSE2
+#		define GLM_BATCH_TRANSFORM_AVX2
+#		define GLM_BATCH_TRANSFORM_AVX2_QUALIFIER inline
+#		include <immintrin.h>
+#		include <intrin.h>
+#	elif GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG | GLM_COMPILER_INTEL)
+#		define GLM_BATCH_TRANSFORM_SSE2
+#		include <emmintrin.h>
+#	endif
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T>
+	struct batch_transform_simd
+	{
+		enum { value = false };
+	};
+
+#	if defined(GLM_BATCH_TRANSFORM_SSE2)
+
+	template<>
+	struct batch_transform_simd<float>
+	{
+		enum { value = true };
+	};
+
+	// The kernels take the matrix as four rows of four floats. For vec3 outputs the
+	// fourth float of a row is m[3][r] already multiplied by the w of the inputs,
+	// 1 for points and 0 for directions, for vec4 outputs it is m[3][r] itself.
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER __m128 batch_row_sse(__m128 const Row[4], __m128 X, __m128 Y, __m128 Z)
+	{
+		__m128 const Add0 = _mm_add_ps(_mm_mul_ps(Row[0], X), _mm_mul_ps(Row[1], Y));
+		__m128 const Mul2 = _mm_mul_ps(Row[2], Z);
+		return _mm_add_ps(Add0, Translate ? _mm_add_ps(Mul2, Row[3]) : Mul2);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_load_rows_sse(float const* Rows, __m128 Out[4][4])
+	{
+		for(length_t r = 0; r < 4; ++r)
+		for(length_t k = 0; k < 4; ++k)
+			Out[r][k] = _mm_set1_ps(Rows[r * 4 + k]);
+	}
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER void batch_aos3_block_sse(__m128 const Rows[4][4], float const* In, float* Out)
+	{
+		// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+		__m128 const A = _mm_loadu_ps(In + 0);
+		__m128 const B = _mm_loadu_ps(In + 4);
+		__m128 const C = _mm_loadu_ps(In + 8);
+
+		__m128 const P = _mm_shuffle_ps(A, B, _MM_SHUFFLE(3, 2, 3, 0)); // x0 x1 x2 y2
+		__m128 const Q = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+		__m128 const S = _mm_shuffle_ps(P, C, _MM_SHUFFLE(3, 1, 3, 2)); // x2 y2 x3 z3
+		__m128 const X = _mm_shuffle_ps(P, S, _MM_SHUFFLE(2, 0, 1, 0));
+		__m128 const Y = _mm_shuffle_ps(Q, _mm_shuffle_ps(S, C, _MM_SHUFFLE(2, 2, 1, 1)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 const Z = _mm_shuffle_ps(Q, C, _MM_SHUFFLE(3, 0, 3, 1));
+
+		__m128 const OX = batch_row_sse<Translate>(Rows[0], X, Y, Z);
+		__m128 const OY = batch_row_sse<Translate>(Rows[1], X, Y, Z);
+		__m128 const OZ = batch_row_sse<Translate>(Rows[2], X, Y, Z);
+
+		__m128 const XY0 = _mm_unpacklo_ps(OX, OY); // x0 y0 x1 y1
+		__m128 const XY1 = _mm_unpackhi_ps(OX, OY); // x2 y2 x3 y3
+		__m128 const U = _mm_shuffle_ps(OZ, XY0, _MM_SHUFFLE(2, 2, 0, 0)); // z0 z0 x1 x1
+		__m128 const V = _mm_shuffle_ps(XY0, OZ, _MM_SHUFFLE(1, 1, 3, 3)); // y1 y1 z1 z1
+		__m128 const W0 = _mm_shuffle_ps(OZ, XY1, _MM_SHUFFLE(2, 2, 2, 2)); // z2 z2 x3 x3
+		__m128 const W1 = _mm_shuffle_ps(XY1, OZ, _MM_SHUFFLE(3, 3, 3, 3)); // y3 y3 z3 z3
+
+		_mm_storeu_ps(Out + 0, _mm_shuffle_ps(XY0, U, _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(Out + 4, _mm_shuffle_ps(V, XY1, _MM_SHUFFLE(1, 0, 2, 0)));
+		_mm_storeu_ps(Out + 8, _mm_shuffle_ps(W0, W1, _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER void batch_soa_block_sse(__m128 const Rows[4][4], float const* const In[3], float* const Out[3], std::size_t i)
+	{
+		__m128 const X = _mm_loadu_ps(In[0] + i);
+		__m128 const Y = _mm_loadu_ps(In[1] + i);
+		__m128 const Z = _mm_loadu_ps(In[2] + i);
+
+		__m128 const OX = batch_row_sse<Translate>(Rows[0], X, Y, Z);
+		__m128 const OY = batch_row_sse<Translate>(Rows[1], X, Y, Z);
+		__m128 const OZ = batch_row_sse<Translate>(Rows[2], X, Y, Z);
+
+		_mm_storeu_ps(Out[0] + i, OX);
+		_mm_storeu_ps(Out[1] + i, OY);
+		_mm_storeu_ps(Out[2] + i, OZ);
+	}
+
+	// Homogeneous multiplies the fourth column by the w of each input, otherwise the
+	// inputs are directions and their w is ignored
+	template<bool Homogeneous>
+	GLM_FUNC_QUALIFIER void batch_aos4_block_sse(__m128 const Rows[4][4], float const* In, float* Out)
+	{
+		__m128 X = _mm_loadu_ps(In + 0);
+		__m128 Y = _mm_loadu_ps(In + 4);
+		__m128 Z = _mm_loadu_ps(In + 8);
+		__m128 W = _mm_loadu_ps(In + 12);
+		_MM_TRANSPOSE4_PS(X, Y, Z, W);
+
+		__m128 Result[4];
+		for(length_t r = 0; r < 4; ++r)
+		{
+			__m128 const Add0 = _mm_add_ps(_mm_mul_ps(Rows[r][0], X), _mm_mul_ps(Rows[r][1], Y));
+			__m128 const Add1 = _mm_add_ps(_mm_mul_ps(Rows[r][2], Z), Homogeneous ? _mm_mul_ps(Rows[r][3], W) : Rows[r][3]);
+			Result[r] = _mm_add_ps(Add0, Add1);
+		}
+		_MM_TRANSPOSE4_PS(Result[0], Result[1], Result[2], Result[3]);
+
+		_mm_storeu_ps(Out + 0, Result[0]);
+		_mm_storeu_ps(Out + 4, Result[1]);
+		_mm_storeu_ps(Out + 8, Result[2]);
+		_mm_storeu_ps(Out + 12, Result[3]);
+	}
+
+	// The last partial block goes through a zero padded copy so tails take the same
+	// code as full blocks
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER void batch_transform_aos3_sse(float const* Rows, float const* In, float* Out, std::size_t Count)
+	{
+		__m128 R[4][4];
+		batch_load_rows_sse(Rows, R);
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			batch_aos3_block_sse<Translate>(R, In + i * 3, Out + i * 3);
+
+		if(i < Count)
+		{
+			float Tail[12] = {0};
+			std::memcpy(Tail, In + i * 3, (Count - i) * 3 * sizeof(float));
+			batch_aos3_block_sse<Translate>(R, Tail, Tail);
+			std::memcpy(Out + i * 3, Tail, (Count - i) * 3 * sizeof(float));
+		}
+	}
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER void batch_transform_soa_sse(float const* Rows, float const* const In[3], float* const Out[3], std::size_t Count)
+	{
+		__m128 R[4][4];
+		batch_load_rows_sse(Rows, R);
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			batch_soa_block_sse<Translate>(R, In, Out, i);
+
+		if(i < Count)
+		{
+			float Tail[3][4] = {{0}};
+			float const* const TailIn[3] = {Tail[0], Tail[1], Tail[2]};
+			float* const TailOut[3] = {Tail[0], Tail[1], Tail[2]};
+			for(length_t c = 0; c < 3; ++c)
+				std::memcpy(Tail[c], In[c] + i, (Count - i) * sizeof(float));
+			batch_soa_block_sse<Translate>(R, TailIn, TailOut, 0);
+			for(length_t c = 0; c < 3; ++c)
+				std::memcpy(Out[c] + i, Tail[c], (Count - i) * sizeof(float));
+		}
+	}
+
+	template<bool Homogeneous>
+	GLM_FUNC_QUALIFIER void batch_transform_aos4_sse(float const* Rows, float const* In, float* Out, std::size_t Count)
+	{
+		__m128 R[4][4];
+		batch_load_rows_sse(Rows, R);
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			batch_aos4_block_sse<Homogeneous>(R, In + i * 4, Out + i * 4);
+
+		if(i < Count)
+		{
+			float Tail[16] = {0};
+			std::memcpy(Tail, In + i * 4, (Count - i) * 4 * sizeof(float));
+			batch_aos4_block_sse<Homogeneous>(R, Tail, Tail);
+			std::memcpy(Out + i * 4, Tail, (Count - i) * 4 * sizeof(float));
+		}
+	}
+
+#	endif//defined(GLM_BATCH_TRANSFORM_SSE2)
+
+#	if defined(GLM_BATCH_TRANSFORM_AVX2)
+
+	// Same kernels eight values at a time. The 256-bit shuffles stay within 128-bit
+	// lanes, so each lane runs the SSE shuffle sequence on four of the values.
+
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER bool batch_transform_detect_avx2()
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return true;
+#		elif GLM_COMPILER & GLM_COMPILER_VC
+			int Info[4];
+			__cpuid(Info, 0);
+			if(Info[0] < 7)
+				return false;
+
+			// AVX2 also needs the OS to save the YMM registers
+			__cpuid(Info, 1);
+			bool const OSXSave = (Info[2] & (1 << 27)) != 0;
+			if(!OSXSave || (_xgetbv(0) & 6) != 6)
+				return false;
+
+			__cpuidex(Info, 7, 0);
+			return (Info[1] & (1 << 5)) != 0;
+#		else
+			return __builtin_cpu_supports("avx2") != 0;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER bool batch_transform_has_avx2()
+	{
+		static bool const Result = batch_transform_detect_avx2();
+		return Result;
+	}
+
+	template<bool Translate>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER __m256 batch_row_avx2(__m256 const Row[4], __m256 X, __m256 Y, __m256 Z)
+	{
+		__m256 const Add0 = _mm256_add_ps(_mm256_mul_ps(Row[0], X), _mm256_mul_ps(Row[1], Y));
+		__m256 const Mul2 = _mm256_mul_ps(Row[2], Z);
+		return _mm256_add_ps(Add0, Translate ? _mm256_add_ps(Mul2, Row[3]) : Mul2);
+	}
+
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_load_rows_avx2(float const* Rows, __m256 Out[4][4])
+	{
+		for(length_t r = 0; r < 4; ++r)
+		for(length_t k = 0; k < 4; ++k)
+			Out[r][k] = _mm256_set1_ps(Rows[r * 4 + k]);
+	}
+
+	template<bool Translate>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_aos3_block_avx2(__m256 const Rows[4][4], float const* In, float* Out)
+	{
+		// Points 0 to 3 in the low lanes and 4 to 7 in the high lanes
+		__m256 const L0 = _mm256_loadu_ps(In + 0);
+		__m256 const L1 = _mm256_loadu_ps(In + 8);
+		__m256 const L2 = _mm256_loadu_ps(In + 16);
+		__m256 const A = _mm256_permute2f128_ps(L0, L1, 0x30);
+		__m256 const B = _mm256_permute2f128_ps(L0, L2, 0x21);
+		__m256 const C = _mm256_permute2f128_ps(L1, L2, 0x30);
+
+		__m256 const P = _mm256_shuffle_ps(A, B, _MM_SHUFFLE(3, 2, 3, 0));
+		__m256 const Q = _mm256_shuffle_ps(A, B, _MM_SHUFFLE(1, 0, 2, 1));
+		__m256 const S = _mm256_shuffle_ps(P, C, _MM_SHUFFLE(3, 1, 3, 2));
+		__m256 const X = _mm256_shuffle_ps(P, S, _MM_SHUFFLE(2, 0, 1, 0));
+		__m256 const Y = _mm256_shuffle_ps(Q, _mm256_shuffle_ps(S, C, _MM_SHUFFLE(2, 2, 1, 1)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m256 const Z = _mm256_shuffle_ps(Q, C, _MM_SHUFFLE(3, 0, 3, 1));
+
+		__m256 const OX = batch_row_avx2<Translate>(Rows[0], X, Y, Z);
+		__m256 const OY = batch_row_avx2<Translate>(Rows[1], X, Y, Z);
+		__m256 const OZ = batch_row_avx2<Translate>(Rows[2], X, Y, Z);
+
+		__m256 const XY0 = _mm256_unpacklo_ps(OX, OY);
+		__m256 const XY1 = _mm256_unpackhi_ps(OX, OY);
+		__m256 const U = _mm256_shuffle_ps(OZ, XY0, _MM_SHUFFLE(2, 2, 0, 0));
+		__m256 const V = _mm256_shuffle_ps(XY0, OZ, _MM_SHUFFLE(1, 1, 3, 3));
+		__m256 const W0 = _mm256_shuffle_ps(OZ, XY1, _MM_SHUFFLE(2, 2, 2, 2));
+		__m256 const W1 = _mm256_shuffle_ps(XY1, OZ, _MM_SHUFFLE(3, 3, 3, 3));
+		__m256 const OA = _mm256_shuffle_ps(XY0, U, _MM_SHUFFLE(2, 0, 1, 0));
+		__m256 const OB = _mm256_shuffle_ps(V, XY1, _MM_SHUFFLE(1, 0, 2, 0));
+		__m256 const OC = _mm256_shuffle_ps(W0, W1, _MM_SHUFFLE(2, 0, 2, 0));
+
+		_mm256_storeu_ps(Out + 0, _mm256_permute2f128_ps(OA, OB, 0x20));
+		_mm256_storeu_ps(Out + 8, _mm256_permute2f128_ps(OC, OA, 0x30));
+		_mm256_storeu_ps(Out + 16, _mm256_permute2f128_ps(OB, OC, 0x31));
+	}
+
+	template<bool Translate>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_soa_block_avx2(__m256 const Rows[4][4], float const* const In[3], float* const Out[3], std::size_t i)
+	{
+		__m256 const X = _mm256_loadu_ps(In[0] + i);
+		__m256 const Y = _mm256_loadu_ps(In[1] + i);
+		__m256 const Z = _mm256_loadu_ps(In[2] + i);
+
+		__m256 const OX = batch_row_avx2<Translate>(Rows[0], X, Y, Z);
+		__m256 const OY = batch_row_avx2<Translate>(Rows[1], X, Y, Z);
+		__m256 const OZ = batch_row_avx2<Translate>(Rows[2], X, Y, Z);
+
+		_mm256_storeu_ps(Out[0] + i, OX);
+		_mm256_storeu_ps(Out[1] + i, OY);
+		_mm256_storeu_ps(Out[2] + i, OZ);
+	}
+
+	// 4x4 transposes within each lane
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_transpose_avx2(__m256 Rows[4])
+	{
+		__m256 const T0 = _mm256_unpacklo_ps(Rows[0], Rows[1]);
+		__m256 const T1 = _mm256_unpacklo_ps(Rows[2], Rows[3]);
+		__m256 const T2 = _mm256_unpackhi_ps(Rows[0], Rows[1]);
+		__m256 const T3 = _mm256_unpackhi_ps(Rows[2], Rows[3]);
+		Rows[0] = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0));
+		Rows[1] = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2));
+		Rows[2] = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0));
+		Rows[3] = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	template<bool Homogeneous>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_aos4_block_avx2(__m256 const Rows[4][4], float const* In, float* Out)
+	{
+		// Vectors 0 to 3 in the low lanes and 4 to 7 in the high lanes
+		__m256 const L0 = _mm256_loadu_ps(In + 0);
+		__m256 const L1 = _mm256_loadu_ps(In + 8);
+		__m256 const L2 = _mm256_loadu_ps(In + 16);
+		__m256 const L3 = _mm256_loadu_ps(In + 24);
+		__m256 V[4] = {
+			_mm256_permute2f128_ps(L0, L2, 0x20),
+			_mm256_permute2f128_ps(L0, L2, 0x31),
+			_mm256_permute2f128_ps(L1, L3, 0x20),
+			_mm256_permute2f128_ps(L1, L3, 0x31)};
+		batch_transpose_avx2(V);
+
+		__m256 Result[4];
+		for(length_t r = 0; r < 4; ++r)
+		{
+			__m256 const Add0 = _mm256_add_ps(_mm256_mul_ps(Rows[r][0], V[0]), _mm256_mul_ps(Rows[r][1], V[1]));
+			__m256 const Add1 = _mm256_add_ps(_mm256_mul_ps(Rows[r][2], V[2]), Homogeneous ? _mm256_mul_ps(Rows[r][3], V[3]) : Rows[r][3]);
+			Result[r] = _mm256_add_ps(Add0, Add1);
+		}
+		batch_transpose_avx2(Result);
+
+		_mm256_storeu_ps(Out + 0, _mm256_permute2f128_ps(Result[0], Result[1], 0x20));
+		_mm256_storeu_ps(Out + 8, _mm256_permute2f128_ps(Result[2], Result[3], 0x20));
+		_mm256_storeu_ps(Out + 16, _mm256_permute2f128_ps(Result[0], Result[1], 0x31));
+		_mm256_storeu_ps(Out + 24, _mm256_permute2f128_ps(Result[2], Result[3], 0x31));
+	}
+
+	template<bool Translate>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_transform_aos3_avx2(float const* Rows, float const* In, float* Out, std::size_t Count)
+	{
+		__m256 R[4][4];
+		batch_load_rows_avx2(Rows, R);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			batch_aos3_block_avx2<Translate>(R, In + i * 3, Out + i * 3);
+
+		if(i < Count)
+		{
+			float Tail[24] = {0};
+			std::memcpy(Tail, In + i * 3, (Count - i) * 3 * sizeof(float));
+			batch_aos3_block_avx2<Translate>(R, Tail, Tail);
+			std::memcpy(Out + i * 3, Tail, (Count - i) * 3 * sizeof(float));
+		}
+	}
+
+	template<bool Translate>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_transform_soa_avx2(float const* Rows, float const* const In[3], float* const Out[3], std::size_t Count)
+	{
+		__m256 R[4][4];
+		batch_load_rows_avx2(Rows, R);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			batch_soa_block_avx2<Translate>(R, In, Out, i);
+
+		if(i < Count)
+		{
+			float Tail[3][8] = {{0}};
+			float const* const TailIn[3] = {Tail[0], Tail[1], Tail[2]};
+			float* const TailOut[3] = {Tail[0], Tail[1], Tail[2]};
+			for(length_t c = 0; c < 3; ++c)
+				std::memcpy(Tail[c], In[c] + i, (Count - i) * sizeof(float));
+			batch_soa_block_avx2<Translate>(R, TailIn, TailOut, 0);
+			for(length_t c = 0; c < 3; ++c)
+				std::memcpy(Out[c] + i, Tail[c], (Count - i) * sizeof(float));
+		}
+	}
+
+	template<bool Homogeneous>
+	GLM_BATCH_TRANSFORM_AVX2_QUALIFIER void batch_transform_aos4_avx2(float const* Rows, float const* In, float* Out, std::size_t Count)
+	{
+		__m256 R[4][4];
+		batch_load_rows_avx2(Rows, R);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			batch_aos4_block_avx2<Homogeneous>(R, In + i * 4, Out + i * 4);
+
+		if(i < Count)
+		{
+			float Tail[32] = {0};
+			std::memcpy(Tail, In + i * 4, (Count - i) * 4 * sizeof(float));
+			batch_aos4_block_avx2<Homogeneous>(R, Tail, Tail);
+			std::memcpy(Out + i * 4, Tail, (Count - i) * 4 * sizeof(float));
+		}
+	}
+
+#	endif//defined(GLM_BATCH_TRANSFORM_AVX2)
+
+#	if defined(GLM_BATCH_TRANSFORM_SSE2)
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER void batch_transform_aos3(float const* Rows, float const* In, float* Out, std::size_t Count)
+	{
+#		if defined(GLM_BATCH_TRANSFORM_AVX2)
+			if(batch_transform_has_avx2())
+				return batch_transform_aos3_avx2<Translate>(Rows, In, Out, Count);
+#		endif
+		batch_transform_aos3_sse<Translate>(Rows, In, Out, Count);
+	}
+
+	template<bool Translate>
+	GLM_FUNC_QUALIFIER void batch_transform_soa(float const* Rows, float const* const In[3], float* const Out[3], std::size_t Count)
+	{
+#		if defined(GLM_BATCH_TRANSFORM_AVX2)
+			if(batch_transform_has_avx2())
+				return batch_transform_soa_avx2<Translate>(Rows, In, Out, Count);
+#		endif
+		batch_transform_soa_sse<Translate>(Rows, In, Out, Count);
+	}
+
+	template<bool Homogeneous>
+	GLM_FUNC_QUALIFIER void batch_transform_aos4(float const* Rows, float const* In, float* Out, std::size_t Count)
+	{
+#		if defined(GLM_BATCH_TRANSFORM_AVX2)
+			if(batch_transform_has_avx2())
+				return batch_transform_aos4_avx2<Homogeneous>(Rows, In, Out, Count);
+#		endif
+		batch_transform_aos4_sse<Homogeneous>(Rows, In, Out, Count);
+	}
+
+#	endif//defined(GLM_BATCH_TRANSFORM_SSE2)
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_batch_transform
+	{
+		GLM_FUNC_QUALIFIER static void aos3(mat<4, 4, T, Q> const& m, T w, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = vec<3, T, Q>(m * vec<4, T, Q>(in[i], w));
+		}
+
+		GLM_FUNC_QUALIFIER static void aos4(mat<4, 4, T, Q> const& m, bool homogeneous, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * (homogeneous ? in[i] : vec<4, T, Q>(vec<3, T, Q>(in[i]), static_cast<T>(0)));
+		}
+
+		GLM_FUNC_QUALIFIER static void soa(mat<4, 4, T, Q> const& m, T w, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<4, T, Q> const Result = m * vec<4, T, Q>(x[i], y[i], z[i], w);
+				outX[i] = Result.x;
+				outY[i] = Result.y;
+				outZ[i] = Result.z;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void normals(mat<3, 3, T, Q> const& n, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = n * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void normals(mat<3, 3, T, Q> const& n, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<3, T, Q> const Result = n * vec<3, T, Q>(x[i], y[i], z[i]);
+				outX[i] = Result.x;
+				outY[i] = Result.y;
+				outZ[i] = Result.z;
+			}
+		}
+	};
+
+#	if defined(GLM_BATCH_TRANSFORM_SSE2)
+
+	template<qualifier Q>
+	struct compute_batch_transform<float, Q, true>
+	{
+		typedef compute_batch_transform<float, Q, false> scalar;
+
+		// Rows of m, with the fourth column scaled by w
+		GLM_FUNC_QUALIFIER static void rows(mat<4, 4, float, Q> const& m, float w, float Rows[16])
+		{
+			for(length_t r = 0; r < 4; ++r)
+			{
+				Rows[r * 4 + 0] = m[0][r];
+				Rows[r * 4 + 1] = m[1][r];
+				Rows[r * 4 + 2] = m[2][r];
+				Rows[r * 4 + 3] = m[3][r] * w;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void rows(mat<3, 3, float, Q> const& n, float Rows[16])
+		{
+			for(length_t r = 0; r < 3; ++r)
+			{
+				Rows[r * 4 + 0] = n[0][r];
+				Rows[r * 4 + 1] = n[1][r];
+				Rows[r * 4 + 2] = n[2][r];
+				Rows[r * 4 + 3] = 0.0f;
+			}
+			for(length_t k = 0; k < 4; ++k)
+				Rows[12 + k] = 0.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static void aos3(mat<4, 4, float, Q> const& m, float w, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t count)
+		{
+			// Aligned vec3 are padded to 16 bytes
+			if(sizeof(vec<3, float, Q>) != sizeof(float) * 3)
+				return scalar::aos3(m, w, in, out, count);
+
+			float Rows[16];
+			compute_batch_transform::rows(m, w, Rows);
+			batch_transform_aos3<true>(Rows, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void aos4(mat<4, 4, float, Q> const& m, bool homogeneous, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+		{
+			float Rows[16];
+			compute_batch_transform::rows(m, homogeneous ? 1.0f : 0.0f, Rows);
+			if(homogeneous)
+				batch_transform_aos4<true>(Rows, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+			else
+				batch_transform_aos4<false>(Rows, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void soa(mat<4, 4, float, Q> const& m, float w, float const* x, float const* y, float const* z, float* outX, float* outY, float* outZ, std::size_t count)
+		{
+			float Rows[16];
+			compute_batch_transform::rows(m, w, Rows);
+			float const* const In[3] = {x, y, z};
+			float* const Out[3] = {outX, outY, outZ};
+			batch_transform_soa<true>(Rows, In, Out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normals(mat<3, 3, float, Q> const& n, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t count)
+		{
+			if(sizeof(vec<3, float, Q>) != sizeof(float) * 3)
+				return scalar::normals(n, in, out, count);
+
+			float Rows[16];
+			compute_batch_transform::rows(n, Rows);
+			batch_transform_aos3<false>(Rows, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normals(mat<3, 3, float, Q> const& n, float const* x, float const* y, float const* z, float* outX, float* outY, float* outZ, std::size_t count)
+		{
+			float Rows[16];
+			compute_batch_transform::rows(n, Rows);
+			float const* const In[3] = {x, y, z};
+			float* const Out[3] = {outX, outY, outZ};
+			batch_transform_soa<false>(Rows, In, Out, count);
+		}
+	};
+
+#	endif//defined(GLM_BATCH_TRANSFORM_SSE2)
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformPoints' only accept floating-point inputs");
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::aos3(m, static_cast<T>(1), in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformPoints' only accept floating-point inputs");
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::aos4(m, true, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformPoints' only accept floating-point inputs");
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::soa(m, static_cast<T>(1), x, y, z, outX, outY, outZ, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformDirections' only accept floating-point inputs");
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::aos3(m, static_cast<T>(0), in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformDirections' only accept floating-point inputs");
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::aos4(m, false, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, T, Q> const& m, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformDirections' only accept floating-point inputs");
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::soa(m, static_cast<T>(0), x, y, z, outX, outY, outZ, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformNormals(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformNormals' only accept floating-point inputs");
+		mat<3, 3, T, Q> const Normal(transpose(inverse(mat<3, 3, T, Q>(m))));
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::normals(Normal, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformNormals(mat<4, 4, T, Q> const& m, T const* x, T const* y, T const* z, T* outX, T* outY, T* outZ, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transformNormals' only accept floating-point inputs");
+		mat<3, 3, T, Q> const Normal(transpose(inverse(mat<3, 3, T, Q>(m))));
+		detail::compute_batch_transform<T, Q, detail::batch_transform_simd<T>::value>::normals(Normal, x, y, z, outX, outY, outZ, count);
+	}
+}//namespace glm
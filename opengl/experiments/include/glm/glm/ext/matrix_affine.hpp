@@ -0,0 +1,121 @@
+/// @ref ext_matrix_affine
+/// @file glm/ext/matrix_affine.hpp
+///
+/// @defgroup ext_matrix_affine GLM_EXT_matrix_affine
+/// @ingroup ext
+///
+/// Affine transforms stored in 48 bytes instead of the 64 bytes of a mat4.
+///
+/// The transform is a mat<3, 4, T, Q> whose three columns hold the three rows of
+/// the affine matrix: m[r] is (m00, m01, m02, tx) for r == 0 and so on. The
+/// bottom row (0, 0, 0, 1) is implicit. This is the layout gtx_dual_quaternion's
+/// mat3x4_cast produces and the layout of a row major 3x4 matrix in a GPU
+/// instance buffer. Note that the mat<3, 4, T, Q>(mat4) constructor does not
+/// convert to it, use mat3x4_cast.
+///
+/// With GLM_FORCE_INTRINSICS, float transforms go through SSE2 kernels on x86.
+///
+/// Include <glm/ext/matrix_affine.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_transform
+/// @see gtx_dual_quaternion
+
+#pragma once
+
+// Dependencies
+#include "../geometric.hpp"
+#include "../trigonometric.hpp"
+#include "../matrix.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_matrix_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_matrix_affine
+	/// @{
+
+	/// Converts an affine 4 * 4 matrix to the 3 row affine transform, dropping its bottom row.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> mat3x4_cast(mat<4, 4, T, Q> const& m);
+
+	/// Converts a 3 row affine transform to a 4 * 4 matrix, for instance to upload it as a mat4 uniform.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(mat<3, 4, T, Q> const& m);
+
+	/// Composes two affine transforms: the result applies b then a, like a * b on mat4.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineCompose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b);
+
+	/// Inverts an affine transform with an invertible linear part, scale and shear included.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m);
+
+	/// Transforms a point: vec3(mat4_cast(m) * vec4(p, 1)).
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p);
+
+	/// Transforms a direction, ignoring the translation: vec3(mat4_cast(m) * vec4(d, 0)).
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformDirection(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& d);
+
+	/// Returns m * T(v) for the translation T(v), like translate on mat4: points are translated first, then transformed by m.
+	///
+	/// @param m Input transform composed with the translation.
+	/// @param v Coordinates of a translation vector.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	///
+	/// @see - translate(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> translate(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// Returns m * R for the rotation R of angle around axis, like rotate on mat4: points are rotated first, then transformed by m.
+	///
+	/// @param m Input transform composed with the rotation.
+	/// @param angle Rotation angle expressed in radians.
+	/// @param axis Rotation axis, recommended to be normalized.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	///
+	/// @see - rotate(mat<4, 4, T, Q> const& m, T angle, vec<3, T, Q> const& axis)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> rotate(mat<3, 4, T, Q> const& m, T angle, vec<3, T, Q> const& axis);
+
+	/// Returns m * S(v) for the scale S(v), like scale on mat4: points are scaled first, then transformed by m.
+	///
+	/// @param m Input transform composed with the scale.
+	/// @param v Ratio of scaling for each axis.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	///
+	/// @see - scale(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> scale(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
@@ -0,0 +1,288 @@
+/// @ref ext_matrix_affine
+
+#include <limits>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#	define GLM_MATRIX_AFFINE_SSE2
+#	include <emmintrin.h>
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T>
+	struct compute_affine_simd
+	{
+		enum { value = false };
+	};
+
+	template<typename T, qualifier Q, bool UseSimd = compute_affine_simd<T>::value>
+	struct compute_affine
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> fromMat4(mat<4, 4, T, Q> const& m)
+		{
+			mat<3, 4, T, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = vec<4, T, Q>(m[0][r], m[1][r], m[2][r], m[3][r]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> toMat4(mat<3, 4, T, Q> const& m)
+		{
+			mat<4, 4, T, Q> Result;
+			for(length_t c = 0; c < 4; ++c)
+				Result[c] = vec<4, T, Q>(m[0][c], m[1][c], m[2][c], c == 3 ? static_cast<T>(1) : static_cast<T>(0));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> compose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+		{
+			mat<3, 4, T, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+			{
+				vec<4, T, Q> const Translation(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), a[r][3]);
+				Result[r] = (b[0] * a[r][0] + b[1] * a[r][1]) + (b[2] * a[r][2] + Translation);
+			}
+			return Result;
+		}
+
+		// The rows of the inverse linear part are the components of the cofactor columns
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> inverse(mat<3, 4, T, Q> const& m)
+		{
+			vec<3, T, Q> const Row0(m[0]);
+			vec<3, T, Q> const Row1(m[1]);
+			vec<3, T, Q> const Row2(m[2]);
+
+			vec<3, T, Q> const Col0(cross(Row1, Row2));
+			vec<3, T, Q> const Col1(cross(Row2, Row0));
+			vec<3, T, Q> const Col2(cross(Row0, Row1));
+			vec<3, T, Q> const Translation(-((Col0 * m[0][3] + Col1 * m[1][3]) + Col2 * m[2][3]));
+			T const OneOverDeterminant = static_cast<T>(1) / dot(Row0, Col0);
+
+			mat<3, 4, T, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = vec<4, T, Q>(Col0[r], Col1[r], Col2[r], Translation[r]) * OneOverDeterminant;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> transform(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v, T w)
+		{
+			vec<4, T, Q> const Point(v, w);
+			return vec<3, T, Q>(dot(m[0], Point), dot(m[1], Point), dot(m[2], Point));
+		}
+	};
+
+#	if defined(GLM_MATRIX_AFFINE_SSE2)
+
+	template<>
+	struct compute_affine_simd<float>
+	{
+		enum { value = true };
+	};
+
+	template<qualifier Q>
+	struct compute_affine<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void load(mat<3, 4, float, Q> const& m, __m128 Rows[3])
+		{
+			for(length_t r = 0; r < 3; ++r)
+				Rows[r] = _mm_loadu_ps(&m[r][0]);
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> store(__m128 const Rows[3])
+		{
+			mat<3, 4, float, Q> Result;
+			for(length_t r = 0; r < 3; ++r)
+				_mm_storeu_ps(&Result[r][0], Rows[r]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static __m128 splat(__m128 x, int Lane)
+		{
+			switch(Lane)
+			{
+			default:
+			case 0: return _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 0, 0, 0));
+			case 1: return _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 1, 1, 1));
+			case 2: return _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 2, 2, 2));
+			case 3: return _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+			}
+		}
+
+		// The w lane is a.w * b.w - a.w * b.w, zero for finite rows
+		GLM_FUNC_QUALIFIER static __m128 cross(__m128 a, __m128 b)
+		{
+			__m128 const a1 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 const b1 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+			__m128 const a2 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+			__m128 const b2 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			return _mm_sub_ps(_mm_mul_ps(a1, b1), _mm_mul_ps(a2, b2));
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> fromMat4(mat<4, 4, float, Q> const& m)
+		{
+			__m128 c0 = _mm_loadu_ps(&m[0][0]);
+			__m128 c1 = _mm_loadu_ps(&m[1][0]);
+			__m128 c2 = _mm_loadu_ps(&m[2][0]);
+			__m128 c3 = _mm_loadu_ps(&m[3][0]);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			__m128 const Rows[3] = {c0, c1, c2};
+			return store(Rows);
+		}
+
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> toMat4(mat<3, 4, float, Q> const& m)
+		{
+			__m128 r0 = _mm_loadu_ps(&m[0][0]);
+			__m128 r1 = _mm_loadu_ps(&m[1][0]);
+			__m128 r2 = _mm_loadu_ps(&m[2][0]);
+			__m128 r3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			mat<4, 4, float, Q> Result;
+			_mm_storeu_ps(&Result[0][0], r0);
+			_mm_storeu_ps(&Result[1][0], r1);
+			_mm_storeu_ps(&Result[2][0], r2);
+			_mm_storeu_ps(&Result[3][0], r3);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> compose(mat<3, 4, float, Q> const& a, mat<3, 4, float, Q> const& b)
+		{
+			__m128 A[3], B[3], Rows[3];
+			load(a, A);
+			load(b, B);
+
+			__m128 const MaskW = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+			for(length_t r = 0; r < 3; ++r)
+			{
+				__m128 const Add0 = _mm_add_ps(_mm_mul_ps(B[0], splat(A[r], 0)), _mm_mul_ps(B[1], splat(A[r], 1)));
+				__m128 const Add1 = _mm_add_ps(_mm_mul_ps(B[2], splat(A[r], 2)), _mm_and_ps(A[r], MaskW));
+				Rows[r] = _mm_add_ps(Add0, Add1);
+			}
+			return store(Rows);
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> inverse(mat<3, 4, float, Q> const& m)
+		{
+			__m128 Rows[3];
+			load(m, Rows);
+
+			__m128 Col0 = cross(Rows[1], Rows[2]);
+			__m128 Col1 = cross(Rows[2], Rows[0]);
+			__m128 Col2 = cross(Rows[0], Rows[1]);
+
+			__m128 const Add0 = _mm_add_ps(_mm_mul_ps(Col0, splat(Rows[0], 3)), _mm_mul_ps(Col1, splat(Rows[1], 3)));
+			__m128 Translation = _mm_xor_ps(_mm_set1_ps(-0.0f), _mm_add_ps(Add0, _mm_mul_ps(Col2, splat(Rows[2], 3))));
+
+			// Row0.w * Col0.w is zero, the determinant is the dot of the xyz lanes
+			__m128 const Mul = _mm_mul_ps(Rows[0], Col0);
+			__m128 const Sum = _mm_add_ps(_mm_add_ss(Mul, _mm_shuffle_ps(Mul, Mul, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_ps(Mul, Mul, _MM_SHUFFLE(2, 2, 2, 2)));
+			__m128 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), splat(Sum, 0));
+
+			_MM_TRANSPOSE4_PS(Col0, Col1, Col2, Translation);
+			Rows[0] = _mm_mul_ps(Col0, OneOverDeterminant);
+			Rows[1] = _mm_mul_ps(Col1, OneOverDeterminant);
+			Rows[2] = _mm_mul_ps(Col2, OneOverDeterminant);
+			return store(Rows);
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> transform(mat<3, 4, float, Q> const& m, vec<3, float, Q> const& v, float w)
+		{
+			__m128 const Point = _mm_setr_ps(v.x, v.y, v.z, w);
+			__m128 Mul0 = _mm_mul_ps(_mm_loadu_ps(&m[0][0]), Point);
+			__m128 Mul1 = _mm_mul_ps(_mm_loadu_ps(&m[1][0]), Point);
+			__m128 Mul2 = _mm_mul_ps(_mm_loadu_ps(&m[2][0]), Point);
+			__m128 Mul3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(Mul0, Mul1, Mul2, Mul3);
+
+			float Result[4];
+			_mm_storeu_ps(Result, _mm_add_ps(_mm_add_ps(Mul0, Mul1), _mm_add_ps(Mul2, Mul3)));
+			return vec<3, float, Q>(Result[0], Result[1], Result[2]);
+		}
+	};
+
+#	endif//defined(GLM_MATRIX_AFFINE_SSE2)
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> mat3x4_cast(mat<4, 4, T, Q> const& m)
+	{
+		return detail::compute_affine<T, Q>::fromMat4(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(mat<3, 4, T, Q> const& m)
+	{
+		return detail::compute_affine<T, Q>::toMat4(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineCompose(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'affineCompose' only accept floating-point inputs");
+		return detail::compute_affine<T, Q>::compose(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'affineInverse' only accept floating-point inputs");
+		return detail::compute_affine<T, Q>::inverse(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p)
+	{
+		return detail::compute_affine<T, Q>::transform(m, p, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformDirection(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& d)
+	{
+		return detail::compute_affine<T, Q>::transform(m, d, static_cast<T>(0));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> translate(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		vec<3, T, Q> const Translation(transformPoint(m, v));
+
+		mat<3, 4, T, Q> Result(m);
+		Result[0][3] = Translation.x;
+		Result[1][3] = Translation.y;
+		Result[2][3] = Translation.z;
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> rotate(mat<3, 4, T, Q> const& m, T angle, vec<3, T, Q> const& v)
+	{
+		T const a = angle;
+		T const c = cos(a);
+		T const s = sin(a);
+
+		vec<3, T, Q> axis(normalize(v));
+		vec<3, T, Q> temp((T(1) - c) * axis);
+
+		// Rows of the rotation, the transpose of the columns built by rotate on mat4
+		mat<3, 4, T, Q> Rotate;
+		Rotate[0] = vec<4, T, Q>(c + temp[0] * axis[0], temp[1] * axis[0] - s * axis[2], temp[2] * axis[0] + s * axis[1], static_cast<T>(0));
+		Rotate[1] = vec<4, T, Q>(temp[0] * axis[1] + s * axis[2], c + temp[1] * axis[1], temp[2] * axis[1] - s * axis[0], static_cast<T>(0));
+		Rotate[2] = vec<4, T, Q>(temp[0] * axis[2] - s * axis[1], temp[1] * axis[2] + s * axis[0], c + temp[2] * axis[2], static_cast<T>(0));
+
+		return affineCompose(m, Rotate);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> scale(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		vec<4, T, Q> const Scale(v, static_cast<T>(1));
+
+		mat<3, 4, T, Q> Result;
+		Result[0] = m[0] * Scale;
+		Result[1] = m[1] * Scale;
+		Result[2] = m[2] * Scale;
+		return Result;
+	}
+}//namespace glm
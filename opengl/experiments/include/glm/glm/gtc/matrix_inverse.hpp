@@ -18,6 +18,7 @@
 #include "../mat2x2.hpp"
 #include "../mat3x3.hpp"
 #include "../mat4x4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_matrix_inverse extension included")
@@ -44,6 +45,28 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType inverseTranspose(genType const& m);
 
+	/// Inverts count 4 * 4 matrices, like calling inverse on each of them.
+	/// With GLM_FORCE_INTRINSICS, float matrices are processed 4 at a time in SSE2 registers, 8 with AVX2, in SoA form.
+	/// A singular matrix, whose determinant is zero, gives a zero matrix; the kernels select it with a mask, without branching.
+	/// in and out may be the same array but must not otherwise overlap.
+	///
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void inverse(mat<4, 4, T, Q> const* in, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// Computes the inverse transpose of count 4 * 4 matrices, for instance the normal matrices of many objects.
+	/// Same kernels and singular matrix handling as the batch inverse.
+	///
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void inverseTranspose(mat<4, 4, T, Q> const* in, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// Computes the determinant of count 4 * 4 matrices, like calling determinant on each of them.
+	///
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void determinant(mat<4, 4, T, Q> const* in, T* out, std::size_t count);
+
 	/// @}
 }//namespace glm
 
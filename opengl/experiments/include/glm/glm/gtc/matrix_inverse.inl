@@ -1,5 +1,15 @@
 /// @ref gtc_matrix_inverse
 
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#	define GLM_MATRIX_INVERSE_SSE2
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#		define GLM_MATRIX_INVERSE_AVX2
+#		include <immintrin.h>
+#	else
+#		include <emmintrin.h>
+#	endif
+#endif
+
 namespace glm
 {
 	template<typename T, qualifier Q>
@@ -115,4 +125,377 @@ namespace glm
 
 		return Inverse;
 	}
+
+namespace detail
+{
+	// One matrix at a time, for the types without SIMD kernels
+	template<typename T>
+	struct inverse_batch_scalar
+	{
+		typedef T value_type;
+		typedef T type;
+		enum { size = 1 };
+
+		GLM_FUNC_QUALIFIER static type set1(T x) { return x; }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return a + b; }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return a - b; }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return a * b; }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return a / b; }
+		GLM_FUNC_QUALIFIER static type neg(type x) { return -x; }
+		GLM_FUNC_QUALIFIER static type zeroIfZero(type a, type x) { return a == static_cast<T>(0) ? static_cast<T>(0) : x; }
+		GLM_FUNC_QUALIFIER static void load4(T const* p, type Out[4])
+		{
+			Out[0] = p[0];
+			Out[1] = p[1];
+			Out[2] = p[2];
+			Out[3] = p[3];
+		}
+		GLM_FUNC_QUALIFIER static void store4(T* p, type a, type b, type c, type d)
+		{
+			p[0] = a;
+			p[1] = b;
+			p[2] = c;
+			p[3] = d;
+		}
+		GLM_FUNC_QUALIFIER static void store(T* p, type x) { *p = x; }
+	};
+
+#	if defined(GLM_MATRIX_INVERSE_SSE2)
+
+	struct inverse_batch_sse2
+	{
+		typedef float value_type;
+		typedef __m128 type;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type neg(type x) { return _mm_xor_ps(x, _mm_set1_ps(-0.0f)); }
+		GLM_FUNC_QUALIFIER static type zeroIfZero(type a, type x) { return _mm_andnot_ps(_mm_cmpeq_ps(a, _mm_setzero_ps()), x); }
+
+		// Out[k] holds the float k of the column at p of the four consecutive matrices
+		GLM_FUNC_QUALIFIER static void load4(float const* p, type Out[4])
+		{
+			Out[0] = _mm_loadu_ps(p + 0);
+			Out[1] = _mm_loadu_ps(p + 16);
+			Out[2] = _mm_loadu_ps(p + 32);
+			Out[3] = _mm_loadu_ps(p + 48);
+			_MM_TRANSPOSE4_PS(Out[0], Out[1], Out[2], Out[3]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store4(float* p, type a, type b, type c, type d)
+		{
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+			_mm_storeu_ps(p + 0, a);
+			_mm_storeu_ps(p + 16, b);
+			_mm_storeu_ps(p + 32, c);
+			_mm_storeu_ps(p + 48, d);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm_storeu_ps(p, x); }
+	};
+
+#	endif//defined(GLM_MATRIX_INVERSE_SSE2)
+
+#	if defined(GLM_MATRIX_INVERSE_AVX2)
+
+	struct inverse_batch_avx2
+	{
+		typedef float value_type;
+		typedef __m256 type;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type neg(type x) { return _mm256_xor_ps(x, _mm256_set1_ps(-0.0f)); }
+		GLM_FUNC_QUALIFIER static type zeroIfZero(type a, type x) { return _mm256_andnot_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ), x); }
+
+		// 4x4 transposes within each 128-bit half
+		GLM_FUNC_QUALIFIER static void transpose(type& a, type& b, type& c, type& d)
+		{
+			__m256 const T0 = _mm256_unpacklo_ps(a, b);
+			__m256 const T1 = _mm256_unpacklo_ps(c, d);
+			__m256 const T2 = _mm256_unpackhi_ps(a, b);
+			__m256 const T3 = _mm256_unpackhi_ps(c, d);
+			a = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0));
+			b = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2));
+			c = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0));
+			d = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		// Matrices 0 to 3 in the low halves and 4 to 7 in the high halves
+		GLM_FUNC_QUALIFIER static type load2(float const* p)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 64), 1);
+		}
+
+		GLM_FUNC_QUALIFIER static void store2(float* p, type x)
+		{
+			_mm_storeu_ps(p, _mm256_castps256_ps128(x));
+			_mm_storeu_ps(p + 64, _mm256_extractf128_ps(x, 1));
+		}
+
+		GLM_FUNC_QUALIFIER static void load4(float const* p, type Out[4])
+		{
+			Out[0] = load2(p + 0);
+			Out[1] = load2(p + 16);
+			Out[2] = load2(p + 32);
+			Out[3] = load2(p + 48);
+			transpose(Out[0], Out[1], Out[2], Out[3]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store4(float* p, type a, type b, type c, type d)
+		{
+			transpose(a, b, c, d);
+			store2(p + 0, a);
+			store2(p + 16, b);
+			store2(p + 32, c);
+			store2(p + 48, d);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm256_storeu_ps(p, x); }
+	};
+
+#	endif//defined(GLM_MATRIX_INVERSE_AVX2)
+
+	template<typename T>
+	struct inverse_batch_pack
+	{
+		typedef inverse_batch_scalar<T> type;
+	};
+
+#	if defined(GLM_MATRIX_INVERSE_AVX2)
+	template<>
+	struct inverse_batch_pack<float>
+	{
+		typedef inverse_batch_avx2 type;
+	};
+#	elif defined(GLM_MATRIX_INVERSE_SSE2)
+	template<>
+	struct inverse_batch_pack<float>
+	{
+		typedef inverse_batch_sse2 type;
+	};
+#	endif
+
+	// P::size consecutive matrices at a time in SoA form, m[c][r] holds the element [c][r]
+	// of every matrix. The kernels evaluate the expressions of compute_inverse and
+	// compute_determinant in the same order.
+	template<typename P>
+	struct inverse_batch_kernel
+	{
+		typedef typename P::value_type T;
+		typedef typename P::type type;
+
+		GLM_FUNC_QUALIFIER static type coef(type a, type b, type c, type d)
+		{
+			return P::sub(P::mul(a, b), P::mul(c, d));
+		}
+
+		// (a * b - c * d) + e * f
+		GLM_FUNC_QUALIFIER static type cofactor(type a, type b, type c, type d, type e, type f)
+		{
+			return P::add(P::sub(P::mul(a, b), P::mul(c, d)), P::mul(e, f));
+		}
+
+		template<bool Transpose>
+		GLM_FUNC_QUALIFIER static void inverse(T const* In, T* Out)
+		{
+			type m[4][4];
+			P::load4(In + 0, m[0]);
+			P::load4(In + 4, m[1]);
+			P::load4(In + 8, m[2]);
+			P::load4(In + 12, m[3]);
+
+			type const Coef00 = coef(m[2][2], m[3][3], m[3][2], m[2][3]);
+			type const Coef02 = coef(m[1][2], m[3][3], m[3][2], m[1][3]);
+			type const Coef03 = coef(m[1][2], m[2][3], m[2][2], m[1][3]);
+
+			type const Coef04 = coef(m[2][1], m[3][3], m[3][1], m[2][3]);
+			type const Coef06 = coef(m[1][1], m[3][3], m[3][1], m[1][3]);
+			type const Coef07 = coef(m[1][1], m[2][3], m[2][1], m[1][3]);
+
+			type const Coef08 = coef(m[2][1], m[3][2], m[3][1], m[2][2]);
+			type const Coef10 = coef(m[1][1], m[3][2], m[3][1], m[1][2]);
+			type const Coef11 = coef(m[1][1], m[2][2], m[2][1], m[1][2]);
+
+			type const Coef12 = coef(m[2][0], m[3][3], m[3][0], m[2][3]);
+			type const Coef14 = coef(m[1][0], m[3][3], m[3][0], m[1][3]);
+			type const Coef15 = coef(m[1][0], m[2][3], m[2][0], m[1][3]);
+
+			type const Coef16 = coef(m[2][0], m[3][2], m[3][0], m[2][2]);
+			type const Coef18 = coef(m[1][0], m[3][2], m[3][0], m[1][2]);
+			type const Coef19 = coef(m[1][0], m[2][2], m[2][0], m[1][2]);
+
+			type const Coef20 = coef(m[2][0], m[3][1], m[3][0], m[2][1]);
+			type const Coef22 = coef(m[1][0], m[3][1], m[3][0], m[1][1]);
+			type const Coef23 = coef(m[1][0], m[2][1], m[2][0], m[1][1]);
+
+			type Inverse[4][4];
+
+			// The Vec0 to Vec3 of compute_inverse take m[1] in row 0 and m[0] in rows 1 to 3
+			type const* const Vec = m[0];
+			type const* const Vec0 = m[1];
+
+			// SignA(+1, -1, +1, -1) on the even columns and SignB(-1, +1, -1, +1) on the odd ones
+			Inverse[0][0] = cofactor(Vec0[1], Coef00, Vec0[2], Coef04, Vec0[3], Coef08);
+			Inverse[0][1] = P::neg(cofactor(Vec[1], Coef00, Vec[2], Coef04, Vec[3], Coef08));
+			Inverse[0][2] = cofactor(Vec[1], Coef02, Vec[2], Coef06, Vec[3], Coef10);
+			Inverse[0][3] = P::neg(cofactor(Vec[1], Coef03, Vec[2], Coef07, Vec[3], Coef11));
+
+			Inverse[1][0] = P::neg(cofactor(Vec0[0], Coef00, Vec0[2], Coef12, Vec0[3], Coef16));
+			Inverse[1][1] = cofactor(Vec[0], Coef00, Vec[2], Coef12, Vec[3], Coef16);
+			Inverse[1][2] = P::neg(cofactor(Vec[0], Coef02, Vec[2], Coef14, Vec[3], Coef18));
+			Inverse[1][3] = cofactor(Vec[0], Coef03, Vec[2], Coef15, Vec[3], Coef19);
+
+			Inverse[2][0] = cofactor(Vec0[0], Coef04, Vec0[1], Coef12, Vec0[3], Coef20);
+			Inverse[2][1] = P::neg(cofactor(Vec[0], Coef04, Vec[1], Coef12, Vec[3], Coef20));
+			Inverse[2][2] = cofactor(Vec[0], Coef06, Vec[1], Coef14, Vec[3], Coef22);
+			Inverse[2][3] = P::neg(cofactor(Vec[0], Coef07, Vec[1], Coef15, Vec[3], Coef23));
+
+			Inverse[3][0] = P::neg(cofactor(Vec0[0], Coef08, Vec0[1], Coef16, Vec0[2], Coef20));
+			Inverse[3][1] = cofactor(Vec[0], Coef08, Vec[1], Coef16, Vec[2], Coef20);
+			Inverse[3][2] = P::neg(cofactor(Vec[0], Coef10, Vec[1], Coef18, Vec[2], Coef22));
+			Inverse[3][3] = cofactor(Vec[0], Coef11, Vec[1], Coef19, Vec[2], Coef23);
+
+			type const Dot1 = P::add(
+				P::add(P::mul(m[0][0], Inverse[0][0]), P::mul(m[0][1], Inverse[1][0])),
+				P::add(P::mul(m[0][2], Inverse[2][0]), P::mul(m[0][3], Inverse[3][0])));
+
+			// Zero instead of the infinity of a singular matrix
+			type const OneOverDeterminant = P::zeroIfZero(Dot1, P::div(P::set1(static_cast<T>(1)), Dot1));
+
+			type Result[4][4];
+			Result[0][0] = P::mul(Inverse[0][0], OneOverDeterminant);
+			Result[0][1] = P::mul(Inverse[0][1], OneOverDeterminant);
+			Result[0][2] = P::mul(Inverse[0][2], OneOverDeterminant);
+			Result[0][3] = P::mul(Inverse[0][3], OneOverDeterminant);
+			Result[1][0] = P::mul(Inverse[1][0], OneOverDeterminant);
+			Result[1][1] = P::mul(Inverse[1][1], OneOverDeterminant);
+			Result[1][2] = P::mul(Inverse[1][2], OneOverDeterminant);
+			Result[1][3] = P::mul(Inverse[1][3], OneOverDeterminant);
+			Result[2][0] = P::mul(Inverse[2][0], OneOverDeterminant);
+			Result[2][1] = P::mul(Inverse[2][1], OneOverDeterminant);
+			Result[2][2] = P::mul(Inverse[2][2], OneOverDeterminant);
+			Result[2][3] = P::mul(Inverse[2][3], OneOverDeterminant);
+			Result[3][0] = P::mul(Inverse[3][0], OneOverDeterminant);
+			Result[3][1] = P::mul(Inverse[3][1], OneOverDeterminant);
+			Result[3][2] = P::mul(Inverse[3][2], OneOverDeterminant);
+			Result[3][3] = P::mul(Inverse[3][3], OneOverDeterminant);
+
+			if(Transpose)
+			{
+				P::store4(Out + 0, Result[0][0], Result[1][0], Result[2][0], Result[3][0]);
+				P::store4(Out + 4, Result[0][1], Result[1][1], Result[2][1], Result[3][1]);
+				P::store4(Out + 8, Result[0][2], Result[1][2], Result[2][2], Result[3][2]);
+				P::store4(Out + 12, Result[0][3], Result[1][3], Result[2][3], Result[3][3]);
+			}
+			else
+			{
+				P::store4(Out + 0, Result[0][0], Result[0][1], Result[0][2], Result[0][3]);
+				P::store4(Out + 4, Result[1][0], Result[1][1], Result[1][2], Result[1][3]);
+				P::store4(Out + 8, Result[2][0], Result[2][1], Result[2][2], Result[2][3]);
+				P::store4(Out + 12, Result[3][0], Result[3][1], Result[3][2], Result[3][3]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void determinant(T const* In, T* Out)
+		{
+			type m[4][4];
+			P::load4(In + 0, m[0]);
+			P::load4(In + 4, m[1]);
+			P::load4(In + 8, m[2]);
+			P::load4(In + 12, m[3]);
+
+			type const SubFactor00 = coef(m[2][2], m[3][3], m[3][2], m[2][3]);
+			type const SubFactor01 = coef(m[2][1], m[3][3], m[3][1], m[2][3]);
+			type const SubFactor02 = coef(m[2][1], m[3][2], m[3][1], m[2][2]);
+			type const SubFactor03 = coef(m[2][0], m[3][3], m[3][0], m[2][3]);
+			type const SubFactor04 = coef(m[2][0], m[3][2], m[3][0], m[2][2]);
+			type const SubFactor05 = coef(m[2][0], m[3][1], m[3][0], m[2][1]);
+
+			type const DetCof0 = cofactor(m[1][1], SubFactor00, m[1][2], SubFactor01, m[1][3], SubFactor02);
+			type const DetCof1 = P::neg(cofactor(m[1][0], SubFactor00, m[1][2], SubFactor03, m[1][3], SubFactor04));
+			type const DetCof2 = cofactor(m[1][0], SubFactor01, m[1][1], SubFactor03, m[1][3], SubFactor05);
+			type const DetCof3 = P::neg(cofactor(m[1][0], SubFactor02, m[1][1], SubFactor04, m[1][2], SubFactor05));
+
+			P::store(Out, P::add(P::add(P::add(P::mul(m[0][0], DetCof0), P::mul(m[0][1], DetCof1)), P::mul(m[0][2], DetCof2)), P::mul(m[0][3], DetCof3)));
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct compute_inverse_batch
+	{
+		typedef typename inverse_batch_pack<T>::type pack;
+		typedef inverse_batch_kernel<pack> kernel;
+
+		// The last partial block goes through a copy padded with its first matrix
+		template<bool Transpose>
+		GLM_FUNC_QUALIFIER static void inverse(mat<4, 4, T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count)
+		{
+			std::size_t const Size = static_cast<std::size_t>(pack::size);
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				kernel::template inverse<Transpose>(&In[i][0][0], &Out[i][0][0]);
+
+			if(i == Count)
+				return;
+
+			mat<4, 4, T, Q> Block[pack::size];
+			for(std::size_t l = 0; l < Size; ++l)
+				Block[l] = In[i + l < Count ? i + l : i];
+			kernel::template inverse<Transpose>(&Block[0][0][0], &Block[0][0][0]);
+			for(std::size_t l = 0; i + l < Count; ++l)
+				Out[i + l] = Block[l];
+		}
+
+		GLM_FUNC_QUALIFIER static void determinant(mat<4, 4, T, Q> const* In, T* Out, std::size_t Count)
+		{
+			std::size_t const Size = static_cast<std::size_t>(pack::size);
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				kernel::determinant(&In[i][0][0], Out + i);
+
+			if(i == Count)
+				return;
+
+			mat<4, 4, T, Q> Block[pack::size];
+			for(std::size_t l = 0; l < Size; ++l)
+				Block[l] = In[i + l < Count ? i + l : i];
+			T Lane[pack::size];
+			kernel::determinant(&Block[0][0][0], Lane);
+			for(std::size_t l = 0; i + l < Count; ++l)
+				Out[i + l] = Lane[l];
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void inverse(mat<4, 4, T, Q> const* in, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'inverse' only accept floating-point inputs");
+		detail::compute_inverse_batch<T, Q>::template inverse<false>(in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void inverseTranspose(mat<4, 4, T, Q> const* in, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'inverseTranspose' only accept floating-point inputs");
+		detail::compute_inverse_batch<T, Q>::template inverse<true>(in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void determinant(mat<4, 4, T, Q> const* in, T* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'determinant' only accept floating-point inputs");
+		detail::compute_inverse_batch<T, Q>::determinant(in, out, count);
+	}
 }//namespace glm
@@ -13,6 +13,19 @@
 /// https://github.com/ashima/webgl-noise
 /// Following Stefan Gustavson's paper "Simplex noise demystified":
 /// http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
+///
+/// The batch functions evaluate perlin and simplex noise over arrays of points or
+/// over 2D and 3D grids, with an optional fBm sum of octaves and rows split across
+/// threads. With GLM_FORCE_INTRINSICS, float 2D and 3D noise goes through SSE2
+/// kernels on x86, eight points at a time with AVX2 when the compiler targets it.
+/// The kernels follow the scalar expressions and do not contract them, results
+/// stay within 1e-5 of the scalar functions. Other cases call the scalar functions.
+///
+/// 3D perlin picks a gradient from the sign of gz = 0.5 - |gx| - |gy|, which is
+/// exactly 0 for some permutation hashes. A compiler contracting perlin(vec3)
+/// into FMA instructions (GCC does by default with -mfma) may round gz to the
+/// other side of 0 on those ties. Such samples then use another gradient than
+/// the kernels and may differ by up to 0.5 per octave.
 
 #pragma once
 
@@ -26,6 +39,7 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,6 +69,58 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Classic perlin noise of count points, out[i] = perlin(in[i]).
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void perlin(
+		vec<L, T, Q> const* in,
+		T* out,
+		std::size_t count);
+
+	/// Simplex noise of count points, out[i] = simplex(in[i]).
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void simplex(
+		vec<L, T, Q> const* in,
+		T* out,
+		std::size_t count);
+
+	/// Classic perlin noise over a 2D or 3D grid of size samples, stored x first then y then z.
+	///
+	/// The sample at (x, y, z) is the sum over octaves o of gain^o * perlin((origin + step * (x, y, z)) * lacunarity^o).
+	/// With threads above 1 and C++11, the rows of the grid are split between that many threads.
+	/// Nothing is written when an extent of size is zero or negative.
+	///
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void perlinGrid(
+		vec<L, T, Q> const& origin,
+		vec<L, T, Q> const& step,
+		vec<L, int, Q> const& size,
+		T* out,
+		int octaves = 1,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5),
+		unsigned threads = 1);
+
+	/// Simplex noise over a 2D or 3D grid of size samples, stored x first then y then z.
+	///
+	/// The sample at (x, y, z) is the sum over octaves o of gain^o * simplex((origin + step * (x, y, z)) * lacunarity^o).
+	/// With threads above 1 and C++11, the rows of the grid are split between that many threads.
+	/// Nothing is written when an extent of size is zero or negative.
+	///
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void simplexGrid(
+		vec<L, T, Q> const& origin,
+		vec<L, T, Q> const& step,
+		vec<L, int, Q> const& size,
+		T* out,
+		int octaves = 1,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5),
+		unsigned threads = 1);
+
 	/// @}
 }//namespace glm
 
@@ -5,6 +5,25 @@
 // Following Stefan Gustavson's paper "Simplex noise demystified":
 // http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
 
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <thread>
+#	include <vector>
+#endif
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#	define GLM_NOISE_SSE2
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#		define GLM_NOISE_SSE41
+#		define GLM_NOISE_AVX2
+#		include <immintrin.h>
+#	elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+#		define GLM_NOISE_SSE41
+#		include <smmintrin.h>
+#	else
+#		include <emmintrin.h>
+#	endif
+#endif
+
 namespace glm{
 namespace gtc
 {
@@ -805,3 +824,616 @@ namespace gtc
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+#	if defined(GLM_NOISE_SSE2)
+
+	struct noise_sse2
+	{
+		typedef __m128 type;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm_storeu_ps(p, x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type abs(type x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+
+		GLM_FUNC_QUALIFIER static type floor(type x)
+		{
+#			if defined(GLM_NOISE_SSE41)
+				return _mm_floor_ps(x);
+#			else
+				// Truncate and correct the negative values, from 2^23 floats are integers and may not fit the conversion
+				__m128 const Trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+				__m128 const Floor = _mm_sub_ps(Trunc, _mm_and_ps(_mm_cmpgt_ps(Trunc, x), _mm_set1_ps(1.0f)));
+				__m128 const Small = _mm_cmplt_ps(abs(x), _mm_set1_ps(8388608.0f));
+				return _mm_or_ps(_mm_and_ps(Small, Floor), _mm_andnot_ps(Small, x));
+#			endif
+		}
+
+		// a > b ? 1 : 0
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return _mm_and_ps(_mm_cmpgt_ps(a, b), _mm_set1_ps(1.0f)); }
+
+		// glm::step, x < edge ? 0 : 1
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm_and_ps(_mm_cmpnlt_ps(x, edge), _mm_set1_ps(1.0f)); }
+	};
+
+#	endif//defined(GLM_NOISE_SSE2)
+
+#	if defined(GLM_NOISE_AVX2)
+
+	struct noise_avx2
+	{
+		typedef __m256 type;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm256_storeu_ps(p, x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type abs(type x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+		GLM_FUNC_QUALIFIER static type floor(type x) { return _mm256_floor_ps(x); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ), _mm256_set1_ps(1.0f)); }
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm256_and_ps(_mm256_cmp_ps(x, edge, _CMP_NLT_UQ), _mm256_set1_ps(1.0f)); }
+	};
+
+#	endif//defined(GLM_NOISE_AVX2)
+
+	// The scalar noise functions on P::size points at once, operation for operation
+	template<typename P>
+	struct noise_kernel
+	{
+		typedef typename P::type V;
+
+		GLM_FUNC_QUALIFIER static V c(float x) { return P::set1(x); }
+
+		// detail::mod289
+		GLM_FUNC_QUALIFIER static V mod289(V x)
+		{
+			return P::sub(x, P::mul(P::floor(P::mul(x, c(1.0f / 289.0f))), c(289.0f)));
+		}
+
+		// glm::mod(x, 289)
+		GLM_FUNC_QUALIFIER static V mod(V x)
+		{
+			return P::sub(x, P::mul(c(289.0f), P::floor(P::div(x, c(289.0f)))));
+		}
+
+		GLM_FUNC_QUALIFIER static V permute(V x)
+		{
+			return mod289(P::mul(P::add(P::mul(x, c(34.0f)), c(1.0f)), x));
+		}
+
+		GLM_FUNC_QUALIFIER static V taylorInvSqrt(V r)
+		{
+			return P::sub(c(static_cast<float>(1.79284291400159)), P::mul(c(static_cast<float>(0.85373472095314)), r));
+		}
+
+		GLM_FUNC_QUALIFIER static V fade(V t)
+		{
+			return P::mul(P::mul(P::mul(t, t), t), P::add(P::mul(t, P::sub(P::mul(t, c(6.0f)), c(15.0f))), c(10.0f)));
+		}
+
+		GLM_FUNC_QUALIFIER static V fract(V x)
+		{
+			return P::sub(x, P::floor(x));
+		}
+
+		GLM_FUNC_QUALIFIER static V mix(V x, V y, V a)
+		{
+			return P::add(P::mul(x, P::sub(c(1.0f), a)), P::mul(y, a));
+		}
+
+		GLM_FUNC_QUALIFIER static V dot(V ax, V ay, V bx, V by)
+		{
+			return P::add(P::mul(ax, bx), P::mul(ay, by));
+		}
+
+		GLM_FUNC_QUALIFIER static V dot(V ax, V ay, V az, V bx, V by, V bz)
+		{
+			return P::add(P::add(P::mul(ax, bx), P::mul(ay, by)), P::mul(az, bz));
+		}
+
+		// dot(gradient, f) of a corner of perlin(vec2)
+		GLM_FUNC_QUALIFIER static V perlinCorner2(V ix, V iy, V fx, V fy)
+		{
+			V const i = permute(P::add(ix, iy));
+			V gx = P::sub(P::mul(c(2.0f), fract(P::div(i, c(41.0f)))), c(1.0f));
+			V const gy = P::sub(P::abs(gx), c(0.5f));
+			gx = P::sub(gx, P::floor(P::add(gx, c(0.5f))));
+			V const norm = taylorInvSqrt(dot(gx, gy, gx, gy));
+			return dot(P::mul(gx, norm), P::mul(gy, norm), fx, fy);
+		}
+
+		GLM_FUNC_QUALIFIER static V perlin(V x, V y)
+		{
+			V const Floorx = P::floor(x);
+			V const Floory = P::floor(y);
+			V const ix0 = permute(mod(Floorx));
+			V const ix1 = permute(mod(P::add(Floorx, c(1.0f))));
+			V const iy0 = mod(Floory);
+			V const iy1 = mod(P::add(Floory, c(1.0f)));
+			V const fx0 = fract(x);
+			V const fy0 = fract(y);
+			V const fx1 = P::sub(fx0, c(1.0f));
+			V const fy1 = P::sub(fy0, c(1.0f));
+
+			V const n00 = perlinCorner2(ix0, iy0, fx0, fy0);
+			V const n10 = perlinCorner2(ix1, iy0, fx1, fy0);
+			V const n01 = perlinCorner2(ix0, iy1, fx0, fy1);
+			V const n11 = perlinCorner2(ix1, iy1, fx1, fy1);
+
+			V const fadex = fade(fx0);
+			V const fadey = fade(fy0);
+			return P::mul(c(2.3f), mix(mix(n00, n10, fadex), mix(n01, n11, fadex), fadey));
+		}
+
+		// dot(gradient, f) of a corner of perlin(vec3)
+		GLM_FUNC_QUALIFIER static V perlinCorner3(V ixyz, V fx, V fy, V fz)
+		{
+			V gx = P::mul(ixyz, c(static_cast<float>(1.0 / 7.0)));
+			V gy = P::sub(fract(P::mul(P::floor(gx), c(static_cast<float>(1.0 / 7.0)))), c(0.5f));
+			gx = fract(gx);
+			V const gz = P::sub(P::sub(c(0.5f), P::abs(gx)), P::abs(gy));
+			V const sz = P::step(gz, P::set1(0.0f));
+			gx = P::sub(gx, P::mul(sz, P::sub(P::step(c(0.0f), gx), c(0.5f))));
+			gy = P::sub(gy, P::mul(sz, P::sub(P::step(c(0.0f), gy), c(0.5f))));
+			V const norm = taylorInvSqrt(dot(gx, gy, gz, gx, gy, gz));
+			return dot(P::mul(gx, norm), P::mul(gy, norm), P::mul(gz, norm), fx, fy, fz);
+		}
+
+		GLM_FUNC_QUALIFIER static V perlin(V x, V y, V z)
+		{
+			V const Pi0x = P::floor(x);
+			V const Pi0y = P::floor(y);
+			V const Pi0z = P::floor(z);
+			V const ix0 = permute(mod289(Pi0x));
+			V const ix1 = permute(mod289(P::add(Pi0x, c(1.0f))));
+			V const iy0 = mod289(Pi0y);
+			V const iy1 = mod289(P::add(Pi0y, c(1.0f)));
+			V const iz0 = mod289(Pi0z);
+			V const iz1 = mod289(P::add(Pi0z, c(1.0f)));
+			V const fx0 = fract(x);
+			V const fy0 = fract(y);
+			V const fz0 = fract(z);
+			V const fx1 = P::sub(fx0, c(1.0f));
+			V const fy1 = P::sub(fy0, c(1.0f));
+			V const fz1 = P::sub(fz0, c(1.0f));
+
+			V const ixy00 = permute(P::add(ix0, iy0));
+			V const ixy10 = permute(P::add(ix1, iy0));
+			V const ixy01 = permute(P::add(ix0, iy1));
+			V const ixy11 = permute(P::add(ix1, iy1));
+
+			V const n000 = perlinCorner3(permute(P::add(ixy00, iz0)), fx0, fy0, fz0);
+			V const n100 = perlinCorner3(permute(P::add(ixy10, iz0)), fx1, fy0, fz0);
+			V const n010 = perlinCorner3(permute(P::add(ixy01, iz0)), fx0, fy1, fz0);
+			V const n110 = perlinCorner3(permute(P::add(ixy11, iz0)), fx1, fy1, fz0);
+			V const n001 = perlinCorner3(permute(P::add(ixy00, iz1)), fx0, fy0, fz1);
+			V const n101 = perlinCorner3(permute(P::add(ixy10, iz1)), fx1, fy0, fz1);
+			V const n011 = perlinCorner3(permute(P::add(ixy01, iz1)), fx0, fy1, fz1);
+			V const n111 = perlinCorner3(permute(P::add(ixy11, iz1)), fx1, fy1, fz1);
+
+			V const fadex = fade(fx0);
+			V const fadey = fade(fy0);
+			V const fadez = fade(fz0);
+			V const nz00 = mix(n000, n001, fadez);
+			V const nz10 = mix(n100, n101, fadez);
+			V const nz01 = mix(n010, n011, fadez);
+			V const nz11 = mix(n110, n111, fadez);
+			return P::mul(c(2.2f), mix(mix(nz00, nz01, fadey), mix(nz10, nz11, fadey), fadex));
+		}
+
+		GLM_FUNC_QUALIFIER static V simplex(V vx, V vy)
+		{
+			V const Cx = c(static_cast<float>(0.211324865405187));
+			V const Cy = c(static_cast<float>(0.366025403784439));
+			V const Cz = c(static_cast<float>(-0.577350269189626));
+			V const Cw = c(static_cast<float>(0.024390243902439));
+
+			// First corner
+			V const s = dot(vx, vy, Cy, Cy);
+			V ix = P::floor(P::add(vx, s));
+			V iy = P::floor(P::add(vy, s));
+			V const t = dot(ix, iy, Cx, Cx);
+			V const x0x = P::add(P::sub(vx, ix), t);
+			V const x0y = P::add(P::sub(vy, iy), t);
+
+			// Other corners
+			V const i1x = P::greater(x0x, x0y);
+			V const i1y = P::sub(c(1.0f), i1x);
+			V const x1x = P::sub(P::add(x0x, Cx), i1x);
+			V const x1y = P::sub(P::add(x0y, Cx), i1y);
+			V const x2x = P::add(x0x, Cz);
+			V const x2y = P::add(x0y, Cz);
+
+			// Permutations
+			ix = mod(ix);
+			iy = mod(iy);
+			V const p0 = permute(P::add(P::add(permute(iy), ix), c(0.0f)));
+			V const p1 = permute(P::add(P::add(permute(P::add(iy, i1y)), ix), i1x));
+			V const p2 = permute(P::add(P::add(permute(P::add(iy, c(1.0f))), ix), c(1.0f)));
+
+			V m0 = P::max(P::sub(c(0.5f), dot(x0x, x0y, x0x, x0y)), c(0.0f));
+			V m1 = P::max(P::sub(c(0.5f), dot(x1x, x1y, x1x, x1y)), c(0.0f));
+			V m2 = P::max(P::sub(c(0.5f), dot(x2x, x2y, x2x, x2y)), c(0.0f));
+			m0 = P::mul(m0, m0);
+			m1 = P::mul(m1, m1);
+			m2 = P::mul(m2, m2);
+			m0 = P::mul(m0, m0);
+			m1 = P::mul(m1, m1);
+			m2 = P::mul(m2, m2);
+
+			V const g0 = simplexGradient(p0, Cw, x0x, x0y, m0);
+			V const g1 = simplexGradient(p1, Cw, x1x, x1y, m1);
+			V const g2 = simplexGradient(p2, Cw, x2x, x2y, m2);
+			return P::mul(c(130.0f), P::add(P::add(g0, g1), g2));
+		}
+
+		// m * dot(gradient, x) of a corner of simplex(vec2)
+		GLM_FUNC_QUALIFIER static V simplexGradient(V p, V Cw, V x, V y, V m)
+		{
+			V const gx = P::sub(P::mul(c(2.0f), fract(P::mul(p, Cw))), c(1.0f));
+			V const h = P::sub(P::abs(gx), c(0.5f));
+			V const a0 = P::sub(gx, P::floor(P::add(gx, c(0.5f))));
+			V const Norm = P::mul(m, P::sub(c(static_cast<float>(1.79284291400159)), P::mul(c(static_cast<float>(0.85373472095314)), P::add(P::mul(a0, a0), P::mul(h, h)))));
+			return P::mul(Norm, P::add(P::mul(a0, x), P::mul(h, y)));
+		}
+
+		GLM_FUNC_QUALIFIER static V simplex(V vx, V vy, V vz)
+		{
+			V const Cx = c(static_cast<float>(1.0 / 6.0));
+			V const Cy = c(static_cast<float>(1.0 / 3.0));
+
+			// First corner
+			V const s = dot(vx, vy, vz, Cy, Cy, Cy);
+			V ix = P::floor(P::add(vx, s));
+			V iy = P::floor(P::add(vy, s));
+			V iz = P::floor(P::add(vz, s));
+			V const t = dot(ix, iy, iz, Cx, Cx, Cx);
+			V const x0x = P::add(P::sub(vx, ix), t);
+			V const x0y = P::add(P::sub(vy, iy), t);
+			V const x0z = P::add(P::sub(vz, iz), t);
+
+			// Other corners
+			V const gx = P::step(x0y, x0x);
+			V const gy = P::step(x0z, x0y);
+			V const gz = P::step(x0x, x0z);
+			V const lx = P::sub(c(1.0f), gx);
+			V const ly = P::sub(c(1.0f), gy);
+			V const lz = P::sub(c(1.0f), gz);
+			V const i1x = P::min(gx, lz);
+			V const i1y = P::min(gy, lx);
+			V const i1z = P::min(gz, ly);
+			V const i2x = P::max(gx, lz);
+			V const i2y = P::max(gy, lx);
+			V const i2z = P::max(gz, ly);
+
+			V const x1x = P::add(P::sub(x0x, i1x), Cx);
+			V const x1y = P::add(P::sub(x0y, i1y), Cx);
+			V const x1z = P::add(P::sub(x0z, i1z), Cx);
+			V const x2x = P::add(P::sub(x0x, i2x), Cy);
+			V const x2y = P::add(P::sub(x0y, i2y), Cy);
+			V const x2z = P::add(P::sub(x0z, i2z), Cy);
+			V const x3x = P::sub(x0x, c(0.5f));
+			V const x3y = P::sub(x0y, c(0.5f));
+			V const x3z = P::sub(x0z, c(0.5f));
+
+			// Permutations
+			ix = mod289(ix);
+			iy = mod289(iy);
+			iz = mod289(iz);
+			V const Zero = c(0.0f);
+			V const One = c(1.0f);
+			V const p0 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, Zero)), iy), Zero)), ix), Zero));
+			V const p1 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, i1z)), iy), i1y)), ix), i1x));
+			V const p2 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, i2z)), iy), i2y)), ix), i2x));
+			V const p3 = permute(P::add(P::add(permute(P::add(P::add(permute(P::add(iz, One)), iy), One)), ix), One));
+
+			V const n0 = simplexCorner(p0, x0x, x0y, x0z);
+			V const n1 = simplexCorner(p1, x1x, x1y, x1z);
+			V const n2 = simplexCorner(p2, x2x, x2y, x2z);
+			V const n3 = simplexCorner(p3, x3x, x3y, x3z);
+			return P::mul(c(42.0f), P::add(P::add(n0, n1), P::add(n2, n3)));
+		}
+
+		// m^4 * dot(gradient, x) of a corner of simplex(vec3)
+		GLM_FUNC_QUALIFIER static V simplexCorner(V p, V x, V y, V z)
+		{
+			V const n_ = c(static_cast<float>(0.142857142857));
+			V const nsx = P::mul(n_, c(2.0f));
+			V const nsy = P::sub(P::mul(n_, c(0.5f)), c(1.0f));
+
+			V const j = P::sub(p, P::mul(c(49.0f), P::floor(P::mul(P::mul(p, n_), n_))));
+			V const x_ = P::floor(P::mul(j, n_));
+			V const y_ = P::floor(P::sub(j, P::mul(c(7.0f), x_)));
+			V const gx = P::add(P::mul(x_, nsx), nsy);
+			V const gy = P::add(P::mul(y_, nsx), nsy);
+			V const h = P::sub(P::sub(c(1.0f), P::abs(gx)), P::abs(gy));
+			V const sh = P::sub(c(0.0f), P::step(h, c(0.0f)));
+			V const ax = P::add(gx, P::mul(P::add(P::mul(P::floor(gx), c(2.0f)), c(1.0f)), sh));
+			V const ay = P::add(gy, P::mul(P::add(P::mul(P::floor(gy), c(2.0f)), c(1.0f)), sh));
+
+			V const norm = taylorInvSqrt(dot(ax, ay, h, ax, ay, h));
+			V m = P::max(P::sub(c(0.6f), dot(x, y, z, x, y, z)), c(0.0f));
+			m = P::mul(m, m);
+			return P::mul(P::mul(m, m), dot(P::mul(ax, norm), P::mul(ay, norm), P::mul(h, norm), x, y, z));
+		}
+	};
+
+	template<typename P, bool Simplex>
+	struct noise_simd
+	{
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x, typename P::type y) { return noise_kernel<P>::perlin(x, y); }
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x, typename P::type y, typename P::type z) { return noise_kernel<P>::perlin(x, y, z); }
+	};
+
+	template<typename P>
+	struct noise_simd<P, true>
+	{
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x, typename P::type y) { return noise_kernel<P>::simplex(x, y); }
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x, typename P::type y, typename P::type z) { return noise_kernel<P>::simplex(x, y, z); }
+	};
+
+#	if defined(GLM_NOISE_SSE2)
+
+	// Out[i] = Amplitude * noise(In[*][i] * Frequency), added to Out[i] when Accumulate
+	template<typename P, length_t L, bool Simplex>
+	GLM_FUNC_QUALIFIER void noise_span_simd(float const* const In[3], std::size_t Count, float Frequency, float Amplitude, bool Accumulate, float* Out)
+	{
+		typedef typename P::type V;
+
+		V const Freq = P::set1(Frequency);
+		V const Amp = P::set1(Amplitude);
+
+		for(std::size_t i = 0; i < Count; i += P::size)
+		{
+			// The last block works on a copy padded with the first point
+			float Block[3][P::size];
+			float Result[P::size];
+			bool const Tail = i + P::size > Count;
+			float const* Src[3] = {In[0] + i, In[1] + i, L > 2 ? In[2] + i : In[1] + i};
+			if(Tail)
+			{
+				for(length_t k = 0; k < L; ++k)
+				for(std::size_t j = 0; j < static_cast<std::size_t>(P::size); ++j)
+					Block[k][j] = i + j < Count ? Src[k][j] : Src[k][0];
+				Src[0] = Block[0];
+				Src[1] = Block[1];
+				Src[2] = L > 2 ? Block[2] : Block[1];
+			}
+
+			V const x = P::mul(P::load(Src[0]), Freq);
+			V const y = P::mul(P::load(Src[1]), Freq);
+			V Noise = L > 2 ?
+				noise_simd<P, Simplex>::call(x, y, P::mul(P::load(Src[2]), Freq)) :
+				noise_simd<P, Simplex>::call(x, y);
+			Noise = P::mul(Amp, Noise);
+
+			float* Dst = Tail ? Result : Out + i;
+			if(Accumulate)
+			{
+				if(Tail)
+					for(std::size_t j = 0; i + j < Count; ++j)
+						Result[j] = Out[i + j];
+				Noise = P::add(P::load(Dst), Noise);
+			}
+			P::store(Dst, Noise);
+
+			if(Tail)
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Out[i + j] = Result[j];
+		}
+	}
+
+	template<length_t L, bool Simplex>
+	GLM_FUNC_QUALIFIER void noise_span(float const* const In[3], std::size_t Count, float Frequency, float Amplitude, bool Accumulate, float* Out)
+	{
+#		if defined(GLM_NOISE_AVX2)
+			noise_span_simd<noise_avx2, L, Simplex>(In, Count, Frequency, Amplitude, Accumulate, Out);
+#		else
+			noise_span_simd<noise_sse2, L, Simplex>(In, Count, Frequency, Amplitude, Accumulate, Out);
+#		endif
+	}
+
+#	endif//defined(GLM_NOISE_SSE2)
+
+	template<length_t L, typename T>
+	struct noise_batch_simd
+	{
+		enum { value = false };
+	};
+
+#	if defined(GLM_NOISE_SSE2)
+	template<>
+	struct noise_batch_simd<2, float>
+	{
+		enum { value = true };
+	};
+
+	template<>
+	struct noise_batch_simd<3, float>
+	{
+		enum { value = true };
+	};
+#	endif
+
+	// Grid rows are the y values, then the z values for a 3D grid
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> noise_grid_row(vec<L, int, Q> const& Size, std::size_t Row)
+	{
+		vec<L, T, Q> Index(static_cast<T>(0));
+		Index[1] = static_cast<T>(Row % static_cast<std::size_t>(Size[1]));
+		if(L > 2)
+			Index[L - 1] = static_cast<T>(Row / static_cast<std::size_t>(Size[1]));
+		return Index;
+	}
+
+	template<length_t L, typename T, qualifier Q, bool Simplex, bool UseSimd = noise_batch_simd<L, T>::value>
+	struct compute_noise_batch
+	{
+		GLM_FUNC_QUALIFIER static T noise(vec<L, T, Q> const& p)
+		{
+			return Simplex ? glm::simplex(p) : glm::perlin(p);
+		}
+
+		GLM_FUNC_QUALIFIER static void points(vec<L, T, Q> const* in, T* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = noise(in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void rows(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, std::size_t first, std::size_t last)
+		{
+			for(std::size_t Row = first; Row < last; ++Row)
+			{
+				vec<L, T, Q> Index = noise_grid_row<L, T, Q>(size, Row);
+				for(int x = 0; x < size.x; ++x)
+				{
+					Index.x = static_cast<T>(x);
+					vec<L, T, Q> const Position = origin + step * Index;
+
+					T Sum = static_cast<T>(0);
+					T Frequency = static_cast<T>(1);
+					T Amplitude = static_cast<T>(1);
+					for(int o = 0; o < octaves; ++o)
+					{
+						Sum += Amplitude * noise(Position * Frequency);
+						Frequency *= lacunarity;
+						Amplitude *= gain;
+					}
+					out[Row * static_cast<std::size_t>(size.x) + static_cast<std::size_t>(x)] = Sum;
+				}
+			}
+		}
+	};
+
+#	if defined(GLM_NOISE_SSE2)
+
+	template<length_t L, qualifier Q, bool Simplex>
+	struct compute_noise_batch<L, float, Q, Simplex, true>
+	{
+		enum { Chunk = 256 };
+
+		GLM_FUNC_QUALIFIER static void points(vec<L, float, Q> const* in, float* out, std::size_t count)
+		{
+			float Coords[3][Chunk];
+			float const* const In[3] = {Coords[0], Coords[1], Coords[2]};
+			for(std::size_t i = 0; i < count; i += Chunk)
+			{
+				std::size_t const Count = count - i < static_cast<std::size_t>(Chunk) ? count - i : static_cast<std::size_t>(Chunk);
+				for(std::size_t j = 0; j < Count; ++j)
+				for(length_t k = 0; k < L; ++k)
+					Coords[k][j] = in[i + j][k];
+				noise_span<L, Simplex>(In, Count, 1.0f, 1.0f, false, out + i);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void rows(vec<L, float, Q> const& origin, vec<L, float, Q> const& step, vec<L, int, Q> const& size, float* out, int octaves, float lacunarity, float gain, std::size_t first, std::size_t last)
+		{
+			float Coords[3][Chunk];
+			float const* const In[3] = {Coords[0], Coords[1], Coords[2]};
+			for(std::size_t Row = first; Row < last; ++Row)
+			{
+				vec<L, float, Q> const Index = noise_grid_row<L, float, Q>(size, Row);
+				std::size_t const Width = static_cast<std::size_t>(size.x);
+				for(std::size_t x = 0; x < Width; x += Chunk)
+				{
+					std::size_t const Count = Width - x < static_cast<std::size_t>(Chunk) ? Width - x : static_cast<std::size_t>(Chunk);
+					for(std::size_t j = 0; j < Count; ++j)
+						Coords[0][j] = origin.x + step.x * static_cast<float>(x + j);
+					for(length_t k = 1; k < L; ++k)
+					for(std::size_t j = 0; j < Count; ++j)
+						Coords[k][j] = origin[k] + step[k] * Index[k];
+
+					float* const Out = out + Row * Width + x;
+					float Frequency = 1.0f;
+					float Amplitude = 1.0f;
+					for(int o = 0; o < octaves; ++o)
+					{
+						noise_span<L, Simplex>(In, Count, Frequency, Amplitude, o > 0, Out);
+						Frequency *= lacunarity;
+						Amplitude *= gain;
+					}
+					if(octaves <= 0)
+						for(std::size_t j = 0; j < Count; ++j)
+							Out[j] = 0.0f;
+				}
+			}
+		}
+	};
+
+#	endif//defined(GLM_NOISE_SSE2)
+
+	template<length_t L, typename T, qualifier Q, bool Simplex>
+	GLM_FUNC_QUALIFIER void noise_grid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, unsigned threads)
+	{
+		GLM_STATIC_ASSERT(L == 2 || L == 3, "'perlinGrid' and 'simplexGrid' only accept 2D and 3D grids");
+
+		typedef compute_noise_batch<L, T, Q, Simplex> compute;
+
+		// a negative extent would wrap to a huge row count once converted, empty grids write nothing
+		if(size.x <= 0 || size.y <= 0 || (L > 2 && size[L - 1] <= 0))
+			return;
+
+		std::size_t Rows = static_cast<std::size_t>(size[1]);
+		if(L > 2)
+			Rows *= static_cast<std::size_t>(size[L - 1]);
+
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			if(threads > 1 && Rows > 1)
+			{
+				std::size_t const Count = threads < Rows ? threads : Rows;
+				std::vector<std::thread> Workers;
+				for(std::size_t t = 1; t < Count; ++t)
+					Workers.push_back(std::thread(&compute::rows, origin, step, size, out, octaves, lacunarity, gain, Rows * t / Count, Rows * (t + 1) / Count));
+				compute::rows(origin, step, size, out, octaves, lacunarity, gain, 0, Rows / Count);
+				for(std::size_t t = 0; t < Workers.size(); ++t)
+					Workers[t].join();
+				return;
+			}
+#		else
+			(void)threads;
+#		endif
+
+		compute::rows(origin, step, size, out, octaves, lacunarity, gain, 0, Rows);
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, T, Q> const* in, T* out, std::size_t count)
+	{
+		detail::compute_noise_batch<L, T, Q, false>::points(in, out, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<L, T, Q> const* in, T* out, std::size_t count)
+	{
+		detail::compute_noise_batch<L, T, Q, true>::points(in, out, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, unsigned threads)
+	{
+		detail::noise_grid<L, T, Q, false>(origin, step, size, out, octaves, lacunarity, gain, threads);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, unsigned threads)
+	{
+		detail::noise_grid<L, T, Q, true>(origin, step, size, out, octaves, lacunarity, gain, threads);
+	}
+}//namespace glm
@@ -512,6 +512,21 @@ namespace glm
 	template<length_t L, qualifier Q>
 	GLM_FUNC_DECL vec<L, float, Q> unpackHalf(vec<L, uint16, Q> const& p);
 
+	/// Converts Count floating-point values from In to 16-bit floating-point values stored in Out,
+	/// rounding to nearest even like packHalf1x16.
+	/// Uses F16C when the compiler targets it, SSE2 or AVX2 integer code otherwise, with GLM_FORCE_INTRINSICS.
+	/// All paths produce the same bits.
+	///
+	/// @see gtc_packing
+	/// @see void unpackHalf(uint16 const* In, float* Out, std::size_t Count)
+	GLM_FUNC_DECL void packHalf(float const* In, uint16* Out, std::size_t Count);
+
+	/// Converts Count 16-bit floating-point values from In to 32-bit floating-point values stored in Out.
+	///
+	/// @see gtc_packing
+	/// @see void packHalf(float const* In, uint16* Out, std::size_t Count)
+	GLM_FUNC_DECL void unpackHalf(uint16 const* In, float* Out, std::size_t Count);
+
 	/// Convert each component of the normalized floating-point vector into unsigned integer values.
 	///
 	/// @see gtc_packing
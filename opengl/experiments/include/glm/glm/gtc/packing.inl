@@ -7,6 +7,7 @@
 #include "../vec3.hpp"
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
+#include "../packing.hpp"
 #include <cstring>
 #include <limits>
 
@@ -475,40 +476,58 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint16 packHalf1x16(float v)
 	{
-		int16 const Topack(detail::toFloat16(v));
-		uint16 Packed = 0;
-		memcpy(&Packed, &Topack, sizeof(Packed));
-		return Packed;
+#		if defined(GLM_PACKING_HALF_SIMD)
+			return static_cast<uint16>(_mm_cvtsi128_si32(detail::packHalf4(_mm_set_ss(v))));
+#		else
+			int16 const Topack(detail::toFloat16(v));
+			uint16 Packed = 0;
+			memcpy(&Packed, &Topack, sizeof(Packed));
+			return Packed;
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER float unpackHalf1x16(uint16 v)
 	{
-		int16 Unpack = 0;
-		memcpy(&Unpack, &v, sizeof(Unpack));
-		return detail::toFloat32(Unpack);
+#		if defined(GLM_PACKING_HALF_SIMD)
+			return _mm_cvtss_f32(detail::unpackHalf4(_mm_cvtsi32_si128(v)));
+#		else
+			int16 Unpack = 0;
+			memcpy(&Unpack, &v, sizeof(Unpack));
+			return detail::toFloat32(Unpack);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const& v)
 	{
-		i16vec4 const Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
 		uint64 Packed = 0;
-		memcpy(&Packed, &Unpack, sizeof(Packed));
+#		if defined(GLM_PACKING_HALF_SIMD)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), detail::packHalf4(_mm_setr_ps(v.x, v.y, v.z, v.w)));
+#		else
+			i16vec4 const Unpack(
+				detail::toFloat16(v.x),
+				detail::toFloat16(v.y),
+				detail::toFloat16(v.z),
+				detail::toFloat16(v.w));
+			memcpy(&Packed, &Unpack, sizeof(Packed));
+#		endif
 		return Packed;
 	}
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack;
-		memcpy(&Unpack, &v, sizeof(Unpack));
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+#		if defined(GLM_PACKING_HALF_SIMD)
+			vec4 Result;
+			_mm_storeu_ps(&Result[0], detail::unpackHalf4(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v))));
+			return Result;
+#		else
+			i16vec4 Unpack;
+			memcpy(&Unpack, &v, sizeof(Unpack));
+			return vec4(
+				detail::toFloat32(Unpack.x),
+				detail::toFloat32(Unpack.y),
+				detail::toFloat32(Unpack.z),
+				detail::toFloat32(Unpack.w));
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const& v)
@@ -668,6 +687,26 @@ namespace detail
 		return detail::compute_half<L, Q>::unpack(v);
 	}
 
+	GLM_FUNC_QUALIFIER void packHalf(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if defined(GLM_PACKING_HALF_SIMD)
+			i = detail::packHalfArray(In, Out, Count);
+#		endif
+		for(; i < Count; ++i)
+			Out[i] = packHalf1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if defined(GLM_PACKING_HALF_SIMD)
+			i = detail::unpackHalfArray(In, Out, Count);
+#		endif
+		for(; i < Count; ++i)
+			Out[i] = unpackHalf1x16(In[i]);
+	}
+
 	template<typename uintType, length_t L, typename floatType, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uintType, Q> packUnorm(vec<L, floatType, Q> const& v)
 	{
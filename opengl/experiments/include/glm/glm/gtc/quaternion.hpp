@@ -10,6 +10,12 @@
 /// Include <glm/gtc/quaternion.hpp> to use the features of this extension.
 ///
 /// Defines a templated quaternion type and several quaternion operations.
+///
+/// The batch functions work on arrays of quaternions stored as four streams of
+/// x, y, z and w components, as skeletal animation keeps its joints. With
+/// GLM_FORCE_INTRINSICS they process float streams four at a time with SSE2 and
+/// eight at a time with AVX2. Output streams may be input streams but must not
+/// otherwise overlap them.
 
 #pragma once
 
@@ -30,6 +36,7 @@
 #include "../detail/type_mat4x4.hpp"
 #include "../detail/type_vec3.hpp"
 #include "../detail/type_vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_quaternion extension included")
@@ -167,6 +174,44 @@ namespace glm
 	GLM_FUNC_DECL qua<T, Q> quatLookAtLH(
 		vec<3, T, Q> const& direction,
 		vec<3, T, Q> const& up);
+
+	/// Normalized linear interpolation along the shortest path of count quaternions stored as
+	/// x, y, z and w streams: out[i] = normalize(lerp(x[i], dot(x[i], y[i]) < 0 ? -y[i] : y[i], a)).
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T>
+	GLM_FUNC_DECL void nlerp(T const* const x[4], T const* const y[4], T a, T* const out[4], std::size_t count);
+
+	/// Spherical linear interpolation along the shortest path of count quaternions stored as
+	/// x, y, z and w streams: out[i] = slerp(x[i], y[i], a).
+	///
+	/// The SIMD path approximates acos and sin with polynomials, for a in [0, 1] its results stay within 1e-6 of slerp.
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T>
+	GLM_FUNC_DECL void slerp(T const* const x[4], T const* const y[4], T a, T* const out[4], std::size_t count);
+
+	/// Rotates count vectors stored as x, y and z streams by count quaternions stored as
+	/// x, y, z and w streams: out[i] = q[i] * v[i].
+	///
+	/// @tparam T Floating-point scalar types.
+	///
+	/// @see gtc_quaternion
+	template<typename T>
+	GLM_FUNC_DECL void rotate(T const* const q[4], T const* const v[3], T* const out[3], std::size_t count);
+
+	/// Converts count quaternions stored as x, y, z and w streams: out[i] = mat4_cast(q[i]).
+	///
+	/// @tparam T Floating-point scalar types.
+	/// @tparam Q A value from qualifier enum
+	///
+	/// @see gtc_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat4_cast(T const* const q[4], mat<4, 4, T, Q>* out, std::size_t count);
 	/// @}
 } //namespace glm
 
@@ -194,6 +194,94 @@ namespace glm
 
 		return quat_cast(Result);
 	}
+
+namespace detail
+{
+	template<typename T>
+	struct compute_quat_batch_simd
+	{
+		enum { value = false };
+	};
+
+	template<typename T, bool UseSimd = compute_quat_batch_simd<T>::value>
+	struct compute_quat_batch
+	{
+		GLM_FUNC_QUALIFIER static qua<T, defaultp> load(T const* const q[4], std::size_t i)
+		{
+			return qua<T, defaultp>(q[3][i], q[0][i], q[1][i], q[2][i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T* const out[4], std::size_t i, qua<T, defaultp> const& q)
+		{
+			out[0][i] = q.x;
+			out[1][i] = q.y;
+			out[2][i] = q.z;
+			out[3][i] = q.w;
+		}
+
+		GLM_FUNC_QUALIFIER static void nlerp(T const* const x[4], T const* const y[4], T a, T* const out[4], std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				qua<T, defaultp> const X = load(x, i);
+				qua<T, defaultp> const Y = load(y, i);
+				store(out, i, normalize(lerp(X, dot(X, Y) < static_cast<T>(0) ? -Y : Y, a)));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(T const* const x[4], T const* const y[4], T a, T* const out[4], std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				store(out, i, glm::slerp(load(x, i), load(y, i), a));
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate(T const* const q[4], T const* const v[3], T* const out[3], std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<3, T, defaultp> const Result = load(q, i) * vec<3, T, defaultp>(v[0][i], v[1][i], v[2][i]);
+				out[0][i] = Result.x;
+				out[1][i] = Result.y;
+				out[2][i] = Result.z;
+			}
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void mat4_cast(T const* const q[4], mat<4, 4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::mat4_cast(qua<T, Q>(load(q, i)));
+		}
+	};
+}//namespace detail
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void nlerp(T const* const x[4], T const* const y[4], T a, T* const out[4], std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'nlerp' only accept floating-point inputs");
+		detail::compute_quat_batch<T>::nlerp(x, y, a, out, count);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void slerp(T const* const x[4], T const* const y[4], T a, T* const out[4], std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'slerp' only accept floating-point inputs");
+		detail::compute_quat_batch<T>::slerp(x, y, a, out, count);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void rotate(T const* const q[4], T const* const v[3], T* const out[3], std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'rotate' only accept floating-point inputs");
+		detail::compute_quat_batch<T>::rotate(q, v, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4_cast(T const* const q[4], mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mat4_cast' only accept floating-point inputs");
+		detail::compute_quat_batch<T>::mat4_cast(q, out, count);
+	}
 }//namespace glm
 
 #if GLM_CONFIG_SIMD == GLM_ENABLE
@@ -0,0 +1,367 @@
+/// @ref gtc_quaternion
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	template<>
+	struct compute_quat_batch_simd<float>
+	{
+		enum { value = true };
+	};
+
+	struct quat_batch_sse2
+	{
+		typedef __m128 type;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm_storeu_ps(p, x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type x) { return _mm_sqrt_ps(x); }
+		GLM_FUNC_QUALIFIER static type less(type a, type b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type lessEqual(type a, type b) { return _mm_cmple_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return _mm_cmpgt_ps(a, b); }
+
+		// Lanes of a where Mask is set, lanes of b elsewhere
+		GLM_FUNC_QUALIFIER static type select(type Mask, type a, type b) { return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b)); }
+
+		// -x where Mask is set, x elsewhere
+		GLM_FUNC_QUALIFIER static type negate(type Mask, type x) { return _mm_xor_ps(x, _mm_and_ps(Mask, _mm_set1_ps(-0.0f))); }
+
+		// Col[c][r] holds row r of column c for each lane, each lane is stored as one mat4 from Out + Lane * 16
+		GLM_FUNC_QUALIFIER static void storeMat4(float* Out, type Col[4][4])
+		{
+			for(length_t c = 0; c < 4; ++c)
+			{
+				_MM_TRANSPOSE4_PS(Col[c][0], Col[c][1], Col[c][2], Col[c][3]);
+				for(length_t l = 0; l < 4; ++l)
+					_mm_storeu_ps(Out + l * 16 + c * 4, Col[c][l]);
+			}
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	struct quat_batch_avx2
+	{
+		typedef __m256 type;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm256_storeu_ps(p, x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type x) { return _mm256_sqrt_ps(x); }
+		GLM_FUNC_QUALIFIER static type less(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static type lessEqual(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static type select(type Mask, type a, type b) { return _mm256_blendv_ps(b, a, Mask); }
+		GLM_FUNC_QUALIFIER static type negate(type Mask, type x) { return _mm256_xor_ps(x, _mm256_and_ps(Mask, _mm256_set1_ps(-0.0f))); }
+
+		// 4x4 transposes within each 128-bit lane, the low lanes hold the matrices 0 to 3 and the high lanes 4 to 7
+		GLM_FUNC_QUALIFIER static void storeMat4(float* Out, type Col[4][4])
+		{
+			for(length_t c = 0; c < 4; ++c)
+			{
+				__m256 const T0 = _mm256_unpacklo_ps(Col[c][0], Col[c][1]);
+				__m256 const T1 = _mm256_unpacklo_ps(Col[c][2], Col[c][3]);
+				__m256 const T2 = _mm256_unpackhi_ps(Col[c][0], Col[c][1]);
+				__m256 const T3 = _mm256_unpackhi_ps(Col[c][2], Col[c][3]);
+				__m256 const Lane[4] = {
+					_mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0)),
+					_mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2)),
+					_mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0)),
+					_mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2))};
+				for(length_t l = 0; l < 4; ++l)
+				{
+					_mm_storeu_ps(Out + l * 16 + c * 4, _mm256_castps256_ps128(Lane[l]));
+					_mm_storeu_ps(Out + (l + 4) * 16 + c * 4, _mm256_extractf128_ps(Lane[l], 1));
+				}
+			}
+		}
+	};
+
+	typedef quat_batch_avx2 quat_batch_pack;
+
+#	else
+
+	typedef quat_batch_sse2 quat_batch_pack;
+
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// The kernels take the x, y, z and w streams of each quaternion and evaluate the
+	// expressions of the scalar functions in the same order
+
+	template<typename P>
+	GLM_FUNC_QUALIFIER typename P::type quat_batch_dot(typename P::type const* a, typename P::type const* b)
+	{
+		typename P::type const XX = P::mul(a[0], b[0]);
+		typename P::type const YY = P::mul(a[1], b[1]);
+		typename P::type const ZZ = P::mul(a[2], b[2]);
+		typename P::type const WW = P::mul(a[3], b[3]);
+		return P::add(P::add(WW, XX), P::add(YY, ZZ));
+	}
+
+	// Abramowitz and Stegun 4.4.46 for x in [0, 1], absolute error below 2e-8 before rounding
+	template<typename P>
+	GLM_FUNC_QUALIFIER typename P::type quat_batch_acos(typename P::type x)
+	{
+		typename P::type Poly = P::set1(-0.0012624911f);
+		Poly = P::add(P::mul(Poly, x), P::set1(0.0066700901f));
+		Poly = P::add(P::mul(Poly, x), P::set1(-0.0170881256f));
+		Poly = P::add(P::mul(Poly, x), P::set1(0.0308918810f));
+		Poly = P::add(P::mul(Poly, x), P::set1(-0.0501743046f));
+		Poly = P::add(P::mul(Poly, x), P::set1(0.0889789874f));
+		Poly = P::add(P::mul(Poly, x), P::set1(-0.2145988016f));
+		Poly = P::add(P::mul(Poly, x), P::set1(1.5707963050f));
+		return P::mul(P::sqrt(P::max(P::sub(P::set1(1.0f), x), P::set1(0.0f))), Poly);
+	}
+
+	// Taylor series to x^11, for x in [0, pi / 2] the error is below 6e-8
+	template<typename P>
+	GLM_FUNC_QUALIFIER typename P::type quat_batch_sin(typename P::type x)
+	{
+		typename P::type const x2 = P::mul(x, x);
+		typename P::type Poly = P::set1(-2.5052108e-8f);
+		Poly = P::add(P::mul(Poly, x2), P::set1(2.7557319e-6f));
+		Poly = P::add(P::mul(Poly, x2), P::set1(-1.9841270e-4f));
+		Poly = P::add(P::mul(Poly, x2), P::set1(8.3333333e-3f));
+		Poly = P::add(P::mul(Poly, x2), P::set1(-1.6666667e-1f));
+		Poly = P::add(P::mul(Poly, x2), P::set1(1.0f));
+		return P::mul(x, Poly);
+	}
+
+	template<typename P>
+	struct quat_batch_nlerp
+	{
+		typedef typename P::type type;
+		enum { inputs = 8, outputs = 4 };
+
+		type A, OneMinusA;
+
+		GLM_FUNC_QUALIFIER explicit quat_batch_nlerp(float a) :
+			A(P::set1(a)), OneMinusA(P::set1(1.0f - a))
+		{}
+
+		GLM_FUNC_QUALIFIER void operator()(type const* In, type* Out) const
+		{
+			type const* X = In;
+			type const* Y = In + 4;
+
+			type const Negate = P::less(quat_batch_dot<P>(X, Y), P::set1(0.0f));
+			type Lerp[4];
+			for(length_t k = 0; k < 4; ++k)
+				Lerp[k] = P::add(P::mul(X[k], OneMinusA), P::mul(P::negate(Negate, Y[k]), A));
+
+			type const Length = P::sqrt(quat_batch_dot<P>(Lerp, Lerp));
+			type const Zero = P::lessEqual(Length, P::set1(0.0f));
+			type const OneOverLength = P::div(P::set1(1.0f), Length);
+			for(length_t k = 0; k < 4; ++k)
+				Out[k] = P::select(Zero, P::set1(k == 3 ? 1.0f : 0.0f), P::mul(Lerp[k], OneOverLength));
+		}
+	};
+
+	template<typename P>
+	struct quat_batch_slerp
+	{
+		typedef typename P::type type;
+		enum { inputs = 8, outputs = 4 };
+
+		type A, OneMinusA;
+
+		GLM_FUNC_QUALIFIER explicit quat_batch_slerp(float a) :
+			A(P::set1(a)), OneMinusA(P::set1(1.0f - a))
+		{}
+
+		GLM_FUNC_QUALIFIER void operator()(type const* In, type* Out) const
+		{
+			type const* X = In;
+			type const* Y = In + 4;
+
+			type CosTheta = quat_batch_dot<P>(X, Y);
+			type const Negate = P::less(CosTheta, P::set1(0.0f));
+			CosTheta = P::negate(Negate, CosTheta);
+
+			type Z[4];
+			for(length_t k = 0; k < 4; ++k)
+				Z[k] = P::negate(Negate, Y[k]);
+
+			type const Linear = P::greater(CosTheta, P::set1(1.0f - epsilon<float>()));
+			type const Angle = quat_batch_acos<P>(CosTheta);
+			type const Sin0 = quat_batch_sin<P>(P::mul(OneMinusA, Angle));
+			type const Sin1 = quat_batch_sin<P>(P::mul(A, Angle));
+			type const SinAngle = quat_batch_sin<P>(Angle);
+
+			for(length_t k = 0; k < 4; ++k)
+			{
+				type const Mix = P::add(P::mul(X[k], OneMinusA), P::mul(Z[k], A));
+				type const Slerp = P::div(P::add(P::mul(X[k], Sin0), P::mul(Z[k], Sin1)), SinAngle);
+				Out[k] = P::select(Linear, Mix, Slerp);
+			}
+		}
+	};
+
+	template<typename P>
+	struct quat_batch_rotate
+	{
+		typedef typename P::type type;
+		enum { inputs = 7, outputs = 3 };
+
+		// cross(a, b) with the terms of glm::cross
+		GLM_FUNC_QUALIFIER static void cross(type const* a, type const* b, type* Result)
+		{
+			Result[0] = P::sub(P::mul(a[1], b[2]), P::mul(b[1], a[2]));
+			Result[1] = P::sub(P::mul(a[2], b[0]), P::mul(b[2], a[0]));
+			Result[2] = P::sub(P::mul(a[0], b[1]), P::mul(b[0], a[1]));
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(type const* In, type* Out) const
+		{
+			type const* Q = In;
+			type const* V = In + 4;
+
+			type UV[3], UUV[3];
+			cross(Q, V, UV);
+			cross(Q, UV, UUV);
+
+			type const Two = P::set1(2.0f);
+			for(length_t k = 0; k < 3; ++k)
+				Out[k] = P::add(V[k], P::mul(P::add(P::mul(UV[k], Q[3]), UUV[k]), Two));
+		}
+	};
+
+	// Loads kernel::inputs streams, writes kernel::outputs streams, the last partial block
+	// goes through a zero padded copy
+	template<typename P, typename kernel>
+	GLM_FUNC_QUALIFIER void quat_batch_streams(kernel const& Kernel, float const* const* In, float* const* Out, std::size_t Count)
+	{
+		typename P::type Src[kernel::inputs], Dst[kernel::outputs];
+
+		std::size_t i = 0;
+		for(; i + P::size <= Count; i += P::size)
+		{
+			for(length_t k = 0; k < kernel::inputs; ++k)
+				Src[k] = P::load(In[k] + i);
+			Kernel(Src, Dst);
+			for(length_t k = 0; k < kernel::outputs; ++k)
+				P::store(Out[k] + i, Dst[k]);
+		}
+
+		if(i < Count)
+		{
+			float Tail[kernel::inputs][P::size];
+			std::memset(Tail, 0, sizeof(Tail));
+			for(length_t k = 0; k < kernel::inputs; ++k)
+			{
+				std::memcpy(Tail[k], In[k] + i, (Count - i) * sizeof(float));
+				Src[k] = P::load(Tail[k]);
+			}
+			Kernel(Src, Dst);
+			for(length_t k = 0; k < kernel::outputs; ++k)
+			{
+				P::store(Tail[k], Dst[k]);
+				std::memcpy(Out[k] + i, Tail[k], (Count - i) * sizeof(float));
+			}
+		}
+	}
+
+	template<typename P>
+	GLM_FUNC_QUALIFIER void quat_batch_mat4_block(typename P::type const* Q, float* Out)
+	{
+		typedef typename P::type type;
+
+		type const QXX = P::mul(Q[0], Q[0]);
+		type const QYY = P::mul(Q[1], Q[1]);
+		type const QZZ = P::mul(Q[2], Q[2]);
+		type const QXZ = P::mul(Q[0], Q[2]);
+		type const QXY = P::mul(Q[0], Q[1]);
+		type const QYZ = P::mul(Q[1], Q[2]);
+		type const QWX = P::mul(Q[3], Q[0]);
+		type const QWY = P::mul(Q[3], Q[1]);
+		type const QWZ = P::mul(Q[3], Q[2]);
+
+		type const Zero = P::set1(0.0f);
+		type const One = P::set1(1.0f);
+		type const Two = P::set1(2.0f);
+
+		type Col[4][4] = {
+			{P::sub(One, P::mul(Two, P::add(QYY, QZZ))), P::mul(Two, P::add(QXY, QWZ)), P::mul(Two, P::sub(QXZ, QWY)), Zero},
+			{P::mul(Two, P::sub(QXY, QWZ)), P::sub(One, P::mul(Two, P::add(QXX, QZZ))), P::mul(Two, P::add(QYZ, QWX)), Zero},
+			{P::mul(Two, P::add(QXZ, QWY)), P::mul(Two, P::sub(QYZ, QWX)), P::sub(One, P::mul(Two, P::add(QXX, QYY))), Zero},
+			{Zero, Zero, Zero, One}};
+		P::storeMat4(Out, Col);
+	}
+
+	template<typename P>
+	GLM_FUNC_QUALIFIER void quat_batch_mat4(float const* const In[4], float* Out, std::size_t Count)
+	{
+		typename P::type Q[4];
+
+		std::size_t i = 0;
+		for(; i + P::size <= Count; i += P::size)
+		{
+			for(length_t k = 0; k < 4; ++k)
+				Q[k] = P::load(In[k] + i);
+			quat_batch_mat4_block<P>(Q, Out + i * 16);
+		}
+
+		if(i < Count)
+		{
+			float Tail[4][P::size];
+			float Mat[P::size * 16];
+			std::memset(Tail, 0, sizeof(Tail));
+			for(length_t k = 0; k < 4; ++k)
+			{
+				std::memcpy(Tail[k], In[k] + i, (Count - i) * sizeof(float));
+				Q[k] = P::load(Tail[k]);
+			}
+			quat_batch_mat4_block<P>(Q, Mat);
+			std::memcpy(Out + i * 16, Mat, (Count - i) * 16 * sizeof(float));
+		}
+	}
+
+	template<>
+	struct compute_quat_batch<float, true>
+	{
+		GLM_FUNC_QUALIFIER static void nlerp(float const* const x[4], float const* const y[4], float a, float* const out[4], std::size_t count)
+		{
+			float const* const In[8] = {x[0], x[1], x[2], x[3], y[0], y[1], y[2], y[3]};
+			quat_batch_streams<quat_batch_pack>(quat_batch_nlerp<quat_batch_pack>(a), In, out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(float const* const x[4], float const* const y[4], float a, float* const out[4], std::size_t count)
+		{
+			float const* const In[8] = {x[0], x[1], x[2], x[3], y[0], y[1], y[2], y[3]};
+			quat_batch_streams<quat_batch_pack>(quat_batch_slerp<quat_batch_pack>(a), In, out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate(float const* const q[4], float const* const v[3], float* const out[3], std::size_t count)
+		{
+			float const* const In[7] = {q[0], q[1], q[2], q[3], v[0], v[1], v[2]};
+			quat_batch_streams<quat_batch_pack>(quat_batch_rotate<quat_batch_pack>(), In, out, count);
+		}
+
+		// mat4 of any qualifier are 16 floats, aligned ones included
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void mat4_cast(float const* const q[4], mat<4, 4, float, Q>* out, std::size_t count)
+		{
+			quat_batch_mat4<quat_batch_pack>(q, reinterpret_cast<float*>(out), count);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
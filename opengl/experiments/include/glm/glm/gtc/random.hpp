@@ -10,6 +10,16 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// The functions without an engine argument draw from std::rand(), which shares a
+/// global state and, on most C libraries, a lock between threads. Every function
+/// also takes an optional engine as last argument, for instance one xoshiro256pp per
+/// thread or per object, and fillLinearRand and fillSphericalRand generate whole
+/// arrays of samples, with SIMD when the engine is a xoshiro256pp_x4.
+///
+/// An engine is any type with an operator() returning uniformly distributed unsigned
+/// integers over [0, 2^32 - 1] or [0, 2^64 - 1] and a static max(), like
+/// std::mt19937 and std::mt19937_64.
 
 #pragma once
 
@@ -17,6 +27,7 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -76,6 +87,140 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// xoshiro256++ pseudo random number generator, 256 bits of state and a period of 2^256 - 1.
+	///
+	/// An engine is not thread safe: give each thread its own, seeded differently or
+	/// copied from a common engine and advanced with jump().
+	///
+	/// @see gtc_random
+	struct xoshiro256pp
+	{
+		typedef uint64 result_type;
+
+		/// Seed the state with splitmix64, any seed including 0 is valid.
+		GLM_FUNC_DECL explicit xoshiro256pp(uint64 Seed = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		GLM_FUNC_DECL static result_type min();
+		GLM_FUNC_DECL static result_type max();
+
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Advance the state by 2^128 steps, 2^128 non-overlapping sequences for parallel computations.
+		GLM_FUNC_DECL void jump();
+
+		/// Advance the state by 2^192 steps, 2^64 starting points each separated by 2^64 jump().
+		GLM_FUNC_DECL void long_jump();
+
+		uint64 State[4];
+	};
+
+	/// Four xoshiro256++ lanes, separated by jump(), stepped together to generate arrays of samples with SIMD.
+	///
+	/// operator() returns the four lanes of a step in turn so that the engine works
+	/// with every function of this extension. fillLinearRand and fillSphericalRand
+	/// step the lanes directly and use 24 bits of each 32 bits half of a result.
+	///
+	/// @see gtc_random
+	struct xoshiro256pp_x4
+	{
+		typedef uint64 result_type;
+
+		GLM_FUNC_DECL explicit xoshiro256pp_x4(uint64 Seed = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		GLM_FUNC_DECL static result_type min();
+		GLM_FUNC_DECL static result_type max();
+
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Step the four lanes and return their results
+		GLM_FUNC_DECL void next(uint64 Out[4]);
+
+		/// Advance each lane by 2^192 steps, for an engine per thread copied from a common one.
+		GLM_FUNC_DECL void long_jump();
+
+		/// State words of the lanes, State[Word][Lane]
+		uint64 State[4][4];
+		uint64 Buffer[4];
+		length_t Cursor;
+	};
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution, using Engine
+	///
+	/// Integer values are within [Min, Max], floating point values within [Min, Max).
+	///
+	/// @see gtc_random
+	template<typename genType, typename engineType>
+	GLM_FUNC_DECL genType linearRand(genType Min, genType Max, engineType& Engine);
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution, using Engine
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename engineType>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engineType& Engine);
+
+	/// Generate random numbers according a gaussian distribution, using Engine
+	///
+	/// @see gtc_random
+	template<typename genType, typename engineType>
+	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation, engineType& Engine);
+
+	/// Generate random numbers according a gaussian distribution, using Engine
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename engineType>
+	GLM_FUNC_DECL vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, engineType& Engine);
+
+	/// Generate a random 2D vector which coordinates are regulary distributed on a circle of a given radius, using Engine
+	///
+	/// @see gtc_random
+	template<typename T, typename engineType>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius, engineType& Engine);
+
+	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius, using Engine
+	///
+	/// @see gtc_random
+	template<typename T, typename engineType>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius, engineType& Engine);
+
+	/// Generate a random 2D vector which coordinates are regulary distributed within the area of a disk of a given radius, using Engine
+	///
+	/// @see gtc_random
+	template<typename T, typename engineType>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius, engineType& Engine);
+
+	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius, using Engine
+	///
+	/// @see gtc_random
+	template<typename T, typename engineType>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius, engineType& Engine);
+
+	/// Write Count random numbers of the interval [Min, Max] to Out, according a linear distribution
+	///
+	/// @see gtc_random
+	template<typename T, typename engineType>
+	GLM_FUNC_DECL void fillLinearRand(T* Out, std::size_t Count, T Min, T Max, engineType& Engine);
+
+	/// Write Count random floats of the interval [Min, Max) to Out, eight per step of the engine lanes
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void fillLinearRand(float* Out, std::size_t Count, float Min, float Max, xoshiro256pp_x4& Engine);
+
+	/// Write Count random 3D vectors regulary distributed on a sphere of a given radius to Out
+	///
+	/// @see gtc_random
+	template<typename T, qualifier Q, typename engineType>
+	GLM_FUNC_DECL void fillSphericalRand(vec<3, T, Q>* Out, std::size_t Count, T Radius, engineType& Engine);
+
+	/// Write Count random 3D vectors regulary distributed on a sphere of a given radius to Out, four per step of the engine lanes
+	///
+	/// @see gtc_random
+	template<qualifier Q>
+	GLM_FUNC_DECL void fillSphericalRand(vec<3, float, Q>* Out, std::size_t Count, float Radius, xoshiro256pp_x4& Engine);
+
 	/// @}
 }//namespace glm
 
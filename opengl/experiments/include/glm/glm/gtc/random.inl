@@ -6,6 +6,12 @@
 #include <ctime>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <limits>
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#	include "../simd/trigonometric.h"
+#endif
 
 namespace glm{
 namespace detail
@@ -199,6 +205,182 @@ namespace detail
 			return vec<L, long double, Q>(compute_rand<L, uint64, Q>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
 		}
 	};
+
+	GLM_FUNC_QUALIFIER uint64 rotl(uint64 x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& x)
+	{
+		x += static_cast<uint64>(0x9E3779B97F4A7C15ull);
+		uint64 z = x;
+		z = (z ^ (z >> 30)) * static_cast<uint64>(0xBF58476D1CE4E5B9ull);
+		z = (z ^ (z >> 27)) * static_cast<uint64>(0x94D049BB133111EBull);
+		return z ^ (z >> 31);
+	}
+
+	GLM_FUNC_QUALIFIER uint64 xoshiro256pp_next(uint64& s0, uint64& s1, uint64& s2, uint64& s3)
+	{
+		uint64 const Result = rotl(s0 + s3, 23) + s0;
+		uint64 const t = s1 << 17;
+
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = rotl(s3, 45);
+
+		return Result;
+	}
+
+	// Advance the state by the jump polynomial Poly
+	GLM_FUNC_QUALIFIER void xoshiro256pp_jump(uint64 State[4], uint64 const Poly[4])
+	{
+		uint64 Jump[4] = {0, 0, 0, 0};
+		for(length_t i = 0; i < 4; ++i)
+		for(int b = 0; b < 64; ++b)
+		{
+			if(Poly[i] & (static_cast<uint64>(1) << b))
+			{
+				Jump[0] ^= State[0];
+				Jump[1] ^= State[1];
+				Jump[2] ^= State[2];
+				Jump[3] ^= State[3];
+			}
+			xoshiro256pp_next(State[0], State[1], State[2], State[3]);
+		}
+		std::memcpy(State, Jump, sizeof(Jump));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 const* xoshiro256pp_jump_poly()
+	{
+		static uint64 const Poly[4] = {
+			static_cast<uint64>(0x180EC6D33CFD0ABAull), static_cast<uint64>(0xD5A61266F0C9392Cull),
+			static_cast<uint64>(0xA9582618E03FC9AAull), static_cast<uint64>(0x39ABDC4529B1661Cull)};
+		return Poly;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 const* xoshiro256pp_long_jump_poly()
+	{
+		static uint64 const Poly[4] = {
+			static_cast<uint64>(0x76E15D3EFEFDCBBFull), static_cast<uint64>(0xC5004E441C522FB3ull),
+			static_cast<uint64>(0x77710069854EE241ull), static_cast<uint64>(0x39109BB02ACBE635ull)};
+		return Poly;
+	}
+
+	// 32 and 64 random bits from engines returning 32 or 64 bits per call, 32 bits are the high half of a 64 bits result
+	template<typename engineType>
+	GLM_FUNC_QUALIFIER uint32 engine_uint32(engineType& Engine)
+	{
+		if(static_cast<uint64>(engineType::max()) > static_cast<uint64>(std::numeric_limits<uint32>::max()))
+			return static_cast<uint32>(static_cast<uint64>(Engine()) >> 32);
+		return static_cast<uint32>(Engine());
+	}
+
+	template<typename engineType>
+	GLM_FUNC_QUALIFIER uint64 engine_uint64(engineType& Engine)
+	{
+		if(static_cast<uint64>(engineType::max()) > static_cast<uint64>(std::numeric_limits<uint32>::max()))
+			return static_cast<uint64>(Engine());
+		uint64 const High = static_cast<uint64>(static_cast<uint32>(Engine()));
+		return (High << 32) | static_cast<uint64>(static_cast<uint32>(Engine()));
+	}
+
+	template<typename T, bool isFloat = std::numeric_limits<T>::is_iec559>
+	struct compute_engine_linearRand
+	{
+		template<typename engineType>
+		GLM_FUNC_QUALIFIER static T call(T Min, T Max, engineType& Engine)
+		{
+			// Modular arithmetic on 64 bits covers the signed and unsigned ranges, Range is 0 for the full 64 bits range
+			uint64 const Range = static_cast<uint64>(Max) - static_cast<uint64>(Min) + static_cast<uint64>(1);
+			if(Range == static_cast<uint64>(0))
+				return static_cast<T>(static_cast<uint64>(Min) + engine_uint64(Engine));
+
+			// Values below 2^64 % Range would come up once more than the others after the modulo, they are drawn again
+			uint64 const Threshold = (static_cast<uint64>(0) - Range) % Range;
+			uint64 Bits = engine_uint64(Engine);
+			while(Bits < Threshold)
+				Bits = engine_uint64(Engine);
+			return static_cast<T>(static_cast<uint64>(Min) + Bits % Range);
+		}
+	};
+
+	template<typename T>
+	struct compute_engine_linearRand<T, true>
+	{
+		template<typename engineType>
+		GLM_FUNC_QUALIFIER static T call(T Min, T Max, engineType& Engine)
+		{
+			T const Unit = sizeof(T) <= sizeof(float) ?
+				static_cast<T>(engine_uint32(Engine) >> 8) * static_cast<T>(1.0 / 16777216.0) :
+				static_cast<T>(engine_uint64(Engine) >> 11) * static_cast<T>(1.0 / 9007199254740992.0);
+			return Min + (Max - Min) * Unit;
+		}
+	};
+
+	// Eight floats in [0, 1) from one step of the four lanes, the low then the high half of lanes 0 to 3
+	GLM_FUNC_QUALIFIER void xoshiro256pp_x4_unit(uint64 State[4][4], float Out[8])
+	{
+		for(length_t l = 0; l < 4; ++l)
+		{
+			uint64 const Bits = xoshiro256pp_next(State[0][l], State[1][l], State[2][l], State[3][l]);
+			Out[l * 2 + 0] = static_cast<float>(static_cast<uint32>(Bits) >> 8) * (1.0f / 16777216.0f);
+			Out[l * 2 + 1] = static_cast<float>(static_cast<uint32>(Bits >> 32) >> 8) * (1.0f / 16777216.0f);
+		}
+	}
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	// Lanes 0 and 1 of the state words in S[0], lanes 2 and 3 in S[1]
+	struct xoshiro256pp_x4_sse2
+	{
+		GLM_FUNC_QUALIFIER explicit xoshiro256pp_x4_sse2(uint64 const State[4][4])
+		{
+			for(length_t w = 0; w < 4; ++w)
+			{
+				S[0][w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&State[w][0]));
+				S[1][w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&State[w][2]));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint64 State[4][4]) const
+		{
+			for(length_t w = 0; w < 4; ++w)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[w][0]), S[0][w]);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&State[w][2]), S[1][w]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static __m128i next(__m128i s[4])
+		{
+			__m128i const Sum = _mm_add_epi64(s[0], s[3]);
+			__m128i const Result = _mm_add_epi64(_mm_or_si128(_mm_slli_epi64(Sum, 23), _mm_srli_epi64(Sum, 41)), s[0]);
+			__m128i const t = _mm_slli_epi64(s[1], 17);
+
+			s[2] = _mm_xor_si128(s[2], s[0]);
+			s[3] = _mm_xor_si128(s[3], s[1]);
+			s[1] = _mm_xor_si128(s[1], s[2]);
+			s[0] = _mm_xor_si128(s[0], s[3]);
+			s[2] = _mm_xor_si128(s[2], t);
+			s[3] = _mm_or_si128(_mm_slli_epi64(s[3], 45), _mm_srli_epi64(s[3], 19));
+
+			return Result;
+		}
+
+		// Same layout as xoshiro256pp_x4_unit
+		GLM_FUNC_QUALIFIER void unit(__m128& U0, __m128& U1)
+		{
+			__m128 const Scale = _mm_set1_ps(1.0f / 16777216.0f);
+			U0 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(next(S[0]), 8)), Scale);
+			U1 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(next(S[1]), 8)), Scale);
+		}
+
+		__m128i S[2][4];
+	};
+#	endif
 }//namespace detail
 
 	template<typename genType>
@@ -228,7 +410,7 @@ namespace detail
 			w = x1 * x1 + x2 * x2;
 		} while(w > genType(1));
 
-		return static_cast<genType>(x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
+		return static_cast<genType>(x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
 	}
 
 	template<length_t L, typename T, qualifier Q>
@@ -300,4 +482,283 @@ namespace detail
 
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp::xoshiro256pp(uint64 Seed)
+	{
+		this->seed(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp::seed(uint64 Seed)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			State[i] = detail::splitmix64(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp::result_type xoshiro256pp::min()
+	{
+		return static_cast<result_type>(0);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp::result_type xoshiro256pp::max()
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp::result_type xoshiro256pp::operator()()
+	{
+		return detail::xoshiro256pp_next(State[0], State[1], State[2], State[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp::jump()
+	{
+		detail::xoshiro256pp_jump(State, detail::xoshiro256pp_jump_poly());
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp::long_jump()
+	{
+		detail::xoshiro256pp_jump(State, detail::xoshiro256pp_long_jump_poly());
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp_x4::xoshiro256pp_x4(uint64 Seed)
+	{
+		this->seed(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp_x4::seed(uint64 Seed)
+	{
+		xoshiro256pp Lane(Seed);
+		for(length_t l = 0; l < 4; ++l, Lane.jump())
+		for(length_t w = 0; w < 4; ++w)
+			State[w][l] = Lane.State[w];
+		Cursor = 4;
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp_x4::result_type xoshiro256pp_x4::min()
+	{
+		return static_cast<result_type>(0);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp_x4::result_type xoshiro256pp_x4::max()
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp_x4::result_type xoshiro256pp_x4::operator()()
+	{
+		if(Cursor == 4)
+		{
+			this->next(Buffer);
+			Cursor = 0;
+		}
+		return Buffer[Cursor++];
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp_x4::next(uint64 Out[4])
+	{
+		for(length_t l = 0; l < 4; ++l)
+			Out[l] = detail::xoshiro256pp_next(State[0][l], State[1][l], State[2][l], State[3][l]);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp_x4::long_jump()
+	{
+		for(length_t l = 0; l < 4; ++l)
+		{
+			uint64 Lane[4] = {State[0][l], State[1][l], State[2][l], State[3][l]};
+			detail::xoshiro256pp_jump(Lane, detail::xoshiro256pp_long_jump_poly());
+			for(length_t w = 0; w < 4; ++w)
+				State[w][l] = Lane[w];
+		}
+		Cursor = 4;
+	}
+
+	template<typename genType, typename engineType>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max, engineType& Engine)
+	{
+		return detail::compute_engine_linearRand<genType>::call(Min, Max, Engine);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename engineType>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engineType& Engine)
+	{
+		vec<L, T, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = detail::compute_engine_linearRand<T>::call(Min[i], Max[i], Engine);
+		return Result;
+	}
+
+	template<typename genType, typename engineType>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation, engineType& Engine)
+	{
+		genType w, x1, x2;
+
+		do
+		{
+			x1 = linearRand(genType(-1), genType(1), Engine);
+			x2 = linearRand(genType(-1), genType(1), Engine);
+
+			w = x1 * x1 + x2 * x2;
+		} while(w > genType(1) || w == genType(0));
+
+		return static_cast<genType>(x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename engineType>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, engineType& Engine)
+	{
+		vec<L, T, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = gaussRand(Mean[i], Deviation[i], Engine);
+		return Result;
+	}
+
+	template<typename T, typename engineType>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius, engineType& Engine)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		vec<2, T, defaultp> Result(T(0));
+
+		do
+		{
+			Result = linearRand(
+				vec<2, T, defaultp>(-Radius),
+				vec<2, T, defaultp>(Radius), Engine);
+		}
+		while(length(Result) > Radius);
+
+		return Result;
+	}
+
+	template<typename T, typename engineType>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius, engineType& Engine)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		vec<3, T, defaultp> Result(T(0));
+
+		do
+		{
+			Result = linearRand(
+				vec<3, T, defaultp>(-Radius),
+				vec<3, T, defaultp>(Radius), Engine);
+		}
+		while(length(Result) > Radius);
+
+		return Result;
+	}
+
+	template<typename T, typename engineType>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius, engineType& Engine)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		T a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559), Engine);
+		return vec<2, T, defaultp>(glm::cos(a), glm::sin(a)) * Radius;
+	}
+
+	template<typename T, typename engineType>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius, engineType& Engine)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		// z uniform in [-1, 1] is uniform on the sphere and saves the acos of the version without engine
+		T const z = linearRand(T(-1), T(1), Engine);
+		T const theta = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559), Engine);
+		T const r2 = T(1) - z * z;
+		T const r = r2 > T(0) ? std::sqrt(r2) : T(0);
+
+		return vec<3, T, defaultp>(r * std::cos(theta), r * std::sin(theta), z) * Radius;
+	}
+
+	template<typename T, typename engineType>
+	GLM_FUNC_QUALIFIER void fillLinearRand(T* Out, std::size_t Count, T Min, T Max, engineType& Engine)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = linearRand(Min, Max, Engine);
+	}
+
+	GLM_FUNC_QUALIFIER void fillLinearRand(float* Out, std::size_t Count, float Min, float Max, xoshiro256pp_x4& Engine)
+	{
+		float const Range = Max - Min;
+		std::size_t i = 0;
+
+#		if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+			detail::xoshiro256pp_x4_sse2 Lanes(Engine.State);
+			__m128 const Base = _mm_set1_ps(Min);
+			__m128 const Scale = _mm_set1_ps(Range);
+			for(; i + 8 <= Count; i += 8)
+			{
+				__m128 U0, U1;
+				Lanes.unit(U0, U1);
+				_mm_storeu_ps(Out + i + 0, _mm_add_ps(Base, _mm_mul_ps(U0, Scale)));
+				_mm_storeu_ps(Out + i + 4, _mm_add_ps(Base, _mm_mul_ps(U1, Scale)));
+			}
+			Lanes.store(Engine.State);
+#		endif
+
+		for(; i < Count; i += 8)
+		{
+			float Unit[8];
+			detail::xoshiro256pp_x4_unit(Engine.State, Unit);
+			for(std::size_t j = 0; j < 8 && i + j < Count; ++j)
+				Out[i + j] = Min + Unit[j] * Range;
+		}
+	}
+
+	template<typename T, qualifier Q, typename engineType>
+	GLM_FUNC_QUALIFIER void fillSphericalRand(vec<3, T, Q>* Out, std::size_t Count, T Radius, engineType& Engine)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = vec<3, T, Q>(sphericalRand(Radius, Engine));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void fillSphericalRand(vec<3, float, Q>* Out, std::size_t Count, float Radius, xoshiro256pp_x4& Engine)
+	{
+		assert(Radius > 0.0f);
+
+		// z = 1 - 2u from the first half of a step, the angle in [-pi, pi) from the second half
+		std::size_t i = 0;
+
+#		if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+			detail::xoshiro256pp_x4_sse2 Lanes(Engine.State);
+			__m128 const One = _mm_set1_ps(1.0f);
+			__m128 const Two = _mm_set1_ps(2.0f);
+			__m128 const TwoPi = _mm_set1_ps(6.283185307179586476925286766559f);
+			__m128 const Pi = _mm_set1_ps(3.1415926535897932384626433832795f);
+			__m128 const R = _mm_set1_ps(Radius);
+			for(; i + 4 <= Count; i += 4)
+			{
+				__m128 U0, U1;
+				Lanes.unit(U0, U1);
+
+				__m128 const z = _mm_sub_ps(One, _mm_mul_ps(Two, U0));
+				__m128 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(One, _mm_mul_ps(z, z)), _mm_setzero_ps())), R);
+				__m128 s, c;
+				glm_vec4_sincos(_mm_sub_ps(_mm_mul_ps(U1, TwoPi), Pi), &s, &c);
+
+				float X[4], Y[4], Z[4];
+				_mm_storeu_ps(X, _mm_mul_ps(r, c));
+				_mm_storeu_ps(Y, _mm_mul_ps(r, s));
+				_mm_storeu_ps(Z, _mm_mul_ps(z, R));
+				for(std::size_t j = 0; j < 4; ++j)
+					Out[i + j] = vec<3, float, Q>(X[j], Y[j], Z[j]);
+			}
+			Lanes.store(Engine.State);
+#		endif
+
+		for(; i < Count; i += 4)
+		{
+			float Unit[8];
+			detail::xoshiro256pp_x4_unit(Engine.State, Unit);
+			for(std::size_t j = 0; j < 4 && i + j < Count; ++j)
+			{
+				float const z = 1.0f - 2.0f * Unit[j];
+				float const r2 = 1.0f - z * z;
+				float const r = (r2 > 0.0f ? std::sqrt(r2) : 0.0f) * Radius;
+				float const Angle = Unit[j + 4] * 6.283185307179586476925286766559f - 3.1415926535897932384626433832795f;
+				Out[i + j] = vec<3, float, Q>(r * std::cos(Angle), r * std::sin(Angle), z * Radius);
+			}
+		}
+	}
 }//namespace glm
@@ -12,6 +12,11 @@
 /// Include <glm/gtx/dual_quaternion.hpp> to use the features of this extension.
 ///
 /// Defines a templated dual-quaternion type and several dual-quaternion operations.
+///
+/// skinDualQuat and skinLinear skin arrays of vertices with up to four joints each.
+/// With GLM_FORCE_INTRINSICS, float vertices go through SSE2 kernels on x86,
+/// eight vertices at a time with AVX2 when the compiler targets it. Vertices can
+/// be split in chunks between threads.
 
 #pragma once
 
@@ -19,6 +24,7 @@
 #include "../glm.hpp"
 #include "../gtc/constants.hpp"
 #include "../gtc/quaternion.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -180,6 +186,47 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_DECL tdualquat<T, Q> dualquat_cast(mat<3, 4, T, Q> const& x);
 
+	/// Dual quaternion skinning of count vertices.
+	///
+	/// Vertex i blends joints[indices[i][k]] with weights[i][k] for k in [0, 3], negating the joints
+	/// on the other side of the first one, and normalizes the blend. outPositions[i] is positions[i]
+	/// transformed by the blend, and if normals is not null outNormals[i] is normals[i] rotated by it.
+	/// The weights of a vertex should sum to one, unused influences take a weight of zero.
+	/// With threads above 1 and C++11, the vertices are split in chunks between that many threads.
+	///
+	/// @see gtx_dual_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void skinDualQuat(
+		tdualquat<T, Q> const* joints,
+		vec<4, int, Q> const* indices,
+		vec<4, T, Q> const* weights,
+		vec<3, T, Q> const* positions,
+		vec<3, T, Q> const* normals,
+		vec<3, T, Q>* outPositions,
+		vec<3, T, Q>* outNormals,
+		std::size_t count,
+		unsigned threads = 1);
+
+	/// Linear blend skinning of count vertices, with the joints as returned by mat3x4_cast.
+	///
+	/// Vertex i blends joints[indices[i][k]] with weights[i][k] for k in [0, 3].
+	/// outPositions[i] is vec4(positions[i], 1) * blend, and if normals is not null outNormals[i]
+	/// is normalize(vec4(normals[i], 0) * blend).
+	/// With threads above 1 and C++11, the vertices are split in chunks between that many threads.
+	///
+	/// @see gtx_dual_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void skinLinear(
+		mat<3, 4, T, Q> const* joints,
+		vec<4, int, Q> const* indices,
+		vec<4, T, Q> const* weights,
+		vec<3, T, Q> const* positions,
+		vec<3, T, Q> const* normals,
+		vec<3, T, Q>* outPositions,
+		vec<3, T, Q>* outNormals,
+		std::size_t count,
+		unsigned threads = 1);
+
 
 	/// Dual-quaternion of low single-qualifier floating-point numbers.
 	///
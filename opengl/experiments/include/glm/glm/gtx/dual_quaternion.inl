@@ -3,6 +3,21 @@
 #include "../geometric.hpp"
 #include <limits>
 
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <thread>
+#	include <vector>
+#endif
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#	define GLM_DUAL_QUATERNION_SSE2
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#		define GLM_DUAL_QUATERNION_AVX2
+#		include <immintrin.h>
+#	else
+#		include <emmintrin.h>
+#	endif
+#endif
+
 namespace glm
 {
 	// -- Component accesses --
@@ -258,7 +273,7 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> mat3x4_cast(tdualquat<T, Q> const& x)
 	{
-		qua<T, Q> r = x.real / length2(x.real);
+		qua<T, Q> r = x.real / dot(x.real, x.real);
 
 		qua<T, Q> const rr(r.w * x.real.w, r.x * x.real.x, r.y * x.real.y, r.z * x.real.z);
 		r *= static_cast<T>(2);
@@ -349,4 +364,394 @@ namespace glm
 		dual.w = -static_cast<T>(0.5) * ( x[0].w * real.x + x[1].w * real.y + x[2].w * real.z);
 		return tdualquat<T, Q>(real, dual);
 	}
+namespace detail
+{
+	// Arguments of skinDualQuat and skinLinear, joint is tdualquat or mat3x4
+	template<typename joint, typename T, qualifier Q>
+	struct skin_job
+	{
+		joint const* Joints;
+		vec<4, int, Q> const* Indices;
+		vec<4, T, Q> const* Weights;
+		vec<3, T, Q> const* Positions;
+		vec<3, T, Q> const* Normals;
+		vec<3, T, Q>* OutPositions;
+		vec<3, T, Q>* OutNormals;
+	};
+
+	template<typename T>
+	struct skin_simd
+	{
+		enum { value = false };
+	};
+
+	template<typename T, qualifier Q, bool UseSimd = skin_simd<T>::value>
+	struct compute_skin
+	{
+		GLM_FUNC_QUALIFIER static void dualQuat(skin_job<tdualquat<T, Q>, T, Q> const& Job, std::size_t First, std::size_t Last)
+		{
+			for(std::size_t i = First; i < Last; ++i)
+			{
+				vec<4, int, Q> const& Index = Job.Indices[i];
+				vec<4, T, Q> const& Weight = Job.Weights[i];
+
+				tdualquat<T, Q> const& Root = Job.Joints[Index[0]];
+				tdualquat<T, Q> Blend = Root * Weight[0];
+				for(length_t k = 1; k < 4; ++k)
+				{
+					tdualquat<T, Q> const& Joint = Job.Joints[Index[k]];
+					Blend = Blend + Joint * (dot(Joint.real, Root.real) < static_cast<T>(0) ? -Weight[k] : Weight[k]);
+				}
+				Blend = normalize(Blend);
+
+				Job.OutPositions[i] = Blend * Job.Positions[i];
+				if(Job.Normals)
+					Job.OutNormals[i] = Blend.real * Job.Normals[i];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(skin_job<mat<3, 4, T, Q>, T, Q> const& Job, std::size_t First, std::size_t Last)
+		{
+			for(std::size_t i = First; i < Last; ++i)
+			{
+				vec<4, int, Q> const& Index = Job.Indices[i];
+				vec<4, T, Q> const& Weight = Job.Weights[i];
+
+				mat<3, 4, T, Q> Blend = Job.Joints[Index[0]] * Weight[0];
+				for(length_t k = 1; k < 4; ++k)
+					Blend = Blend + Job.Joints[Index[k]] * Weight[k];
+
+				Job.OutPositions[i] = vec<4, T, Q>(Job.Positions[i], static_cast<T>(1)) * Blend;
+				if(Job.Normals)
+					Job.OutNormals[i] = normalize(vec<4, T, Q>(Job.Normals[i], static_cast<T>(0)) * Blend);
+			}
+		}
+	};
+
+#	if defined(GLM_DUAL_QUATERNION_SSE2)
+
+	template<>
+	struct skin_simd<float>
+	{
+		enum { value = true };
+	};
+
+	struct skin_sse2
+	{
+		typedef __m128 type;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm_storeu_ps(p, x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type x) { return _mm_sqrt_ps(x); }
+
+		// -x where a < b, x elsewhere
+		GLM_FUNC_QUALIFIER static type negateLess(type a, type b, type x) { return _mm_xor_ps(x, _mm_and_ps(_mm_cmplt_ps(a, b), _mm_set1_ps(-0.0f))); }
+
+		// Out[c] holds float c of the four floats at Base[l] + Offset in lane l
+		GLM_FUNC_QUALIFIER static void gather4(float const* const* Base, length_t Offset, type Out[4])
+		{
+			Out[0] = _mm_loadu_ps(Base[0] + Offset);
+			Out[1] = _mm_loadu_ps(Base[1] + Offset);
+			Out[2] = _mm_loadu_ps(Base[2] + Offset);
+			Out[3] = _mm_loadu_ps(Base[3] + Offset);
+			_MM_TRANSPOSE4_PS(Out[0], Out[1], Out[2], Out[3]);
+		}
+	};
+
+#	endif//defined(GLM_DUAL_QUATERNION_SSE2)
+
+#	if defined(GLM_DUAL_QUATERNION_AVX2)
+
+	struct skin_avx2
+	{
+		typedef __m256 type;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static type set1(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type x) { _mm256_storeu_ps(p, x); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type x) { return _mm256_sqrt_ps(x); }
+		GLM_FUNC_QUALIFIER static type negateLess(type a, type b, type x) { return _mm256_xor_ps(x, _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ), _mm256_set1_ps(-0.0f))); }
+
+		// Lanes 0 to 3 in the low halves and 4 to 7 in the high halves, then 4x4 transposes within each half
+		GLM_FUNC_QUALIFIER static void gather4(float const* const* Base, length_t Offset, type Out[4])
+		{
+			__m256 Row[4];
+			for(length_t l = 0; l < 4; ++l)
+				Row[l] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Base[l] + Offset)), _mm_loadu_ps(Base[l + 4] + Offset), 1);
+
+			__m256 const T0 = _mm256_unpacklo_ps(Row[0], Row[1]);
+			__m256 const T1 = _mm256_unpacklo_ps(Row[2], Row[3]);
+			__m256 const T2 = _mm256_unpackhi_ps(Row[0], Row[1]);
+			__m256 const T3 = _mm256_unpackhi_ps(Row[2], Row[3]);
+			Out[0] = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0));
+			Out[1] = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2));
+			Out[2] = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0));
+			Out[3] = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+	};
+
+	typedef skin_avx2 skin_pack;
+
+#	elif defined(GLM_DUAL_QUATERNION_SSE2)
+
+	typedef skin_sse2 skin_pack;
+
+#	endif
+
+#	if defined(GLM_DUAL_QUATERNION_SSE2)
+
+	// The kernels evaluate the expressions of the scalar path in the same order on
+	// skin_pack::size vertices, the last partial block repeats its first vertex
+
+	template<typename P>
+	struct skin_block
+	{
+		typedef typename P::type type;
+
+		type Weight[4];
+		type Position[3];
+		type Normal[3];
+
+		template<typename joint, qualifier Q>
+		GLM_FUNC_QUALIFIER void load(skin_job<joint, float, Q> const& Job, std::size_t i, std::size_t Count, float const* Base[4][P::size])
+		{
+			float const* Weights[P::size];
+			float Lane[6][P::size];
+			for(length_t l = 0; l < P::size; ++l)
+			{
+				std::size_t const v = i + (static_cast<std::size_t>(l) < Count ? static_cast<std::size_t>(l) : 0);
+				vec<4, int, Q> const& Index = Job.Indices[v];
+				for(length_t k = 0; k < 4; ++k)
+					Base[k][l] = reinterpret_cast<float const*>(Job.Joints + Index[k]);
+				Weights[l] = &Job.Weights[v][0];
+				for(length_t c = 0; c < 3; ++c)
+					Lane[c][l] = Job.Positions[v][c];
+				if(Job.Normals)
+				for(length_t c = 0; c < 3; ++c)
+					Lane[3 + c][l] = Job.Normals[v][c];
+			}
+
+			P::gather4(Weights, 0, Weight);
+			for(length_t c = 0; c < 3; ++c)
+				Position[c] = P::load(Lane[c]);
+			for(length_t c = 0; c < 3; ++c)
+				Normal[c] = Job.Normals ? P::load(Lane[3 + c]) : P::set1(0.0f);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void store(vec<3, float, Q>* Out, std::size_t i, std::size_t Count, type const Value[3])
+		{
+			float Lane[3][P::size];
+			for(length_t c = 0; c < 3; ++c)
+				P::store(Lane[c], Value[c]);
+			for(std::size_t l = 0; l < Count; ++l)
+				Out[i + l] = vec<3, float, Q>(Lane[0][l], Lane[1][l], Lane[2][l]);
+		}
+
+		GLM_FUNC_QUALIFIER static void cross(type const* a, type const* b, type* Result)
+		{
+			Result[0] = P::sub(P::mul(a[1], b[2]), P::mul(b[1], a[2]));
+			Result[1] = P::sub(P::mul(a[2], b[0]), P::mul(b[2], a[0]));
+			Result[2] = P::sub(P::mul(a[0], b[1]), P::mul(b[0], a[1]));
+		}
+
+		// dot of two quaternions in the order of the scalar dot
+		GLM_FUNC_QUALIFIER static type dot(type const* a, type const* b)
+		{
+			return P::add(P::add(P::mul(a[3], b[3]), P::mul(a[0], b[0])), P::add(P::mul(a[1], b[1]), P::mul(a[2], b[2])));
+		}
+
+		// Quaternion x, y, z and w of the joints, whatever the memory layout of qua
+		GLM_FUNC_QUALIFIER static void gatherQuat(float const* const* Base, length_t Offset, type Out[4])
+		{
+			P::gather4(Base, Offset, Out);
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				type const W = Out[0];
+				Out[0] = Out[1];
+				Out[1] = Out[2];
+				Out[2] = Out[3];
+				Out[3] = W;
+#			endif
+		}
+	};
+
+	template<typename P, qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_dual_quat_block(skin_job<tdualquat<float, Q>, float, Q> const& Job, std::size_t i, std::size_t Count)
+	{
+		typedef typename P::type type;
+		typedef skin_block<P> block;
+
+		block Block;
+		float const* Base[4][P::size];
+		Block.load(Job, i, Count, Base);
+
+		type Root[4], Real[4], Dual[4], BlendReal[4], BlendDual[4];
+		block::gatherQuat(Base[0], 0, Root);
+		block::gatherQuat(Base[0], 4, Dual);
+		for(length_t c = 0; c < 4; ++c)
+		{
+			BlendReal[c] = P::mul(Root[c], Block.Weight[0]);
+			BlendDual[c] = P::mul(Dual[c], Block.Weight[0]);
+		}
+
+		for(length_t k = 1; k < 4; ++k)
+		{
+			block::gatherQuat(Base[k], 0, Real);
+			block::gatherQuat(Base[k], 4, Dual);
+			type const Weight = P::negateLess(block::dot(Real, Root), P::set1(0.0f), Block.Weight[k]);
+			for(length_t c = 0; c < 4; ++c)
+			{
+				BlendReal[c] = P::add(BlendReal[c], P::mul(Real[c], Weight));
+				BlendDual[c] = P::add(BlendDual[c], P::mul(Dual[c], Weight));
+			}
+		}
+
+		type const Length = P::sqrt(block::dot(BlendReal, BlendReal));
+		for(length_t c = 0; c < 4; ++c)
+		{
+			BlendReal[c] = P::div(BlendReal[c], Length);
+			BlendDual[c] = P::div(BlendDual[c], Length);
+		}
+
+		// (cross(r, cross(r, v) + v * r.w + d) + d * r.w - r * d.w) * 2 + v
+		type const Two = P::set1(2.0f);
+		type Inner[3], Outer[3], Result[3];
+		block::cross(BlendReal, Block.Position, Inner);
+		for(length_t c = 0; c < 3; ++c)
+			Inner[c] = P::add(P::add(Inner[c], P::mul(Block.Position[c], BlendReal[3])), BlendDual[c]);
+		block::cross(BlendReal, Inner, Outer);
+		for(length_t c = 0; c < 3; ++c)
+			Result[c] = P::add(P::mul(P::sub(P::add(Outer[c], P::mul(BlendDual[c], BlendReal[3])), P::mul(BlendReal[c], BlendDual[3])), Two), Block.Position[c]);
+		block::store(Job.OutPositions, i, Count, Result);
+
+		if(Job.Normals)
+		{
+			// v + ((cross(r, v) * r.w) + cross(r, cross(r, v))) * 2
+			block::cross(BlendReal, Block.Normal, Inner);
+			block::cross(BlendReal, Inner, Outer);
+			for(length_t c = 0; c < 3; ++c)
+				Result[c] = P::add(Block.Normal[c], P::mul(P::add(P::mul(Inner[c], BlendReal[3]), Outer[c]), Two));
+			block::store(Job.OutNormals, i, Count, Result);
+		}
+	}
+
+	template<typename P, qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_linear_block(skin_job<mat<3, 4, float, Q>, float, Q> const& Job, std::size_t i, std::size_t Count)
+	{
+		typedef typename P::type type;
+		typedef skin_block<P> block;
+
+		block Block;
+		float const* Base[4][P::size];
+		Block.load(Job, i, Count, Base);
+
+		type Row[3][4], Blend[3][4];
+		for(length_t r = 0; r < 3; ++r)
+		{
+			P::gather4(Base[0], r * 4, Row[r]);
+			for(length_t c = 0; c < 4; ++c)
+				Blend[r][c] = P::mul(Row[r][c], Block.Weight[0]);
+		}
+
+		for(length_t k = 1; k < 4; ++k)
+		for(length_t r = 0; r < 3; ++r)
+		{
+			P::gather4(Base[k], r * 4, Row[r]);
+			for(length_t c = 0; c < 4; ++c)
+				Blend[r][c] = P::add(Blend[r][c], P::mul(Row[r][c], Block.Weight[k]));
+		}
+
+		type Result[3];
+		for(length_t r = 0; r < 3; ++r)
+			Result[r] = P::add(P::add(P::add(P::mul(Block.Position[0], Blend[r][0]), P::mul(Block.Position[1], Blend[r][1])), P::mul(Block.Position[2], Blend[r][2])), Blend[r][3]);
+		block::store(Job.OutPositions, i, Count, Result);
+
+		if(Job.Normals)
+		{
+			for(length_t r = 0; r < 3; ++r)
+				Result[r] = P::add(P::add(P::mul(Block.Normal[0], Blend[r][0]), P::mul(Block.Normal[1], Blend[r][1])), P::mul(Block.Normal[2], Blend[r][2]));
+
+			type const Dot = P::add(P::add(P::mul(Result[0], Result[0]), P::mul(Result[1], Result[1])), P::mul(Result[2], Result[2]));
+			type const InverseLength = P::div(P::set1(1.0f), P::sqrt(Dot));
+			for(length_t c = 0; c < 3; ++c)
+				Result[c] = P::mul(Result[c], InverseLength);
+			block::store(Job.OutNormals, i, Count, Result);
+		}
+	}
+
+	template<qualifier Q>
+	struct compute_skin<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void dualQuat(skin_job<tdualquat<float, Q>, float, Q> const& Job, std::size_t First, std::size_t Last)
+		{
+			for(std::size_t i = First; i < Last; i += skin_pack::size)
+				skin_dual_quat_block<skin_pack>(Job, i, Last - i < static_cast<std::size_t>(skin_pack::size) ? Last - i : static_cast<std::size_t>(skin_pack::size));
+		}
+
+		GLM_FUNC_QUALIFIER static void linear(skin_job<mat<3, 4, float, Q>, float, Q> const& Job, std::size_t First, std::size_t Last)
+		{
+			for(std::size_t i = First; i < Last; i += skin_pack::size)
+				skin_linear_block<skin_pack>(Job, i, Last - i < static_cast<std::size_t>(skin_pack::size) ? Last - i : static_cast<std::size_t>(skin_pack::size));
+		}
+	};
+
+#	endif//defined(GLM_DUAL_QUATERNION_SSE2)
+
+	// Splits the vertices in chunks of 64 between the threads, the calling thread takes the first chunks
+	template<typename job>
+	GLM_FUNC_QUALIFIER void skin_split(void (*Func)(job const&, std::size_t, std::size_t), job const& Job, std::size_t Count, unsigned Threads)
+	{
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			std::size_t const Chunks = (Count + 63) / 64;
+			if(Threads > 1 && Chunks > 1)
+			{
+				std::size_t const Workers = Threads < Chunks ? Threads : Chunks;
+				std::vector<std::thread> Thread;
+				for(std::size_t t = 1; t < Workers; ++t)
+				{
+					std::size_t const First = Chunks * t / Workers * 64;
+					std::size_t const Last = Chunks * (t + 1) / Workers * 64;
+					Thread.push_back(std::thread(Func, Job, First, Last < Count ? Last : Count));
+				}
+				Func(Job, 0, Chunks / Workers * 64);
+				for(std::size_t t = 0; t < Thread.size(); ++t)
+					Thread[t].join();
+				return;
+			}
+#		else
+			(void)Threads;
+#		endif
+
+		Func(Job, 0, Count);
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinDualQuat(tdualquat<T, Q> const* joints, vec<4, int, Q> const* indices, vec<4, T, Q> const* weights, vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count, unsigned threads)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'skinDualQuat' only accept floating-point inputs");
+
+		detail::skin_job<tdualquat<T, Q>, T, Q> const Job = {joints, indices, weights, positions, normals, outPositions, outNormals};
+		detail::skin_split(&detail::compute_skin<T, Q>::dualQuat, Job, count, threads);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinLinear(mat<3, 4, T, Q> const* joints, vec<4, int, Q> const* indices, vec<4, T, Q> const* weights, vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count, unsigned threads)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'skinLinear' only accept floating-point inputs");
+
+		detail::skin_job<mat<3, 4, T, Q>, T, Q> const Job = {joints, indices, weights, positions, normals, outPositions, outNormals};
+		detail::skin_split(&detail::compute_skin<T, Q>::linear, Job, count, threads);
+	}
 }//namespace glm
@@ -196,6 +196,18 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
 	return mad0;
 }
 
+// Per component mask ? a : b, mask components must be all 0s or all 1s
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, mask);
+#	else
+		glm_vec4 const and0 = _mm_and_ps(mask, a);
+		glm_vec4 const and1 = _mm_andnot_ps(mask, b);
+		return _mm_or_ps(and0, and1);
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
 {
 	glm_vec4 const cmp = _mm_cmple_ps(x, edge);
@@ -1,9 +1,29 @@
 /// @ref simd
 /// @file glm/simd/experimental.h
+///
+/// Four wide exp, log and pow. exp and log follow the Cephes single precision
+/// functions.
+///
+/// Maximum error against a correctly rounded result, measured over the whole
+/// float range:
+/// - glm_vec4_exp: 1 ULP, overflows to inf above 88.72 and returns subnormals
+///   down to -103.97.
+/// - glm_vec4_log: 1 ULP.
+/// - glm_vec4_pow: 1 ULP, log and exp are evaluated in double precision so the
+///   error does not grow with y * log(x). The IEEE special cases of std::pow
+///   are handled. With AVX2 the four components share one 256-bit pass, on
+///   SSE2 alone two passes make it about as fast as the C library.
+///
+/// The _lowp variants use shorter polynomials and skip the special cases.
+/// exp_lowp has a relative error below 1e-5 for results in the normal range,
+/// log_lowp an absolute error below 2e-5 for positive normal x. pow_lowp
+/// multiplies the log error by y, its relative error reaches 5e-4 when the
+/// result nears the ends of the float range.
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
+#include <limits>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +37,246 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	glm_vec4 const clp0 = glm_vec4_clamp(x, _mm_set1_ps(-104.0f), _mm_set1_ps(89.0f));
+
+	// n = round(x / ln(2)), r = x - n * ln(2) is in [-ln(2)/2, ln(2)/2]
+	glm_vec4 const rnd0 = glm_vec4_round(glm_vec4_mul(clp0, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const red0 = glm_vec4_fma(rnd0, _mm_set1_ps(-0.693359375f), clp0);
+	glm_vec4 const red1 = glm_vec4_fma(rnd0, _mm_set1_ps(2.12194440e-4f), red0);
+	glm_vec4 const sqr0 = glm_vec4_mul(red1, red1);
+
+	glm_vec4 const pol0 = glm_vec4_fma(red1, _mm_set1_ps(1.9875691500e-4f), _mm_set1_ps(1.3981999507e-3f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, red1, _mm_set1_ps(8.3334519073e-3f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, red1, _mm_set1_ps(4.1665795894e-2f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, red1, _mm_set1_ps(1.6666665459e-1f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, red1, _mm_set1_ps(5.0000001201e-1f));
+	glm_vec4 const pol5 = glm_vec4_add(glm_vec4_fma(pol4, sqr0, red1), _mm_set1_ps(1.0f));
+
+	// 2^n is applied in two steps so that n = 128 overflows and n = -150 reaches the subnormals
+	glm_ivec4 const int0 = _mm_cvtps_epi32(rnd0);
+	glm_ivec4 const int1 = _mm_srai_epi32(int0, 1);
+	glm_ivec4 const int2 = _mm_sub_epi32(int0, int1);
+	glm_vec4 const pow0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(int1, _mm_set1_epi32(127)), 23));
+	glm_vec4 const pow1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(int2, _mm_set1_epi32(127)), 23));
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(pol5, pow0), pow1);
+
+	return glm_vec4_select(_mm_cmpunord_ps(x, x), x, mul0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	// Subnormals are scaled into the normal range first
+	glm_vec4 const sub0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const scl0 = glm_vec4_select(sub0, glm_vec4_mul(x, _mm_set1_ps(33554432.0f)), x);
+	glm_vec4 const off0 = _mm_and_ps(sub0, _mm_set1_ps(25.0f));
+
+	// x = m * 2^e with m in [sqrt(1/2), sqrt(2)), t = m - 1
+	glm_ivec4 const bit0 = _mm_castps_si128(scl0);
+	glm_ivec4 const exp0 = _mm_sub_epi32(_mm_srli_epi32(bit0, 23), _mm_set1_epi32(126));
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+	glm_vec4 const cmp0 = _mm_cmplt_ps(man0, _mm_set1_ps(0.707106781186547524f));
+	glm_vec4 const red0 = glm_vec4_sub(glm_vec4_add(man0, _mm_and_ps(cmp0, man0)), _mm_set1_ps(1.0f));
+	glm_vec4 const exp1 = glm_vec4_sub(glm_vec4_sub(_mm_cvtepi32_ps(exp0), off0), _mm_and_ps(cmp0, _mm_set1_ps(1.0f)));
+	glm_vec4 const sqr0 = glm_vec4_mul(red0, red0);
+
+	glm_vec4 const pol0 = glm_vec4_fma(red0, _mm_set1_ps(7.0376836292e-2f), _mm_set1_ps(-1.1514610310e-1f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, red0, _mm_set1_ps(1.1676998740e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, red0, _mm_set1_ps(-1.2420140846e-1f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, red0, _mm_set1_ps(1.4249322787e-1f));
+	glm_vec4 const pol4 = glm_vec4_fma(pol3, red0, _mm_set1_ps(-1.6668057665e-1f));
+	glm_vec4 const pol5 = glm_vec4_fma(pol4, red0, _mm_set1_ps(2.0000714765e-1f));
+	glm_vec4 const pol6 = glm_vec4_fma(pol5, red0, _mm_set1_ps(-2.4999993993e-1f));
+	glm_vec4 const pol7 = glm_vec4_fma(pol6, red0, _mm_set1_ps(3.3333331174e-1f));
+	glm_vec4 const pol8 = glm_vec4_mul(glm_vec4_mul(pol7, red0), sqr0);
+	glm_vec4 const pol9 = glm_vec4_fma(exp1, _mm_set1_ps(-2.12194440e-4f), pol8);
+	glm_vec4 const pol10 = glm_vec4_fma(sqr0, _mm_set1_ps(-0.5f), pol9);
+	glm_vec4 const log0 = glm_vec4_fma(exp1, _mm_set1_ps(0.693359375f), glm_vec4_add(red0, pol10));
+
+	// log(0) = -inf, log(inf) = inf, log(x < 0) = NaN and NaN propagates
+	glm_vec4 const inf0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	glm_vec4 const log1 = glm_vec4_select(_mm_cmpeq_ps(x, inf0), inf0, log0);
+	glm_vec4 const log2 = glm_vec4_select(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), inf0), log1);
+	glm_vec4 const nan0 = _mm_or_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpunord_ps(x, x));
+	return _mm_or_ps(log2, nan0);
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec2 glm_dvec2_select(glm_f64vec2 mask, glm_f64vec2 a, glm_f64vec2 b)
+{
+	return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+// exp(y * log(|x|)) for two components, in double precision
+GLM_FUNC_QUALIFIER glm_f64vec2 glm_dvec2_pow_abs(glm_f64vec2 x, glm_f64vec2 y)
+{
+	// |x| = m * 2^e with m in [sqrt(1/2), sqrt(2)), float inputs are never subnormal as doubles
+	glm_ivec4 const bit0 = _mm_castpd_si128(_mm_andnot_pd(_mm_set1_pd(-0.0), x));
+	glm_ivec4 const bit1 = _mm_or_si128(_mm_srli_epi64(bit0, 52), _mm_castpd_si128(_mm_set1_pd(4503599627370496.0)));
+	glm_f64vec2 const exp0 = _mm_sub_pd(_mm_castsi128_pd(bit1), _mm_set1_pd(4503599627370496.0 + 1023.0));
+	glm_f64vec2 const man0 = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi64x(0x000FFFFFFFFFFFFFll)), _mm_castpd_si128(_mm_set1_pd(1.0))));
+	glm_f64vec2 const cmp0 = _mm_cmpgt_pd(man0, _mm_set1_pd(1.41421356237309504880));
+	glm_f64vec2 const man1 = glm_dvec2_select(cmp0, _mm_mul_pd(man0, _mm_set1_pd(0.5)), man0);
+	glm_f64vec2 const exp1 = _mm_add_pd(exp0, _mm_and_pd(cmp0, _mm_set1_pd(1.0)));
+
+	// log(m) = 2 atanh(s) with s = (m - 1) / (m + 1), |s| < 0.172
+	glm_f64vec2 const red0 = _mm_div_pd(_mm_sub_pd(man1, _mm_set1_pd(1.0)), _mm_add_pd(man1, _mm_set1_pd(1.0)));
+	glm_f64vec2 const sqr0 = _mm_mul_pd(red0, red0);
+	glm_f64vec2 const qua0 = _mm_mul_pd(sqr0, sqr0);
+	glm_f64vec2 const pol0 = _mm_add_pd(_mm_mul_pd(sqr0, _mm_set1_pd(2.0 / 3.0)), _mm_set1_pd(2.0));
+	glm_f64vec2 const pol1 = _mm_add_pd(_mm_mul_pd(sqr0, _mm_set1_pd(2.0 / 7.0)), _mm_set1_pd(2.0 / 5.0));
+	glm_f64vec2 const pol2 = _mm_add_pd(_mm_mul_pd(sqr0, _mm_set1_pd(2.0 / 11.0)), _mm_set1_pd(2.0 / 9.0));
+	glm_f64vec2 const pol3 = _mm_add_pd(_mm_mul_pd(qua0, _mm_set1_pd(2.0 / 13.0)), pol2);
+	glm_f64vec2 const pol4 = _mm_add_pd(_mm_mul_pd(qua0, pol3), pol1);
+	glm_f64vec2 const pol5 = _mm_add_pd(_mm_mul_pd(qua0, pol4), pol0);
+	glm_f64vec2 const log0 = _mm_add_pd(_mm_mul_pd(exp1, _mm_set1_pd(0.69314718055994530942)), _mm_mul_pd(pol5, red0));
+
+	// The clamp keeps 2^k finite, the float conversion still overflows and underflows
+	glm_f64vec2 const arg0 = _mm_min_pd(_mm_max_pd(_mm_mul_pd(y, log0), _mm_set1_pd(-110.0)), _mm_set1_pd(100.0));
+	glm_ivec4 const int0 = _mm_cvtpd_epi32(_mm_mul_pd(arg0, _mm_set1_pd(1.44269504088896340736)));
+	glm_f64vec2 const flt0 = _mm_cvtepi32_pd(int0);
+	glm_f64vec2 const red1 = _mm_sub_pd(_mm_sub_pd(arg0, _mm_mul_pd(flt0, _mm_set1_pd(6.93147180369123816490e-01))), _mm_mul_pd(flt0, _mm_set1_pd(1.90821492927058770002e-10)));
+
+	// Degree 8 Taylor polynomial, evaluated with Estrin's scheme to shorten the dependency chain
+	glm_f64vec2 const sqr1 = _mm_mul_pd(red1, red1);
+	glm_f64vec2 const qua1 = _mm_mul_pd(sqr1, sqr1);
+	glm_f64vec2 const pol6 = _mm_add_pd(red1, _mm_set1_pd(1.0));
+	glm_f64vec2 const pol7 = _mm_add_pd(_mm_mul_pd(red1, _mm_set1_pd(1.0 / 6.0)), _mm_set1_pd(0.5));
+	glm_f64vec2 const pol8 = _mm_add_pd(_mm_mul_pd(red1, _mm_set1_pd(1.0 / 120.0)), _mm_set1_pd(1.0 / 24.0));
+	glm_f64vec2 const pol9 = _mm_add_pd(_mm_mul_pd(red1, _mm_set1_pd(1.0 / 5040.0)), _mm_set1_pd(1.0 / 720.0));
+	glm_f64vec2 const pol10 = _mm_add_pd(_mm_mul_pd(sqr1, _mm_add_pd(_mm_mul_pd(sqr1, _mm_set1_pd(1.0 / 40320.0)), pol9)), pol8);
+	glm_f64vec2 const pol11 = _mm_add_pd(_mm_add_pd(pol6, _mm_mul_pd(sqr1, pol7)), _mm_mul_pd(qua1, pol10));
+
+	glm_ivec4 const int1 = _mm_unpacklo_epi32(_mm_add_epi32(int0, _mm_set1_epi32(1023)), _mm_setzero_si128());
+	glm_f64vec2 const pow0 = _mm_castsi128_pd(_mm_slli_epi64(int1, 52));
+	return _mm_mul_pd(pol11, pow0);
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_select(__m256d mask, __m256d a, __m256d b)
+{
+	return _mm256_blendv_pd(b, a, mask);
+}
+
+// Same as glm_dvec2_pow_abs for four components
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_pow_abs(__m256d x, __m256d y)
+{
+	// |x| = m * 2^e with m in [sqrt(1/2), sqrt(2)), float inputs are never subnormal as doubles
+	__m256i const bit0 = _mm256_castpd_si256(_mm256_andnot_pd(_mm256_set1_pd(-0.0), x));
+	__m256i const bit1 = _mm256_or_si256(_mm256_srli_epi64(bit0, 52), _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)));
+	__m256d const exp0 = _mm256_sub_pd(_mm256_castsi256_pd(bit1), _mm256_set1_pd(4503599627370496.0 + 1023.0));
+	__m256d const man0 = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bit0, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)), _mm256_castpd_si256(_mm256_set1_pd(1.0))));
+	__m256d const cmp0 = _mm256_cmp_pd(man0, _mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ);
+	__m256d const man1 = glm_dvec4_select(cmp0, _mm256_mul_pd(man0, _mm256_set1_pd(0.5)), man0);
+	__m256d const exp1 = _mm256_add_pd(exp0, _mm256_and_pd(cmp0, _mm256_set1_pd(1.0)));
+
+	// log(m) = 2 atanh(s) with s = (m - 1) / (m + 1), |s| < 0.172
+	__m256d const red0 = _mm256_div_pd(_mm256_sub_pd(man1, _mm256_set1_pd(1.0)), _mm256_add_pd(man1, _mm256_set1_pd(1.0)));
+	__m256d const sqr0 = _mm256_mul_pd(red0, red0);
+	__m256d const qua0 = _mm256_mul_pd(sqr0, sqr0);
+	__m256d const pol0 = _mm256_add_pd(_mm256_mul_pd(sqr0, _mm256_set1_pd(2.0 / 3.0)), _mm256_set1_pd(2.0));
+	__m256d const pol1 = _mm256_add_pd(_mm256_mul_pd(sqr0, _mm256_set1_pd(2.0 / 7.0)), _mm256_set1_pd(2.0 / 5.0));
+	__m256d const pol2 = _mm256_add_pd(_mm256_mul_pd(sqr0, _mm256_set1_pd(2.0 / 11.0)), _mm256_set1_pd(2.0 / 9.0));
+	__m256d const pol3 = _mm256_add_pd(_mm256_mul_pd(qua0, _mm256_set1_pd(2.0 / 13.0)), pol2);
+	__m256d const pol4 = _mm256_add_pd(_mm256_mul_pd(qua0, pol3), pol1);
+	__m256d const pol5 = _mm256_add_pd(_mm256_mul_pd(qua0, pol4), pol0);
+	__m256d const log0 = _mm256_add_pd(_mm256_mul_pd(exp1, _mm256_set1_pd(0.69314718055994530942)), _mm256_mul_pd(pol5, red0));
+
+	// The clamp keeps 2^k finite, the float conversion still overflows and underflows
+	__m256d const arg0 = _mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(y, log0), _mm256_set1_pd(-110.0)), _mm256_set1_pd(100.0));
+	glm_ivec4 const int0 = _mm256_cvtpd_epi32(_mm256_mul_pd(arg0, _mm256_set1_pd(1.44269504088896340736)));
+	__m256d const flt0 = _mm256_cvtepi32_pd(int0);
+	__m256d const red1 = _mm256_sub_pd(_mm256_sub_pd(arg0, _mm256_mul_pd(flt0, _mm256_set1_pd(6.93147180369123816490e-01))), _mm256_mul_pd(flt0, _mm256_set1_pd(1.90821492927058770002e-10)));
+
+	// Degree 8 Taylor polynomial, evaluated with Estrin's scheme to shorten the dependency chain
+	__m256d const sqr1 = _mm256_mul_pd(red1, red1);
+	__m256d const qua1 = _mm256_mul_pd(sqr1, sqr1);
+	__m256d const pol6 = _mm256_add_pd(red1, _mm256_set1_pd(1.0));
+	__m256d const pol7 = _mm256_add_pd(_mm256_mul_pd(red1, _mm256_set1_pd(1.0 / 6.0)), _mm256_set1_pd(0.5));
+	__m256d const pol8 = _mm256_add_pd(_mm256_mul_pd(red1, _mm256_set1_pd(1.0 / 120.0)), _mm256_set1_pd(1.0 / 24.0));
+	__m256d const pol9 = _mm256_add_pd(_mm256_mul_pd(red1, _mm256_set1_pd(1.0 / 5040.0)), _mm256_set1_pd(1.0 / 720.0));
+	__m256d const pol10 = _mm256_add_pd(_mm256_mul_pd(sqr1, _mm256_add_pd(_mm256_mul_pd(sqr1, _mm256_set1_pd(1.0 / 40320.0)), pol9)), pol8);
+	__m256d const pol11 = _mm256_add_pd(_mm256_add_pd(pol6, _mm256_mul_pd(sqr1, pol7)), _mm256_mul_pd(qua1, pol10));
+
+	__m256i const int1 = _mm256_cvtepi32_epi64(_mm_add_epi32(int0, _mm_set1_epi32(1023)));
+	__m256d const pow0 = _mm256_castsi256_pd(_mm256_slli_epi64(int1, 52));
+	return _mm256_mul_pd(pol11, pow0);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		glm_vec4 const pow0 = _mm256_cvtpd_ps(glm_dvec4_pow_abs(_mm256_cvtps_pd(x), _mm256_cvtps_pd(y)));
+#	else
+		glm_f64vec2 const low0 = glm_dvec2_pow_abs(_mm_cvtps_pd(x), _mm_cvtps_pd(y));
+		glm_f64vec2 const high0 = glm_dvec2_pow_abs(_mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_cvtps_pd(_mm_movehl_ps(y, y)));
+		glm_vec4 const pow0 = _mm_movelh_ps(_mm_cvtpd_ps(low0), _mm_cvtpd_ps(high0));
+#	endif
+
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const inf0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+
+	// x = 0 and x = inf are exact for any y, even tiny ones that would make y * log(x) finite
+	glm_vec4 const pos0 = _mm_cmpgt_ps(y, _mm_setzero_ps());
+	glm_vec4 const zer0 = glm_vec4_select(_mm_cmpeq_ps(x, _mm_setzero_ps()), glm_vec4_select(pos0, _mm_setzero_ps(), inf0), pow0);
+	glm_vec4 const inf1 = glm_vec4_select(_mm_cmpeq_ps(glm_vec4_abs(x), inf0), glm_vec4_select(pos0, inf0, _mm_setzero_ps()), zer0);
+
+	// A negative x, -0 and -inf included, with an odd integer y negates the result
+	glm_ivec4 const int0 = _mm_cvttps_epi32(y);
+	glm_vec4 const isInt = _mm_or_ps(_mm_cmpeq_ps(_mm_cvtepi32_ps(int0), y), _mm_cmpge_ps(glm_vec4_abs(y), _mm_set1_ps(8388608.0f)));
+	glm_vec4 const isOdd = _mm_and_ps(_mm_cmpeq_ps(_mm_cvtepi32_ps(int0), y), _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(int0, _mm_set1_epi32(1)), _mm_set1_epi32(1))));
+	glm_vec4 const pow1 = _mm_xor_ps(inf1, _mm_and_ps(_mm_and_ps(isOdd, x), sgn0));
+
+	// A finite negative x with a non integer y gives NaN
+	glm_vec4 const nan0 = _mm_andnot_ps(isInt, _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpgt_ps(x, _mm_sub_ps(_mm_setzero_ps(), inf0))));
+	glm_vec4 const pow2 = _mm_or_ps(pow1, nan0);
+
+	// pow(+-1, +-inf) = 1, NaN propagates except for pow(1, y) = 1 and pow(x, 0) = 1
+	glm_vec4 const pow3 = glm_vec4_select(_mm_and_ps(_mm_cmpeq_ps(glm_vec4_abs(x), one0), _mm_cmpeq_ps(glm_vec4_abs(y), inf0)), one0, pow2);
+	glm_vec4 const pow4 = glm_vec4_select(_mm_cmpunord_ps(x, y), glm_vec4_add(x, y), pow3);
+	return glm_vec4_select(_mm_or_ps(_mm_cmpeq_ps(x, one0), _mm_cmpeq_ps(y, _mm_setzero_ps())), one0, pow4);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_lowp(glm_vec4 x)
+{
+	glm_vec4 const clp0 = glm_vec4_clamp(x, _mm_set1_ps(-87.33f), _mm_set1_ps(88.37f));
+	glm_vec4 const rnd0 = glm_vec4_round(glm_vec4_mul(clp0, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const red0 = glm_vec4_fma(rnd0, _mm_set1_ps(-0.693359375f), clp0);
+	glm_vec4 const red1 = glm_vec4_fma(rnd0, _mm_set1_ps(2.12194440e-4f), red0);
+
+	glm_vec4 const pol0 = glm_vec4_fma(red1, _mm_set1_ps(4.127774709146625e-2f), _mm_set1_ps(1.6753513931017416e-1f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, red1, _mm_set1_ps(5.000511602695434e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, red1, _mm_set1_ps(1.0f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, red1, _mm_set1_ps(1.0f));
+
+	glm_ivec4 const int0 = _mm_cvtps_epi32(rnd0);
+	glm_vec4 const pow0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(int0, _mm_set1_epi32(127)), 23));
+	return glm_vec4_mul(pol3, pow0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_lowp(glm_vec4 x)
+{
+	glm_ivec4 const bit0 = _mm_castps_si128(x);
+	glm_ivec4 const exp0 = _mm_sub_epi32(_mm_srli_epi32(bit0, 23), _mm_set1_epi32(127));
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+	glm_vec4 const cmp0 = _mm_cmpgt_ps(man0, _mm_set1_ps(1.41421356237309504880f));
+	glm_vec4 const man1 = glm_vec4_select(cmp0, glm_vec4_mul(man0, _mm_set1_ps(0.5f)), man0);
+	glm_vec4 const exp1 = glm_vec4_add(_mm_cvtepi32_ps(exp0), _mm_and_ps(cmp0, _mm_set1_ps(1.0f)));
+	glm_vec4 const red0 = glm_vec4_sub(man1, _mm_set1_ps(1.0f));
+	glm_vec4 const sqr0 = glm_vec4_mul(red0, red0);
+
+	glm_vec4 const pol0 = glm_vec4_fma(red0, _mm_set1_ps(-1.459251508156041e-1f), _mm_set1_ps(2.1776510021903975e-1f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, red0, _mm_set1_ps(-2.5244997504466277e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, red0, _mm_set1_ps(3.328547102479054e-1f));
+	glm_vec4 const pol3 = glm_vec4_fma(glm_vec4_mul(pol2, sqr0), red0, glm_vec4_fma(sqr0, _mm_set1_ps(-0.5f), red0));
+	return glm_vec4_fma(exp1, _mm_set1_ps(0.69314718055994530942f), pol3);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow_lowp(glm_vec4 x, glm_vec4 y)
+{
+	return glm_vec4_exp_lowp(glm_vec4_mul(y, glm_vec4_log_lowp(x)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
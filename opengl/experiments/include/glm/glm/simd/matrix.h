@@ -1025,4 +1025,110 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// 256-bit kernels, two columns per register with the even column in the low lane.
+// The glm_vec4 arrays of a matrix are contiguous so column pairs are single loads.
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_fma(__m256 a, __m256 b, __m256 c)
+{
+#	if defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC)
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx2(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	float const* B = reinterpret_cast<float const*>(in2);
+	float* Out = reinterpret_cast<float*>(out);
+
+	// Each column of in1 in both lanes
+	__m256 A0 = _mm256_broadcast_ps(&in1[0]);
+	__m256 A1 = _mm256_broadcast_ps(&in1[1]);
+	__m256 A2 = _mm256_broadcast_ps(&in1[2]);
+	__m256 A3 = _mm256_broadcast_ps(&in1[3]);
+
+	__m256 B01 = _mm256_loadu_ps(B);
+	__m256 B23 = _mm256_loadu_ps(B + 8);
+
+	// out[j] = in1[0] * in2[j].x + in1[1] * in2[j].y + in1[2] * in2[j].z + in1[3] * in2[j].w
+	// The in-lane permutes splat the component of whichever column the lane holds,
+	// two accumulators per pair keep the FMA chains short
+	__m256 Out01a = _mm256_mul_ps(A0, _mm256_permute_ps(B01, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 Out01b = _mm256_mul_ps(A1, _mm256_permute_ps(B01, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m256 Out23a = _mm256_mul_ps(A0, _mm256_permute_ps(B23, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 Out23b = _mm256_mul_ps(A1, _mm256_permute_ps(B23, _MM_SHUFFLE(1, 1, 1, 1)));
+
+	Out01a = glm_vec8_fma(A2, _mm256_permute_ps(B01, _MM_SHUFFLE(2, 2, 2, 2)), Out01a);
+	Out01b = glm_vec8_fma(A3, _mm256_permute_ps(B01, _MM_SHUFFLE(3, 3, 3, 3)), Out01b);
+	Out23a = glm_vec8_fma(A2, _mm256_permute_ps(B23, _MM_SHUFFLE(2, 2, 2, 2)), Out23a);
+	Out23b = glm_vec8_fma(A3, _mm256_permute_ps(B23, _MM_SHUFFLE(3, 3, 3, 3)), Out23b);
+
+	_mm256_storeu_ps(Out, _mm256_add_ps(Out01a, Out01b));
+	_mm256_storeu_ps(Out + 8, _mm256_add_ps(Out23a, Out23b));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4_avx2(glm_vec4 const m[4], glm_vec4 v)
+{
+	float const* M = reinterpret_cast<float const*>(m);
+
+	// x x x x | y y y y and z z z z | w w w w, one cross-lane permute per pair of
+	// columns instead of a broadcast per component
+	__m256 V = _mm256_castps128_ps256(v);
+	__m256 Vxy = _mm256_permutevar8x32_ps(V, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1));
+	__m256 Vzw = _mm256_permutevar8x32_ps(V, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3));
+
+	__m256 Sum = _mm256_mul_ps(_mm256_loadu_ps(M), Vxy);
+	Sum = glm_vec8_fma(_mm256_loadu_ps(M + 8), Vzw, Sum);
+
+	return _mm_add_ps(_mm256_castps256_ps128(Sum), _mm256_extractf128_ps(Sum, 1));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_transpose_avx2(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	float const* In = reinterpret_cast<float const*>(in);
+	float* Out = reinterpret_cast<float*>(out);
+
+	__m256 C01 = _mm256_loadu_ps(In);
+	__m256 C23 = _mm256_loadu_ps(In + 8);
+
+	// x0 x2 y0 y2 | x1 x3 y1 y3 and z0 z2 w0 w2 | z1 z3 w1 w3
+	__m256 Lo = _mm256_unpacklo_ps(C01, C23);
+	__m256 Hi = _mm256_unpackhi_ps(C01, C23);
+
+	// x0 x2 x1 x3 | y0 y2 y1 y3, then x0 x1 x2 x3 | y0 y1 y2 y3
+	__m256 XY = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(Lo), _MM_SHUFFLE(3, 1, 2, 0)));
+	__m256 ZW = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(Hi), _MM_SHUFFLE(3, 1, 2, 0)));
+
+	_mm256_storeu_ps(Out, _mm256_permute_ps(XY, _MM_SHUFFLE(3, 1, 2, 0)));
+	_mm256_storeu_ps(Out + 8, _mm256_permute_ps(ZW, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+#if defined(__AVX512F__)
+
+// The whole matrix in one 512-bit register, one column per lane. Meant for
+// arrays of 64 byte aligned matrices, glm_mat4_mul_avx2 is faster otherwise
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx512(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m512 B = _mm512_loadu_ps(reinterpret_cast<float const*>(in2));
+
+	__m512 A0 = _mm512_broadcast_f32x4(in1[0]);
+	__m512 A1 = _mm512_broadcast_f32x4(in1[1]);
+	__m512 A2 = _mm512_broadcast_f32x4(in1[2]);
+	__m512 A3 = _mm512_broadcast_f32x4(in1[3]);
+
+	__m512 Out0 = _mm512_mul_ps(A0, _mm512_permute_ps(B, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m512 Out1 = _mm512_mul_ps(A1, _mm512_permute_ps(B, _MM_SHUFFLE(1, 1, 1, 1)));
+	Out0 = _mm512_fmadd_ps(A2, _mm512_permute_ps(B, _MM_SHUFFLE(2, 2, 2, 2)), Out0);
+	Out1 = _mm512_fmadd_ps(A3, _mm512_permute_ps(B, _MM_SHUFFLE(3, 3, 3, 3)), Out1);
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_add_ps(Out0, Out1));
+}
+
+#endif//defined(__AVX512F__)
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
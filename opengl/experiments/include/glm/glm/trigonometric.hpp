@@ -83,6 +83,15 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> tan(vec<L, T, Q> const& angle);
 
+	/// Computes the sine and the cosine of angle at once, they share their range reduction.
+	/// This function is not part of GLSL.
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void sincos(vec<L, T, Q> const& angle, vec<L, T, Q>& s, vec<L, T, Q>& c);
+
 	/// Arc sine. Returns an angle whose sine is x.
 	/// The range of values returned by this function is [-PI/2, PI/2].
 	/// Results are undefined if |x| > 1.
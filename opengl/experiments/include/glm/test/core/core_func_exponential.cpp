@@ -5,8 +5,15 @@
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_uint4.hpp>
 #include <glm/common.hpp>
 #include <glm/exponential.hpp>
+#include <glm/ext/scalar_ulp.hpp>
+#include <cmath>
+#include <limits>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 static int test_pow()
 {
@@ -168,6 +175,98 @@ static int test_inversesqrt()
 	return Error;
 }
 
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+// Distance between Result and the exact Expected, in units of the last place of the
+// correctly rounded float
+static double ulp_error(float Result, double Expected)
+{
+	float const Rounded = static_cast<float>(Expected);
+	if(glm::isnan(Rounded) || glm::isinf(Rounded))
+		return (glm::isnan(Result) && glm::isnan(Rounded)) || Result == Rounded ? 0.0 : std::numeric_limits<double>::infinity();
+
+	float const Magnitude = std::abs(Rounded);
+	float Ulp = glm::nextFloat(Magnitude) - Magnitude;
+	return std::abs(static_cast<double>(Result) - Expected) / static_cast<double>(Ulp);
+}
+
+// The aligned types take the SIMD polynomials of glm/simd/exponential.h when they are enabled
+static int test_simd()
+{
+	typedef glm::aligned_vec4 vecType;
+	typedef glm::vec<4, float, glm::aligned_lowp> lowpType;
+
+	int Error = 0;
+
+	double Exp = 0.0;
+	double ExpLowp = 0.0;
+	for(int i = -104000; i <= 89000; i += 4)
+	{
+		vecType const X(static_cast<float>(i) * 0.001f, static_cast<float>(i + 1) * 0.001f, static_cast<float>(i + 2) * 0.001f, static_cast<float>(i + 3) * 0.0001f);
+		vecType const E = glm::exp(X);
+		lowpType const L = glm::exp(lowpType(X));
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			double const Expected = std::exp(static_cast<double>(X[j]));
+			Exp = glm::max(Exp, ulp_error(E[j], Expected));
+			if(X[j] > -87.0f && X[j] < 88.0f)
+				ExpLowp = glm::max(ExpLowp, std::abs(static_cast<double>(L[j]) / Expected - 1.0));
+		}
+	}
+	Error += Exp <= 1.0 ? 0 : 1;
+	Error += ExpLowp < 1e-5 ? 0 : 1;
+
+	// Walks the bit patterns of the positive floats, subnormals included
+	double Log = 0.0;
+	double LogLowp = 0.0;
+	for(glm::uint i = 1; i < 0x7F800000u; i += 0x7F800000u / 100003u * 4u)
+	{
+		vecType const X(glm::uintBitsToFloat(glm::uvec4(i, i + 1u, i + 0x1FFFu, i + 0x3FFFFFu)));
+		vecType const L = glm::log(X);
+		lowpType const LL = glm::log(lowpType(X));
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			double const Expected = std::log(static_cast<double>(X[j]));
+			Log = glm::max(Log, ulp_error(L[j], Expected));
+			if(X[j] >= std::numeric_limits<float>::min())
+				LogLowp = glm::max(LogLowp, std::abs(static_cast<double>(LL[j]) - Expected));
+		}
+	}
+	Error += Log <= 1.0 ? 0 : 1;
+	Error += LogLowp < 2e-5 ? 0 : 1;
+
+	double Pow = 0.0;
+	for(int i = 0; i <= 400; ++i)
+	for(int j = -400; j <= 400; j += 4)
+	{
+		vecType const X(static_cast<float>(i) * 0.25f, static_cast<float>(i) * 0.005f, 0.9f + static_cast<float>(i) * 0.0005f, static_cast<float>(i) * 0.25f);
+		vecType const Y(static_cast<float>(j) * 0.05f, static_cast<float>(j + 1) * 0.05f, static_cast<float>(j + 2) * 2.0f, static_cast<float>(j / 4));
+		vecType const P = glm::pow(X, Y);
+		for(glm::length_t k = 0; k < 4; ++k)
+			Pow = glm::max(Pow, ulp_error(P[k], std::pow(static_cast<double>(X[k]), static_cast<double>(Y[k]))));
+	}
+	Error += Pow <= 1.0 ? 0 : 1;
+
+	// Special values follow the C library
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const Values[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f, 2.0f, -2.0f, 3.0f, -3.0f, 1e-40f, Inf, -Inf, std::numeric_limits<float>::quiet_NaN()};
+	std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += ulp_error(glm::exp(vecType(Values[i])).x, std::exp(static_cast<double>(Values[i]))) <= 1.0 ? 0 : 1;
+		Error += ulp_error(glm::log(vecType(Values[i])).x, std::log(static_cast<double>(Values[i]))) <= 1.0 ? 0 : 1;
+		for(std::size_t j = 0; j < Count; ++j)
+		{
+			float const P = glm::pow(vecType(Values[i]), vecType(Values[j])).x;
+			float const Expected = std::pow(Values[i], Values[j]);
+			bool const SameSign = (glm::floatBitsToUint(P) >> 31) == (glm::floatBitsToUint(Expected) >> 31);
+			Error += (glm::isnan(P) && glm::isnan(Expected)) || (SameSign && ulp_error(P, Expected) <= 1.0) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
 int main()
 {
 	int Error = 0;
@@ -179,6 +278,9 @@ int main()
 	Error += test_exp2();
 	Error += test_log2();
 	Error += test_inversesqrt();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_simd();
+#	endif
 
 	return Error;
 }
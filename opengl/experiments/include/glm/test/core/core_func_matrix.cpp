@@ -6,6 +6,9 @@
 #include <vector>
 #include <ctime>
 #include <cstdio>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 using namespace glm;
 
@@ -257,6 +260,27 @@ int test_inverse_simd()
 	return Error;
 }
 
+int test_transpose_simd()
+{
+	int Error = 0;
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	glm::mat4 const M(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	glm::mat4 const T(glm::transpose(glm::aligned_mat4(M)));
+	Error += T == glm::transpose(M) ? 0 : 1;
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	glm::aligned_mat4 const A(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	glm::aligned_mat4 SSE, AVX;
+	glm_mat4_transpose(&A[0].data, &SSE[0].data);
+	glm_mat4_transpose_avx2(&A[0].data, &AVX[0].data);
+	Error += SSE == AVX ? 0 : 1;
+#endif
+
+	return Error;
+}
+
 template<typename VEC3, typename MAT4>
 int test_inverse_perf(std::size_t Count, std::size_t Instance, char const * Message)
 {
@@ -311,6 +335,7 @@ int main()
 	Error += test_determinant();
 	Error += test_inverse();
 	Error += test_inverse_simd();
+	Error += test_transpose_simd();
 
 #	ifdef NDEBUG
 	std::size_t const Samples = 1000;
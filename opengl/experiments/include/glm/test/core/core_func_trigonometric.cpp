@@ -1,10 +1,212 @@
 #include <glm/trigonometric.hpp>
+#include <glm/common.hpp>
+#include <glm/ext/scalar_ulp.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <vector>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
-int main()
+// Distance between Result and the exact Expected, in units of the last place of the
+// correctly rounded float
+static double ulp_error(float Result, double Expected)
+{
+	float const Rounded = static_cast<float>(Expected);
+	if(glm::isnan(Rounded) || glm::isinf(Rounded))
+		return (glm::isnan(Result) && glm::isnan(Rounded)) || Result == Rounded ? 0.0 : std::numeric_limits<double>::infinity();
+
+	float const Magnitude = std::abs(Rounded);
+	float Ulp = glm::nextFloat(Magnitude) - Magnitude;
+	if(Ulp == 0.0f)
+		Ulp = std::numeric_limits<float>::denorm_min();
+	return std::abs(static_cast<double>(Result) - Expected) / static_cast<double>(Ulp);
+}
+
+static bool sign_bit(float A)
+{
+	return (glm::floatBitsToUint(A) >> 31) != 0;
+}
+
+static bool same_value(float A, float B)
+{
+	return (glm::isnan(A) && glm::isnan(B)) || (A == B && sign_bit(A) == sign_bit(B));
+}
+
+// Angles over the whole range of the SIMD path, with a denser sampling of [-2pi, 2pi]
+static std::vector<float> make_angles()
+{
+	std::vector<float> Angles;
+	for(int i = -200000; i <= 200000; ++i)
+	{
+		Angles.push_back(static_cast<float>(i) * 0.04096f);
+		Angles.push_back(static_cast<float>(i) * 0.0000314159f);
+	}
+	return Angles;
+}
+
+template<typename vecType>
+static int test_sin_cos_tan(std::vector<float> const& Angles, double MaxSinCos, double MaxTan)
+{
+	int Error = 0;
+
+	double SinCos = 0.0;
+	double Tan = 0.0;
+	for(std::size_t i = 0; i + 4 <= Angles.size(); i += 4)
+	{
+		vecType const Angle(Angles[i + 0], Angles[i + 1], Angles[i + 2], Angles[i + 3]);
+		vecType const S = glm::sin(Angle);
+		vecType const C = glm::cos(Angle);
+		vecType const T = glm::tan(Angle);
+
+		vecType SinCosS, SinCosC;
+		glm::sincos(Angle, SinCosS, SinCosC);
+
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			double const A = static_cast<double>(Angle[j]);
+			SinCos = glm::max(SinCos, ulp_error(S[j], std::sin(A)));
+			SinCos = glm::max(SinCos, ulp_error(C[j], std::cos(A)));
+			Tan = glm::max(Tan, ulp_error(T[j], std::tan(A)));
+			Error += same_value(S[j], SinCosS[j]) && same_value(C[j], SinCosC[j]) ? 0 : 1;
+		}
+	}
+
+	Error += SinCos <= MaxSinCos ? 0 : 1;
+	Error += Tan <= MaxTan ? 0 : 1;
+
+	// The arguments past the range of the polynomials go through the C library
+	float const Inf = std::numeric_limits<float>::infinity();
+	vecType const Large(1e5f, -3e7f, Inf, std::numeric_limits<float>::quiet_NaN());
+	vecType const S = glm::sin(Large);
+	vecType const C = glm::cos(Large);
+	for(glm::length_t j = 0; j < 2; ++j)
+	{
+		Error += ulp_error(S[j], std::sin(static_cast<double>(Large[j]))) <= MaxSinCos ? 0 : 1;
+		Error += ulp_error(C[j], std::cos(static_cast<double>(Large[j]))) <= MaxSinCos ? 0 : 1;
+	}
+	Error += glm::isnan(S[2]) && glm::isnan(C[2]) && glm::isnan(S[3]) && glm::isnan(C[3]) ? 0 : 1;
+
+	vecType const Zero(0.0f, -0.0f, 0.0f, -0.0f);
+	vecType const SinZero = glm::sin(Zero);
+	Error += same_value(SinZero.x, 0.0f) && same_value(SinZero.y, -0.0f) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::cos(Zero), vecType(1.0f), 0.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_atan2(double MaxUlp)
 {
 	int Error = 0;
 
+	double Max = 0.0;
+	for(int i = -400; i <= 400; ++i)
+	for(int j = -400; j <= 400; j += 4)
+	{
+		vecType const Y(static_cast<float>(i) * 0.025f);
+		vecType const X(static_cast<float>(j) * 0.025f, static_cast<float>(j + 1) * 0.025f, static_cast<float>(j + 2) * 0.00025f, static_cast<float>(j + 3) * 4.0f);
+		vecType const A = glm::atan(Y, X);
+		for(glm::length_t k = 0; k < 4; ++k)
+			Max = glm::max(Max, ulp_error(A[k], std::atan2(static_cast<double>(Y[k]), static_cast<double>(X[k]))));
+	}
+	Error += Max <= MaxUlp ? 0 : 1;
+
+	// Signed zeros, infinities and NaN follow std::atan2
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const Values[] = {0.0f, -0.0f, 1.0f, -1.0f, Inf, -Inf, std::numeric_limits<float>::quiet_NaN()};
+	std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(std::size_t j = 0; j < Count; ++j)
+	{
+		vecType const A = glm::atan(vecType(Values[i]), vecType(Values[j]));
+		float const Expected = std::atan2(Values[i], Values[j]);
+		Error += same_value(A.x, Expected) || (sign_bit(A.x) == sign_bit(Expected) && ulp_error(A.x, std::atan2(static_cast<double>(Values[i]), static_cast<double>(Values[j]))) <= MaxUlp) ? 0 : 1;
+	}
 
 	return Error;
 }
 
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+// aligned_lowp trades accuracy for speed, the bounds are absolute errors
+static int test_lowp()
+{
+	typedef glm::vec<4, float, glm::aligned_lowp> vecType;
+
+	int Error = 0;
+
+	double SinCos = 0.0;
+	for(int i = -100000; i <= 100000; i += 4)
+	{
+		vecType const Angle(static_cast<float>(i) * 0.01f, static_cast<float>(i + 1) * 0.01f, static_cast<float>(i + 2) * 0.001f, static_cast<float>(i + 3) * 0.0001f);
+		vecType const S = glm::sin(Angle);
+		vecType const C = glm::cos(Angle);
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			SinCos = glm::max(SinCos, std::abs(static_cast<double>(S[j]) - std::sin(static_cast<double>(Angle[j]))));
+			SinCos = glm::max(SinCos, std::abs(static_cast<double>(C[j]) - std::cos(static_cast<double>(Angle[j]))));
+		}
+	}
+	Error += SinCos < 2e-5 ? 0 : 1;
+
+	double Atan = 0.0;
+	for(int i = -200; i <= 200; ++i)
+	for(int j = -200; j <= 200; j += 4)
+	{
+		vecType const Y(static_cast<float>(i) * 0.05f);
+		vecType const X(static_cast<float>(j) * 0.05f, static_cast<float>(j + 1) * 0.05f, static_cast<float>(j + 2) * 0.005f, static_cast<float>(j + 3) * 0.5f);
+		vecType const A = glm::atan(Y, X);
+		for(glm::length_t k = 0; k < 4; ++k)
+			Atan = glm::max(Atan, std::abs(static_cast<double>(A[k]) - std::atan2(static_cast<double>(Y[k]), static_cast<double>(X[k]))));
+	}
+	Error += Atan < 3e-5 ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType>
+static int perf_sin(std::vector<float> const& Angles, char const* Message)
+{
+	std::vector<vecType> Inputs(Angles.size() / 4);
+	for(std::size_t i = 0; i < Inputs.size(); ++i)
+		Inputs[i] = vecType(Angles[i * 4 + 0], Angles[i * 4 + 1], Angles[i * 4 + 2], Angles[i * 4 + 3]);
+
+	vecType Sum(0.0f);
+	std::clock_t const StartTime = std::clock();
+	for(int Pass = 0; Pass < 10; ++Pass)
+	for(std::size_t i = 0; i < Inputs.size(); ++i)
+		Sum += glm::sin(Inputs[i]) + glm::cos(Inputs[i]);
+	std::clock_t const EndTime = std::clock();
+
+	std::printf("sin+cos<%s>: %d clocks (%f)\n", Message, static_cast<int>(EndTime - StartTime), static_cast<double>(Sum.x + Sum.y + Sum.z + Sum.w));
+
+	return 0;
+}
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+int main()
+{
+	int Error = 0;
+
+	std::vector<float> const Angles = make_angles();
+
+	Error += test_sin_cos_tan<glm::vec4>(Angles, 1.0, 1.0);
+	Error += test_atan2<glm::vec4>(2.0);
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		// Documented bounds of the SIMD polynomials in glm/simd/trigonometric.h
+		Error += test_sin_cos_tan<glm::aligned_vec4>(Angles, 2.0, 4.0);
+		Error += test_atan2<glm::aligned_vec4>(4.0);
+		Error += test_lowp();
+
+		Error += perf_sin<glm::vec4>(Angles, "vec4");
+		Error += perf_sin<glm::aligned_vec4>(Angles, "aligned_vec4");
+		Error += perf_sin<glm::vec<4, float, glm::aligned_lowp> >(Angles, "aligned_lowp");
+#	endif
+
+	return Error;
+}
@@ -6,6 +6,9 @@
 #include <glm/mat4x4.hpp>
 #include <glm/vec4.hpp>
 #include <vector>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
 
 template <typename matType, typename vecType>
 static int test_operators()
@@ -67,6 +70,66 @@ static int test_inverse()
 	return Error;
 }
 
+#if (GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE) || ((GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG))
+static glm::mat4 make_mat4(int Seed)
+{
+	glm::mat4 Result;
+	for(glm::length_t c = 0; c < 4; ++c)
+	for(glm::length_t r = 0; r < 4; ++r)
+		Result[c][r] = static_cast<float>((Seed * 7 + c * 5 + r * 3) % 17) * 0.25f - 2.0f;
+	return Result;
+}
+#endif
+
+// The aligned types take the SIMD kernels when they are enabled, the packed
+// ones always run the generic code
+static int test_mul_simd()
+{
+	int Error = 0;
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	for(int i = 0; i < 64; ++i)
+	{
+		glm::mat4 const A = make_mat4(i);
+		glm::mat4 const B = make_mat4(i + 11);
+		glm::vec4 const V(static_cast<float>(i) * 0.5f, -1.0f, 2.0f, 0.25f);
+
+		glm::mat4 const P(glm::aligned_mat4(A) * glm::aligned_mat4(B));
+		Error += glm::all(glm::equal(P, A * B, 0.0001f)) ? 0 : 1;
+
+		glm::vec4 const W(glm::aligned_mat4(A) * glm::aligned_vec4(V));
+		Error += glm::all(glm::equal(W, A * V, 0.0001f)) ? 0 : 1;
+	}
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_LANG & GLM_LANG_CXX11_FLAG)
+	for(int i = 0; i < 64; ++i)
+	{
+		glm::aligned_mat4 const A(make_mat4(i));
+		glm::aligned_mat4 const B(make_mat4(i + 11));
+		glm::aligned_vec4 const V(static_cast<float>(i) * 0.5f, -1.0f, 2.0f, 0.25f);
+
+		glm::aligned_mat4 SSE, AVX;
+		glm_mat4_mul(&A[0].data, &B[0].data, &SSE[0].data);
+		glm_mat4_mul_avx2(&A[0].data, &B[0].data, &AVX[0].data);
+		Error += glm::all(glm::equal(SSE, AVX, 0.0001f)) ? 0 : 1;
+
+#		if defined(__AVX512F__)
+			glm::aligned_mat4 AVX512;
+			glm_mat4_mul_avx512(&A[0].data, &B[0].data, &AVX512[0].data);
+			Error += glm::all(glm::equal(SSE, AVX512, 0.0001f)) ? 0 : 1;
+#		endif
+
+		glm::aligned_vec4 W0, W1;
+		W0.data = glm_mat4_mul_vec4(&A[0].data, V.data);
+		W1.data = glm_mat4_mul_vec4_avx2(&A[0].data, V.data);
+		Error += glm::all(glm::equal(W0, W1, 0.0001f)) ? 0 : 1;
+	}
+#endif
+
+	return Error;
+}
+
 static int test_ctr()
 {
 	int Error = 0;
@@ -211,6 +274,7 @@ int main()
 	Error += test_inverse<glm::mediump_dmat4>();
 	Error += test_inverse<glm::highp_dmat4>();
 
+	Error += test_mul_simd();
 	Error += test_size();
 	Error += test_constexpr();
 
@@ -0,0 +1,189 @@
+#include <glm/ext/batch_transform.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <vector>
+#include <cfloat>
+
+// Without contraction into FMA, fast math reassociation or excess precision
+// (x87) the kernels must match the operators bit for bit
+#if !defined(__FMA__) && !defined(__FAST_MATH__) && defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#	define TEST_BATCH_EXACT
+#endif
+
+template<glm::length_t L, typename T, glm::qualifier Q>
+static bool same(glm::vec<L, T, Q> const& a, glm::vec<L, T, Q> const& b)
+{
+#	if defined(TEST_BATCH_EXACT)
+		return a == b;
+#	else
+		return glm::all(glm::equal(a, b, static_cast<T>(0.0001)));
+#	endif
+}
+
+static glm::mat4 make_transform()
+{
+	glm::mat4 M = glm::translate(glm::mat4(1.0f), glm::vec3(1.5f, -2.25f, 3.0f));
+	M = glm::rotate(M, 0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, -0.5f)));
+	return glm::scale(M, glm::vec3(1.25f, 0.5f, 2.0f));
+}
+
+static float make_value(std::size_t i, int c)
+{
+	return static_cast<float>((static_cast<int>(i) * 37 + c * 11) % 97) * 0.21f - 10.0f;
+}
+
+// Every count up to a few blocks so each tail length is covered
+static std::size_t const Counts[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 23, 24, 25, 31, 33, 1000};
+
+static int test_points()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_transform();
+	glm::mat3 const N = glm::transpose(glm::inverse(glm::mat3(M)));
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		// One extra element that must be left untouched
+		std::vector<glm::vec3> In(Count + 1);
+		std::vector<glm::vec4> In4(Count + 1);
+		for(std::size_t i = 0; i < In.size(); ++i)
+		{
+			In[i] = glm::vec3(make_value(i, 0), make_value(i, 1), make_value(i, 2));
+			In4[i] = glm::vec4(In[i], make_value(i, 3));
+		}
+
+		std::vector<glm::vec3> Points(In.size(), glm::vec3(42.0f));
+		std::vector<glm::vec3> Directions(In.size(), glm::vec3(42.0f));
+		std::vector<glm::vec3> Normals(In.size(), glm::vec3(42.0f));
+		std::vector<glm::vec4> Points4(In.size(), glm::vec4(42.0f));
+		std::vector<glm::vec4> Directions4(In.size(), glm::vec4(42.0f));
+		glm::transformPoints(M, In.data(), Points.data(), Count);
+		glm::transformDirections(M, In.data(), Directions.data(), Count);
+		glm::transformNormals(M, In.data(), Normals.data(), Count);
+		glm::transformPoints(M, In4.data(), Points4.data(), Count);
+		glm::transformDirections(M, In4.data(), Directions4.data(), Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += same(Points[i], glm::vec3(M * glm::vec4(In[i], 1.0f))) ? 0 : 1;
+			Error += same(Directions[i], glm::vec3(M * glm::vec4(In[i], 0.0f))) ? 0 : 1;
+			Error += same(Normals[i], N * In[i]) ? 0 : 1;
+			Error += same(Points4[i], M * In4[i]) ? 0 : 1;
+			Error += same(Directions4[i], M * glm::vec4(In[i], 0.0f)) ? 0 : 1;
+		}
+
+		Error += Points[Count] == glm::vec3(42.0f) ? 0 : 1;
+		Error += Directions[Count] == glm::vec3(42.0f) ? 0 : 1;
+		Error += Normals[Count] == glm::vec3(42.0f) ? 0 : 1;
+		Error += Points4[Count] == glm::vec4(42.0f) ? 0 : 1;
+		Error += Directions4[Count] == glm::vec4(42.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_streams()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_transform();
+	glm::mat3 const N = glm::transpose(glm::inverse(glm::mat3(M)));
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<float> X(Count + 1), Y(Count + 1), Z(Count + 1);
+		for(std::size_t i = 0; i <= Count; ++i)
+		{
+			X[i] = make_value(i, 0);
+			Y[i] = make_value(i, 1);
+			Z[i] = make_value(i, 2);
+		}
+
+		std::vector<float> OX(Count + 1, 42.0f), OY(Count + 1, 42.0f), OZ(Count + 1, 42.0f);
+
+		glm::transformPoints(M, X.data(), Y.data(), Z.data(), OX.data(), OY.data(), OZ.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same(glm::vec3(OX[i], OY[i], OZ[i]), glm::vec3(M * glm::vec4(X[i], Y[i], Z[i], 1.0f))) ? 0 : 1;
+
+		glm::transformDirections(M, X.data(), Y.data(), Z.data(), OX.data(), OY.data(), OZ.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same(glm::vec3(OX[i], OY[i], OZ[i]), glm::vec3(M * glm::vec4(X[i], Y[i], Z[i], 0.0f))) ? 0 : 1;
+
+		glm::transformNormals(M, X.data(), Y.data(), Z.data(), OX.data(), OY.data(), OZ.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same(glm::vec3(OX[i], OY[i], OZ[i]), N * glm::vec3(X[i], Y[i], Z[i])) ? 0 : 1;
+
+		Error += OX[Count] == 42.0f && OY[Count] == 42.0f && OZ[Count] == 42.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_in_place()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_transform();
+
+	std::vector<glm::vec3> Points(37);
+	std::vector<float> X(37), Y(37), Z(37);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+	{
+		Points[i] = glm::vec3(make_value(i, 0), make_value(i, 1), make_value(i, 2));
+		X[i] = Points[i].x;
+		Y[i] = Points[i].y;
+		Z[i] = Points[i].z;
+	}
+	std::vector<glm::vec3> const In(Points);
+
+	glm::transformPoints(M, Points.data(), Points.data(), Points.size());
+	glm::transformPoints(M, X.data(), Y.data(), Z.data(), X.data(), Y.data(), Z.data(), X.size());
+	for(std::size_t i = 0; i < Points.size(); ++i)
+	{
+		glm::vec3 const Expected(M * glm::vec4(In[i], 1.0f));
+		Error += same(Points[i], Expected) ? 0 : 1;
+		Error += same(glm::vec3(X[i], Y[i], Z[i]), Expected) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Doubles have no kernel and take the operators
+static int test_double()
+{
+	int Error = 0;
+
+	glm::dmat4 const M(make_transform());
+
+	std::vector<glm::dvec3> In(19), Out(19);
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = glm::dvec3(make_value(i, 0), make_value(i, 1), make_value(i, 2));
+
+	glm::transformPoints(M, In.data(), Out.data(), In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += same(Out[i], glm::dvec3(M * glm::dvec4(In[i], 1.0))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_points();
+	Error += test_streams();
+	Error += test_in_place();
+	Error += test_double();
+
+	return Error;
+}
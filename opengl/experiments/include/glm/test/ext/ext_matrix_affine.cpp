@@ -0,0 +1,146 @@
+#include <glm/ext/matrix_affine.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/matrix_float3x4.hpp>
+#include <glm/ext/matrix_double3x4.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+
+// A transform with rotation, non uniform scale and translation
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> make(int i)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	T const a = static_cast<T>(i);
+	glm::mat<4, 4, T, glm::defaultp> Result(static_cast<T>(1));
+	Result = glm::translate(Result, vec3(a, static_cast<T>(2) - a, static_cast<T>(0.5) * a));
+	Result = glm::rotate(Result, static_cast<T>(0.7) * a + static_cast<T>(0.1), vec3(static_cast<T>(1), static_cast<T>(0.3), static_cast<T>(0.5)));
+	Result = glm::scale(Result, vec3(static_cast<T>(1.5), static_cast<T>(0.5) + static_cast<T>(i % 3), static_cast<T>(2)));
+	return Result;
+}
+
+template<typename T>
+static int test_cast()
+{
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::mat<4, 4, T, glm::defaultp> const M = make<T>(i);
+		glm::mat<3, 4, T, glm::defaultp> const A = glm::mat3x4_cast(M);
+
+		Error += glm::all(glm::equal(glm::mat4_cast(A), M, Epsilon)) ? 0 : 1;
+		for(glm::length_t r = 0; r < 3; ++r)
+		for(glm::length_t c = 0; c < 4; ++c)
+			Error += A[r][c] == M[c][r] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_compose()
+{
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::mat<4, 4, T, glm::defaultp> const M = make<T>(i);
+		glm::mat<4, 4, T, glm::defaultp> const N = make<T>(i + 5);
+		glm::mat<3, 4, T, glm::defaultp> const C = glm::affineCompose(glm::mat3x4_cast(M), glm::mat3x4_cast(N));
+
+		Error += glm::all(glm::equal(glm::mat4_cast(C), M * N, Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_inverse()
+{
+	int Error = 0;
+
+	typedef glm::mat<3, 4, T, glm::defaultp> affine;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::mat<4, 4, T, glm::defaultp> const M = make<T>(i);
+		affine const A = glm::mat3x4_cast(M);
+		affine const I = glm::affineInverse(A);
+
+		Error += glm::all(glm::equal(glm::mat4_cast(I), glm::inverse(M), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineCompose(A, I), affine(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineCompose(I, A), affine(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_transform()
+{
+	int Error = 0;
+
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::mat<4, 4, T, glm::defaultp> const M = make<T>(i);
+		glm::mat<3, 4, T, glm::defaultp> const A = glm::mat3x4_cast(M);
+		vec3 const V(static_cast<T>(i) - static_cast<T>(3), static_cast<T>(0.25), static_cast<T>(2));
+
+		Error += glm::all(glm::equal(glm::transformPoint(A, V), vec3(M * vec4(V, static_cast<T>(1))), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::transformDirection(A, V), vec3(M * vec4(V, static_cast<T>(0))), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_matrix_transform()
+{
+	int Error = 0;
+
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	vec3 const Axis(static_cast<T>(-0.2), static_cast<T>(1), static_cast<T>(0.4));
+	vec3 const V(static_cast<T>(3), static_cast<T>(-1), static_cast<T>(0.5));
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::mat<4, 4, T, glm::defaultp> const M = make<T>(i);
+		glm::mat<3, 4, T, glm::defaultp> const A = glm::mat3x4_cast(M);
+		T const Angle = static_cast<T>(0.3) * static_cast<T>(i);
+
+		Error += glm::all(glm::equal(glm::mat4_cast(glm::translate(A, V)), glm::translate(M, V), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4_cast(glm::rotate(A, Angle, Axis)), glm::rotate(M, Angle, Axis), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4_cast(glm::scale(A, V)), glm::scale(M, V), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_cast<float>();
+	Error += test_cast<double>();
+	Error += test_compose<float>();
+	Error += test_compose<double>();
+	Error += test_inverse<float>();
+	Error += test_inverse<double>();
+	Error += test_transform<float>();
+	Error += test_transform<double>();
+	Error += test_matrix_transform<float>();
+	Error += test_matrix_transform<double>();
+
+	return Error;
+}
@@ -1,5 +1,14 @@
 #include <glm/gtc/matrix_inverse.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <cfloat>
+
+// Without contraction or excess precision (x87) the batch kernels evaluate the same operations as glm::inverse
+#if !defined(__FMA__) && !defined(__FAST_MATH__) && defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#	define TEST_BATCH_EXACT
+#endif
 
 int test_affine()
 {
@@ -41,11 +50,87 @@ int test_affine()
 	return Error;
 }
 
+template<typename T>
+static glm::mat<4, 4, T, glm::packed_highp> make(int i)
+{
+	glm::mat<4, 4, T, glm::packed_highp> Result;
+	for(glm::length_t c = 0; c < 4; ++c)
+	for(glm::length_t r = 0; r < 4; ++r)
+		Result[c][r] = static_cast<T>(((i + 3) * (c * 4 + r + 1) * 37) % 23) / static_cast<T>(7) - static_cast<T>(c == r ? -2 : 1);
+
+	// Every fifth matrix is singular, with a zero column
+	if(i % 5 == 4)
+		Result[i % 4] = glm::vec<4, T, glm::packed_highp>(static_cast<T>(0));
+	return Result;
+}
+
+template<typename T>
+static int test_batch()
+{
+	int Error = 0;
+
+	typedef glm::mat<4, 4, T, glm::packed_highp> mat4;
+
+	T const Epsilon = static_cast<T>(0.001);
+	for(int Count = 0; Count < 20; ++Count)
+	{
+		std::vector<mat4> In(static_cast<std::size_t>(Count) + 1, mat4(static_cast<T>(1)));
+		for(int i = 0; i <= Count; ++i)
+			In[i] = make<T>(i);
+
+		// One more matrix than Count, untouched by the kernels
+		std::vector<mat4> Inverse(In.size(), mat4(static_cast<T>(7)));
+		std::vector<mat4> InverseTranspose(In.size(), mat4(static_cast<T>(7)));
+		std::vector<T> Determinant(In.size(), static_cast<T>(7));
+		glm::inverse(&In[0], &Inverse[0], static_cast<std::size_t>(Count));
+		glm::inverseTranspose(&In[0], &InverseTranspose[0], static_cast<std::size_t>(Count));
+		glm::determinant(&In[0], &Determinant[0], static_cast<std::size_t>(Count));
+
+		Error += Inverse[Count] == mat4(static_cast<T>(7)) ? 0 : 1;
+		Error += InverseTranspose[Count] == mat4(static_cast<T>(7)) ? 0 : 1;
+		Error += glm::equal(Determinant[Count], static_cast<T>(7), static_cast<T>(0)) ? 0 : 1;
+
+		for(int i = 0; i < Count; ++i)
+		{
+			T const Det = glm::determinant(In[i]);
+			Error += glm::equal(Determinant[i], Det, Epsilon) ? 0 : 1;
+
+			if(i % 5 == 4)
+			{
+				Error += Inverse[i] == mat4(static_cast<T>(0)) ? 0 : 1;
+				Error += InverseTranspose[i] == mat4(static_cast<T>(0)) ? 0 : 1;
+				continue;
+			}
+
+			mat4 const Reference = glm::inverse(In[i]);
+			Error += glm::all(glm::equal(Inverse[i], Reference, Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::equal(InverseTranspose[i], glm::transpose(Reference), Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::equal(In[i] * Inverse[i], mat4(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+
+#			ifdef TEST_BATCH_EXACT
+				Error += Inverse[i] == Reference ? 0 : 1;
+				Error += InverseTranspose[i] == glm::transpose(Reference) ? 0 : 1;
+				Error += glm::equal(Determinant[i], Det, static_cast<T>(0)) ? 0 : 1;
+#			endif
+		}
+
+		// In place
+		std::vector<mat4> InPlace(In);
+		glm::inverse(&InPlace[0], &InPlace[0], static_cast<std::size_t>(Count));
+		for(int i = 0; i < Count; ++i)
+			Error += InPlace[i] == Inverse[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_affine();
+	Error += test_batch<float>();
+	Error += test_batch<double>();
 
 	return Error;
 }
@@ -1,7 +1,25 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtc/noise.hpp>
+#include <glm/ext/scalar_relational.hpp>
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/raw_data.hpp>
+#include <vector>
+#include <cfloat>
+
+// The batch functions stay within 1e-5 of the scalar functions. With excess precision (x87) the same scalar
+// expression may round the sample positions once or twice depending on where it is inlined, which moves the
+// high octaves by up to a float step of the position times the slope of the noise.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#	define TEST_NOISE_BOUND 1e-5
+#else
+#	define TEST_NOISE_BOUND 1e-4
+#endif
+
+// With FMA contraction, perlin(vec3) may round gz to the other side of 0 where it is exactly 0, those samples use
+// another gradient than the batch functions, see gtc_noise. Up to one sample in ten per octave may do so.
+#if defined(__FMA__)
+#	define TEST_NOISE_FMA_TIES 10
+#endif
 
 static int test_simplex_float()
 {
@@ -69,6 +87,176 @@ static int test_perlin_pedioric_double()
 	return Error;
 }
 
+template<typename vecType>
+static std::vector<vecType> points(std::size_t Count)
+{
+	std::vector<vecType> Points(Count, vecType(0));
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t k = 0; k < vecType::length(); ++k)
+		Points[i][k] = static_cast<typename vecType::value_type>(static_cast<int>((i * 7919 + static_cast<std::size_t>(k) * 104729) % 20011) - 10005) * static_cast<typename vecType::value_type>(0.0173);
+	return Points;
+}
+
+// Counts the samples further than TEST_NOISE_BOUND from the reference
+template<typename T>
+static std::size_t mismatch(std::vector<T> const& Out, std::vector<T> const& Ref)
+{
+	std::size_t Count = 0;
+	for(std::size_t i = 0; i < Out.size(); ++i)
+		Count += glm::abs(Out[i] - Ref[i]) > static_cast<T>(TEST_NOISE_BOUND) ? 1 : 0;
+	return Count;
+}
+
+// Samples of 3D perlin noise allowed past TEST_NOISE_BOUND
+template<typename vecType>
+static std::size_t perlin_ties(std::size_t Count, int Octaves)
+{
+#	if defined(TEST_NOISE_FMA_TIES)
+		return vecType::length() == 3 ? Count * static_cast<std::size_t>(Octaves) / TEST_NOISE_FMA_TIES : 0;
+#	else
+		(void)Count;
+		(void)Octaves;
+		return 0;
+#	endif
+}
+
+template<typename vecType>
+static int test_batch_points(std::size_t Count)
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	std::vector<vecType> const Points = points<vecType>(Count);
+	std::vector<T> Out(Count, T(0)), Ref(Count, T(0));
+
+	glm::perlin(&Points[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Ref[i] = glm::perlin(Points[i]);
+	Error += mismatch(Out, Ref) <= perlin_ties<vecType>(Count, 1) ? 0 : 1;
+
+	glm::simplex(&Points[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Ref[i] = glm::simplex(Points[i]);
+	Error += mismatch(Out, Ref) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType>
+static vecType grid_index(glm::length_t x, glm::length_t y, glm::length_t z)
+{
+	typedef typename vecType::value_type T;
+
+	vecType Index(static_cast<T>(x));
+	Index[1] = static_cast<T>(y);
+	if(vecType::length() > 2)
+		Index[vecType::length() - 1] = static_cast<T>(z);
+	return Index;
+}
+
+template<typename vecType, typename ivecType>
+static int test_batch_grid(ivecType const& Size, int Octaves)
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	vecType const Origin(static_cast<T>(-3.7));
+	vecType const Step(static_cast<T>(0.093));
+	T const Lacunarity = static_cast<T>(2);
+	T const Gain = static_cast<T>(0.5);
+
+	int const Depth = ivecType::length() > 2 ? Size[ivecType::length() - 1] : 1;
+	std::size_t const Count = static_cast<std::size_t>(Size.x * Size.y * Depth);
+
+	std::vector<T> PerlinRef(Count, T(0)), SimplexRef(Count, T(0));
+	for(int z = 0; z < Depth; ++z)
+	for(int y = 0; y < Size.y; ++y)
+	for(int x = 0; x < Size.x; ++x)
+	{
+		vecType const Position = Origin + Step * grid_index<vecType>(x, y, z);
+		std::size_t const i = static_cast<std::size_t>((z * Size.y + y) * Size.x + x);
+
+		T Frequency = static_cast<T>(1);
+		T Amplitude = static_cast<T>(1);
+		for(int o = 0; o < Octaves; ++o)
+		{
+			PerlinRef[i] += Amplitude * glm::perlin(Position * Frequency);
+			SimplexRef[i] += Amplitude * glm::simplex(Position * Frequency);
+			Frequency *= Lacunarity;
+			Amplitude *= Gain;
+		}
+	}
+
+	std::vector<T> Out(Count, T(0)), Threaded(Count, T(0));
+
+	glm::perlinGrid(Origin, Step, Size, &Out[0], Octaves, Lacunarity, Gain);
+	Error += mismatch(Out, PerlinRef) <= perlin_ties<vecType>(Count, Octaves) ? 0 : 1;
+	glm::perlinGrid(Origin, Step, Size, &Threaded[0], Octaves, Lacunarity, Gain, 3);
+	Error += mismatch(Threaded, PerlinRef) <= perlin_ties<vecType>(Count, Octaves) ? 0 : 1;
+
+	glm::simplexGrid(Origin, Step, Size, &Out[0], Octaves, Lacunarity, Gain);
+	Error += mismatch(Out, SimplexRef) == 0 ? 0 : 1;
+	glm::simplexGrid(Origin, Step, Size, &Threaded[0], Octaves, Lacunarity, Gain, 3);
+	Error += mismatch(Threaded, SimplexRef) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+// Grids with a zero or negative extent write nothing
+template<typename vecType, typename ivecType>
+static int test_batch_grid_empty(ivecType const& Size)
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	vecType const Origin(static_cast<T>(-3.7));
+	vecType const Step(static_cast<T>(0.093));
+	std::vector<T> Out(64, static_cast<T>(7));
+
+	glm::perlinGrid(Origin, Step, Size, &Out[0]);
+	glm::perlinGrid(Origin, Step, Size, &Out[0], 2, static_cast<T>(2), static_cast<T>(0.5), 3);
+	glm::simplexGrid(Origin, Step, Size, &Out[0]);
+	glm::simplexGrid(Origin, Step, Size, &Out[0], 2, static_cast<T>(2), static_cast<T>(0.5), 3);
+	for(std::size_t i = 0; i < Out.size(); ++i)
+		Error += glm::equal(Out[i], static_cast<T>(7), static_cast<T>(0)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_batch()
+{
+	int Error = 0;
+
+	Error += test_batch_points<glm::vec2>(1);
+	Error += test_batch_points<glm::vec2>(4099);
+	Error += test_batch_points<glm::vec3>(7);
+	Error += test_batch_points<glm::vec3>(4099);
+	Error += test_batch_points<glm::vec4>(257);
+	Error += test_batch_points<glm::dvec2>(257);
+	Error += test_batch_points<glm::dvec3>(257);
+
+	Error += test_batch_grid<glm::vec2>(glm::ivec2(67, 33), 1);
+	Error += test_batch_grid<glm::vec2>(glm::ivec2(300, 5), 4);
+	Error += test_batch_grid<glm::vec3>(glm::ivec3(19, 7, 5), 1);
+	Error += test_batch_grid<glm::vec3>(glm::ivec3(33, 9, 3), 3);
+	Error += test_batch_grid<glm::dvec2>(glm::ivec2(17, 5), 2);
+	Error += test_batch_grid<glm::dvec3>(glm::ivec3(5, 4, 3), 2);
+
+	Error += test_batch_grid_empty<glm::vec2>(glm::ivec2(0, 4));
+	Error += test_batch_grid_empty<glm::vec2>(glm::ivec2(4, 0));
+	Error += test_batch_grid_empty<glm::vec2>(glm::ivec2(4, -3));
+	Error += test_batch_grid_empty<glm::vec3>(glm::ivec3(-1, 4, 4));
+	Error += test_batch_grid_empty<glm::vec3>(glm::ivec3(4, -2, -2));
+	Error += test_batch_grid_empty<glm::vec3>(glm::ivec3(4, 4, 0));
+	Error += test_batch_grid_empty<glm::vec3>(glm::ivec3(4, 4, -1));
+	Error += test_batch_grid_empty<glm::dvec2>(glm::ivec2(-4, -4));
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -82,5 +270,7 @@ int main()
 	Error += test_perlin_pedioric_float();
 	Error += test_perlin_pedioric_double();
 
+	Error += test_batch();
+
 	return Error;
 }
@@ -3,6 +3,7 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 
 void print_bits(float const& s)
@@ -109,6 +110,113 @@ int test_Half4x16()
 	return Error;
 }
 
+static float float_bits(glm::uint32 Bits)
+{
+	float Result = 0.0f;
+	std::memcpy(&Result, &Bits, sizeof(Result));
+	return Result;
+}
+
+static glm::uint32 bits_float(float Value)
+{
+	glm::uint32 Result = 0;
+	std::memcpy(&Result, &Value, sizeof(Result));
+	return Result;
+}
+
+int test_HalfRounding()
+{
+	int Error = 0;
+
+	struct entry
+	{
+		glm::uint32 Float;
+		glm::uint16 Half;
+	};
+
+	// Round to nearest even, overflow to infinity and quiet NaNs, like F16C
+	entry const Tests[] = {
+		{0x3f800000, 0x3c00}, // 1
+		{0x3f801000, 0x3c00}, // 1 + 2^-11, tie to even
+		{0x3f801001, 0x3c01},
+		{0x3f803000, 0x3c02}, // tie to even, rounds up
+		{0x477fefff, 0x7bff}, // just below 65520
+		{0x477ff000, 0x7c00}, // 65520 rounds to infinity
+		{0x33000000, 0x0000}, // 2^-25, tie to zero
+		{0x33000001, 0x0001},
+		{0x33c00000, 0x0002}, // 3 * 2^-25, tie to even
+		{0x387fc000, 0x03ff}, // largest denormal
+		{0x387fe000, 0x0400}, // tie to even, rounds up to the smallest normal
+		{0x80000000, 0x8000}, // -0
+		{0xff800000, 0xfc00}, // -infinity
+		{0x7f800001, 0x7e00}, // signaling NaN is quieted
+		{0xff802000, 0xfe01}  // NaN keeps its sign and payload
+	};
+
+	for(std::size_t i = 0; i < sizeof(Tests) / sizeof(Tests[0]); ++i)
+	{
+		float const Value = float_bits(Tests[i].Float);
+		Error += glm::packHalf1x16(Value) == Tests[i].Half ? 0 : 1;
+		Error += (glm::packHalf2x16(glm::vec2(Value, 0.0f)) & 0xffff) == Tests[i].Half ? 0 : 1;
+		Error += (glm::packHalf4x16(glm::vec4(1.0f, 1.0f, 1.0f, Value)) >> 48) == Tests[i].Half ? 0 : 1;
+	}
+
+	Error += bits_float(glm::unpackHalf1x16(0x7c01)) == 0x7fc02000 ? 0 : 1;
+	Error += bits_float(glm::unpackHalf1x16(0x0001)) == 0x33800000 ? 0 : 1;
+	Error += bits_float(glm::unpackHalf2x16(0xfc000000).y) == 0xff800000 ? 0 : 1;
+
+	return Error;
+}
+
+int test_HalfArray()
+{
+	int Error = 0;
+
+	// Bulk conversions match the scalar conversions bit for bit
+	std::vector<float> Floats;
+	for(glm::uint32 i = 0; i < (1u << 20); ++i)
+	{
+		Floats.push_back(float_bits(i << 12));
+		Floats.push_back(float_bits((i << 12) | ((i * 0x9e3779b9u) >> 20)));
+	}
+
+	std::vector<glm::uint16> Halves(Floats.size());
+	glm::packHalf(&Floats[0], &Halves[0], Floats.size());
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+		Error += Halves[i] == static_cast<glm::uint16>(glm::detail::toFloat16(Floats[i])) ? 0 : 1;
+
+	std::vector<glm::uint16> AllHalves(1 << 16);
+	for(std::size_t i = 0; i < AllHalves.size(); ++i)
+		AllHalves[i] = static_cast<glm::uint16>(i);
+
+	std::vector<float> Unpacked(AllHalves.size());
+	glm::unpackHalf(&AllHalves[0], &Unpacked[0], AllHalves.size());
+	for(std::size_t i = 0; i < AllHalves.size(); ++i)
+		Error += bits_float(Unpacked[i]) == bits_float(glm::detail::toFloat32(static_cast<glm::detail::hdata>(AllHalves[i]))) ? 0 : 1;
+
+	// Every tail length
+	for(std::size_t Count = 0; Count < 20; ++Count)
+	{
+		std::vector<float> In(Count + 1, 7.0f);
+		std::vector<glm::uint16> Packed(Count + 1, 0xabcd);
+		std::vector<float> Out(Count + 1, 7.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = static_cast<float>(i) * 0.3f - 2.0f;
+
+		glm::packHalf(&In[0], &Packed[0], Count);
+		glm::unpackHalf(&Packed[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Packed[i] == glm::packHalf1x16(In[i]) ? 0 : 1;
+			Error += bits_float(Out[i]) == bits_float(glm::unpackHalf1x16(Packed[i])) ? 0 : 1;
+		}
+		Error += Packed[Count] == 0xabcd ? 0 : 1;
+		Error += Out[Count] == 7.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int test_I3x10_1x2()
 {
 	int Error = 0;
@@ -873,6 +981,8 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_Half4x16();
+	Error += test_HalfRounding();
+	Error += test_HalfArray();
 
 	return Error;
 }
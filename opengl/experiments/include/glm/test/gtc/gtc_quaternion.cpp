@@ -326,6 +326,100 @@ int test_identity()
 	return Error;
 }
 
+template<typename T>
+static int test_batch(std::size_t Count)
+{
+	typedef glm::qua<T, glm::defaultp> quatType;
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-6);
+
+	// Streams of x, y, z and w with a zero quaternion, nearly equal and opposite pairs mixed in
+	std::vector<T> X[4], Y[4], V[3], Out[4];
+	for(glm::length_t k = 0; k < 4; ++k)
+	{
+		X[k].resize(Count);
+		Y[k].resize(Count);
+		Out[k].resize(Count);
+	}
+	for(glm::length_t k = 0; k < 3; ++k)
+		V[k].resize(Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T const Angle = static_cast<T>(i) * static_cast<T>(0.37);
+		quatType A = glm::angleAxis(Angle, glm::normalize(vec3Type(glm::sin(Angle * 3), glm::cos(Angle * 5), static_cast<T>(0.5))));
+		quatType B = glm::angleAxis(Angle * static_cast<T>(1.7) + static_cast<T>(i % 3), glm::normalize(vec3Type(static_cast<T>(0.2), glm::sin(Angle), glm::cos(Angle * 2))));
+		if(i % 7 == 3)
+			B = -A;
+		else if(i % 7 == 5)
+			B = glm::normalize(A + quatType(static_cast<T>(1e-4), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+		if(i == 11)
+			A = B = quatType(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			X[k][i] = A[k];
+			Y[k][i] = B[k];
+		}
+		for(glm::length_t k = 0; k < 3; ++k)
+			V[k][i] = glm::sin(Angle * static_cast<T>(k + 2));
+	}
+
+	T const* const x[4] = {&X[0][0], &X[1][0], &X[2][0], &X[3][0]};
+	T const* const y[4] = {&Y[0][0], &Y[1][0], &Y[2][0], &Y[3][0]};
+	T const* const v[3] = {&V[0][0], &V[1][0], &V[2][0]};
+	T* const out[4] = {&Out[0][0], &Out[1][0], &Out[2][0], &Out[3][0]};
+
+	T const a = static_cast<T>(0.3);
+
+	glm::nlerp(x, y, a, out, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		quatType const A(X[3][i], X[0][i], X[1][i], X[2][i]);
+		quatType const B(Y[3][i], Y[0][i], Y[1][i], Y[2][i]);
+		quatType const Result(Out[3][i], Out[0][i], Out[1][i], Out[2][i]);
+		Error += glm::all(glm::equal(Result, glm::normalize(glm::lerp(A, glm::dot(A, B) < static_cast<T>(0) ? -B : B, a)), Epsilon)) ? 0 : 1;
+	}
+
+	glm::slerp(x, y, a, out, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		quatType const A(X[3][i], X[0][i], X[1][i], X[2][i]);
+		quatType const B(Y[3][i], Y[0][i], Y[1][i], Y[2][i]);
+		quatType const Result(Out[3][i], Out[0][i], Out[1][i], Out[2][i]);
+		Error += glm::all(glm::equal(Result, glm::slerp(A, B, a), Epsilon)) ? 0 : 1;
+	}
+
+	glm::rotate(x, v, out, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		quatType const A(X[3][i], X[0][i], X[1][i], X[2][i]);
+		vec3Type const Result(Out[0][i], Out[1][i], Out[2][i]);
+		Error += glm::all(glm::equal(Result, A * vec3Type(V[0][i], V[1][i], V[2][i]), Epsilon)) ? 0 : 1;
+	}
+
+	std::vector<glm::mat<4, 4, T, glm::defaultp> > Mat(Count, glm::mat<4, 4, T, glm::defaultp>(static_cast<T>(0)));
+	glm::mat4_cast(x, &Mat[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		quatType const A(X[3][i], X[0][i], X[1][i], X[2][i]);
+		Error += glm::all(glm::equal(Mat[i], glm::mat4_cast(A), Epsilon)) ? 0 : 1;
+	}
+
+	// In place
+	T* const inout[4] = {&X[0][0], &X[1][0], &X[2][0], &X[3][0]};
+	glm::nlerp(x, y, a, out, Count);
+	glm::nlerp(x, y, a, inout, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t k = 0; k < 4; ++k)
+		Error += glm::equal(X[k][i], Out[k][i], static_cast<T>(0)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -341,5 +435,12 @@ int main()
     Error += test_quat_slerp_spins();
 	Error += test_identity();
 
+	for(std::size_t Count = 1; Count < 20; ++Count)
+	{
+		Error += test_batch<float>(Count);
+		Error += test_batch<double>(Count);
+	}
+	Error += test_batch<float>(1000);
+
 	return Error;
 }
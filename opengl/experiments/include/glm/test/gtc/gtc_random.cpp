@@ -2,8 +2,10 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/type_precision.hpp>
+#include <vector>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
+#	include <random>
 #endif
 
 std::size_t const TestSamples = 10000;
@@ -322,6 +324,220 @@ int test_ballRand()
 
 	return Error;
 }
+// Replays a fixed sequence, to check which draws the integer linearRand rejects
+struct sequence_engine
+{
+	typedef glm::uint64 result_type;
+
+	static result_type min() { return 0; }
+	static result_type max() { return std::numeric_limits<result_type>::max(); }
+	result_type operator()() { return Values[Index++]; }
+
+	result_type Values[2];
+	std::size_t Index;
+};
+
+int test_engine()
+{
+	int Error = 0;
+
+	// Reference sequence of xoshiro256++ from the state {1, 2, 3, 4}
+	{
+		glm::xoshiro256pp Engine;
+		Engine.State[0] = 1;
+		Engine.State[1] = 2;
+		Engine.State[2] = 3;
+		Engine.State[3] = 4;
+
+		Error += Engine() == static_cast<glm::uint64>(41943041ull) ? 0 : 1;
+		Error += Engine() == static_cast<glm::uint64>(58720359ull) ? 0 : 1;
+		Error += Engine() == static_cast<glm::uint64>(3588806011781223ull) ? 0 : 1;
+		assert(!Error);
+	}
+
+	// Same seed, same sequence, the lanes of xoshiro256pp_x4 are jump() apart
+	{
+		glm::xoshiro256pp A(42);
+		glm::xoshiro256pp B(42);
+		glm::xoshiro256pp_x4 Lanes(42);
+
+		std::vector<glm::xoshiro256pp> Engines;
+		for(int l = 0; l < 4; ++l, B.jump())
+			Engines.push_back(B);
+
+		for(int i = 0; i < 100; ++i)
+		{
+			glm::uint64 Out[4];
+			Lanes.next(Out);
+			for(int l = 0; l < 4; ++l)
+				Error += Out[l] == Engines[l]() ? 0 : 1;
+		}
+
+		glm::xoshiro256pp C(42);
+		Error += A() == C() ? 0 : 1;
+		C.jump();
+		Error += A() != C() ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		glm::xoshiro256pp Engine(1);
+
+		glm::u8vec2 AMin(std::numeric_limits<glm::u8>::max());
+		glm::u8vec2 AMax(std::numeric_limits<glm::u8>::min());
+		glm::i64vec2 BMin(std::numeric_limits<glm::i64>::max());
+		glm::i64vec2 BMax(std::numeric_limits<glm::i64>::min());
+		float CMin = 2.0f;
+		float CMax = -2.0f;
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			glm::u8vec2 const A = glm::linearRand(glm::u8vec2(16), glm::u8vec2(32), Engine);
+			AMin = glm::min(AMin, A);
+			AMax = glm::max(AMax, A);
+
+			glm::i64vec2 const B = glm::linearRand(glm::i64vec2(-8), glm::i64vec2(8), Engine);
+			BMin = glm::min(BMin, B);
+			BMax = glm::max(BMax, B);
+
+			float const C = glm::linearRand(-1.0f, 1.0f, Engine);
+			CMin = glm::min(CMin, C);
+			CMax = glm::max(CMax, C);
+
+			double const D = glm::linearRand(0.0, 1.0, Engine);
+			Error += D >= 0.0 && D < 1.0 ? 0 : 1;
+		}
+
+		Error += glm::all(glm::equal(AMin, glm::u8vec2(16))) && glm::all(glm::equal(AMax, glm::u8vec2(32))) ? 0 : 1;
+		Error += glm::all(glm::equal(BMin, glm::i64vec2(-8))) && glm::all(glm::equal(BMax, glm::i64vec2(8))) ? 0 : 1;
+		Error += CMin >= -1.0f && CMin < -0.99f && CMax < 1.0f && CMax > 0.99f ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		glm::xoshiro256pp Engine(2);
+
+		double Sum = 0.0;
+		double SumSquare = 0.0;
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			double const A = glm::gaussRand(1.0, 1.0, Engine);
+			Sum += A;
+			SumSquare += (A - 1.0) * (A - 1.0);
+
+			Error += glm::epsilonEqual(glm::length(glm::circularRand(2.0f, Engine)), 2.0f, 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(glm::sphericalRand(3.0, Engine)), 3.0, 0.0001) ? 0 : 1;
+			Error += glm::length(glm::diskRand(2.0f, Engine)) <= 2.0f ? 0 : 1;
+			Error += glm::length(glm::ballRand(2.0, Engine)) <= 2.0 ? 0 : 1;
+		}
+
+		Error += glm::epsilonEqual(Sum / double(TestSamples), 1.0, 0.05) ? 0 : 1;
+		Error += glm::epsilonEqual(SumSquare / double(TestSamples), 1.0, 0.05) ? 0 : 1;
+		assert(!Error);
+	}
+
+	// Deviation is the standard deviation, the variance is its square
+	{
+		glm::xoshiro256pp Engine(5);
+
+		double SumSquare = 0.0;
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			double const A = glm::gaussRand(0.0, 2.0, Engine);
+			SumSquare += A * A;
+		}
+
+		Error += glm::epsilonEqual(SumSquare / double(TestSamples), 4.0, 0.2) ? 0 : 1;
+		assert(!Error);
+	}
+
+	// 2^64 % 3 == 1, so a draw of 0 is rejected to keep the three values equally likely
+	{
+		sequence_engine Engine;
+		Engine.Values[0] = 0;
+		Engine.Values[1] = 5;
+		Engine.Index = 0;
+
+		Error += glm::linearRand(glm::int32(10), glm::int32(12), Engine) == 12 ? 0 : 1;
+		Error += Engine.Index == 2 ? 0 : 1;
+		assert(!Error);
+	}
+
+#	if GLM_LANG & GLM_LANG_CXX0X_FLAG
+	{
+		std::mt19937 Engine(3);
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			glm::vec4 const A = glm::linearRand(glm::vec4(-1.0f), glm::vec4(1.0f), Engine);
+			Error += glm::all(glm::greaterThanEqual(A, glm::vec4(-1.0f))) && glm::all(glm::lessThan(A, glm::vec4(1.0f))) ? 0 : 1;
+		}
+		assert(!Error);
+	}
+#	endif
+
+	return Error;
+}
+
+int test_fillRand()
+{
+	int Error = 0;
+
+	// Odd count for the tail after the SIMD steps
+	std::size_t const Count = TestSamples + 5;
+
+	{
+		glm::xoshiro256pp_x4 Lanes(7);
+		glm::xoshiro256pp_x4 Reference(7);
+
+		std::vector<float> Values(Count);
+		glm::fillLinearRand(&Values[0], Count, -2.0f, 2.0f, Lanes);
+
+		float Mean = 0.0f;
+		for(std::size_t i = 0; i < Count; i += 8)
+		{
+			glm::uint64 Bits[4];
+			Reference.next(Bits);
+			for(std::size_t j = 0; j < 8 && i + j < Count; ++j)
+			{
+				glm::uint32 const Half = static_cast<glm::uint32>(Bits[j / 2] >> (j % 2 * 32));
+				float const Expected = -2.0f + static_cast<float>(Half >> 8) / 16777216.0f * 4.0f;
+				Error += glm::epsilonEqual(Values[i + j], Expected, 0.000001f) ? 0 : 1;
+				Error += Values[i + j] >= -2.0f && Values[i + j] < 2.0f ? 0 : 1;
+				Mean += Values[i + j];
+			}
+		}
+		Error += glm::abs(Mean / float(Count)) < 0.05f ? 0 : 1;
+
+		// The engine continues where the fill stopped
+		glm::uint64 A[4], B[4];
+		Lanes.next(A);
+		Reference.next(B);
+		Error += A[0] == B[0] && A[3] == B[3] ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		glm::xoshiro256pp_x4 Lanes(8);
+		std::vector<glm::vec3> Directions(Count, glm::vec3(0.0f));
+		glm::fillSphericalRand(&Directions[0], Count, 2.0f, Lanes);
+
+		glm::vec3 Mean(0.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(Directions[i]), 2.0f, 0.0001f) ? 0 : 1;
+			Mean += Directions[i];
+		}
+		Error += glm::all(glm::lessThan(glm::abs(Mean / float(Count)), glm::vec3(0.05f))) ? 0 : 1;
+
+		glm::xoshiro256pp Engine(8);
+		std::vector<glm::dvec3> DoubleDirections(Count, glm::dvec3(0.0));
+		glm::fillSphericalRand(&DoubleDirections[0], Count, 1.0, Engine);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::epsilonEqual(glm::length(DoubleDirections[i]), 1.0, 0.0001) ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -372,6 +588,8 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_engine();
+	Error += test_fillRand();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
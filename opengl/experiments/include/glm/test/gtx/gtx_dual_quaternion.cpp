@@ -5,6 +5,7 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <glm/vector_relational.hpp>
+#include <vector>
 #if GLM_HAS_TRIVIAL_QUERIES
 #	include <type_traits>
 #endif
@@ -190,6 +191,90 @@ int test_size()
 	return Error;
 }
 
+template<typename T>
+int test_skin(std::size_t Count)
+{
+	typedef glm::tdualquat<T, glm::defaultp> dualquatType;
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<4, T, glm::defaultp> vec4Type;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+
+	std::vector<dualquatType> Joints;
+	std::vector<glm::mat<3, 4, T, glm::defaultp> > Matrices;
+	for(int j = 0; j < 16; ++j)
+	{
+		glm::qua<T, glm::defaultp> const Rotation = glm::angleAxis(static_cast<T>(j) * static_cast<T>(0.7), glm::normalize(vec3Type(static_cast<T>(myfrand()), static_cast<T>(myfrand()), static_cast<T>(1))));
+		// Odd joints on the other hemisphere to check the sign flip
+		dualquatType const Joint(j % 2 ? -Rotation : Rotation, vec3Type(static_cast<T>(myfrand()), static_cast<T>(myfrand()), static_cast<T>(myfrand())) * static_cast<T>(4));
+		Joints.push_back(Joint);
+		Matrices.push_back(glm::mat3x4_cast(Joint));
+	}
+
+	std::vector<glm::ivec4> Indices(Count);
+	std::vector<vec4Type> Weights(Count);
+	std::vector<vec3Type> Positions(Count), Normals(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Indices[i] = glm::ivec4(myrand() % 16, myrand() % 16, myrand() % 16, myrand() % 16);
+		vec4Type const Weight(static_cast<T>(myrand() % 100 + 1), static_cast<T>(myrand() % 100), static_cast<T>(i % 3 ? myrand() % 50 : 0), static_cast<T>(0));
+		Weights[i] = Weight / (Weight.x + Weight.y + Weight.z + Weight.w);
+		Positions[i] = vec3Type(static_cast<T>(myfrand()), static_cast<T>(myfrand()), static_cast<T>(myfrand())) * static_cast<T>(10);
+		Normals[i] = glm::normalize(vec3Type(static_cast<T>(myfrand()), static_cast<T>(myfrand()), static_cast<T>(1)));
+	}
+
+	std::vector<vec3Type> OutPositions(Count), OutNormals(Count), Threaded(Count);
+
+	glm::skinDualQuat(&Joints[0], &Indices[0], &Weights[0], &Positions[0], &Normals[0], &OutPositions[0], &OutNormals[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		dualquatType const& Root = Joints[Indices[i][0]];
+		dualquatType Blend = Root * Weights[i][0];
+		for(glm::length_t k = 1; k < 4; ++k)
+		{
+			dualquatType const& Joint = Joints[Indices[i][k]];
+			Blend = Blend + Joint * (glm::dot(Joint.real, Root.real) < static_cast<T>(0) ? -Weights[i][k] : Weights[i][k]);
+		}
+		Blend = glm::normalize(Blend);
+
+		Error += glm::all(glm::epsilonEqual(OutPositions[i], Blend * Positions[i], Epsilon * static_cast<T>(10))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(OutNormals[i], Blend.real * Normals[i], Epsilon)) ? 0 : 1;
+	}
+
+	glm::skinDualQuat(&Joints[0], &Indices[0], &Weights[0], &Positions[0], static_cast<vec3Type const*>(0), &Threaded[0], static_cast<vec3Type*>(0), Count, 3);
+	Error += Threaded == OutPositions ? 0 : 1;
+
+	glm::skinLinear(&Matrices[0], &Indices[0], &Weights[0], &Positions[0], &Normals[0], &OutPositions[0], &OutNormals[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat<3, 4, T, glm::defaultp> Blend = Matrices[Indices[i][0]] * Weights[i][0];
+		for(glm::length_t k = 1; k < 4; ++k)
+			Blend = Blend + Matrices[Indices[i][k]] * Weights[i][k];
+
+		Error += glm::all(glm::epsilonEqual(OutPositions[i], vec4Type(Positions[i], static_cast<T>(1)) * Blend, Epsilon * static_cast<T>(10))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(OutNormals[i], glm::normalize(vec4Type(Normals[i], static_cast<T>(0)) * Blend), Epsilon)) ? 0 : 1;
+	}
+
+	glm::skinLinear(&Matrices[0], &Indices[0], &Weights[0], &Positions[0], static_cast<vec3Type const*>(0), &Threaded[0], static_cast<vec3Type*>(0), Count, 3);
+	Error += Threaded == OutPositions ? 0 : 1;
+
+	// A single joint moves the vertices rigidly with both methods
+	for(std::size_t i = 0; i < Count; ++i)
+		Weights[i] = vec4Type(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+	glm::skinDualQuat(&Joints[0], &Indices[0], &Weights[0], &Positions[0], &Normals[0], &OutPositions[0], &OutNormals[0], Count);
+	glm::skinLinear(&Matrices[0], &Indices[0], &Weights[0], &Positions[0], &Normals[0], &Threaded[0], &Normals[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::epsilonEqual(OutPositions[i], Joints[Indices[i][0]] * Positions[i], Epsilon * static_cast<T>(10))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(OutPositions[i], Threaded[i], Epsilon * static_cast<T>(10))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(OutNormals[i], Normals[i], Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -201,5 +286,12 @@ int main()
 	Error += test_mul();
 	Error += test_size();
 
+	for(std::size_t Count = 1; Count < 20; ++Count)
+	{
+		Error += test_skin<float>(Count);
+		Error += test_skin<double>(Count);
+	}
+	Error += test_skin<float>(1000);
+
 	return Error;
 }
@@ -0,0 +1,154 @@
+#include <glm/ext/batch_transform.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static void naive_points(glm::mat4 const& M, std::vector<glm::vec3> const& In, std::vector<glm::vec3>& Out)
+{
+	for(std::size_t i = 0, n = In.size(); i < n; ++i)
+		Out[i] = glm::vec3(M * glm::vec4(In[i], 1.0f));
+}
+
+static void naive_points(glm::mat4 const& M, std::vector<glm::vec4> const& In, std::vector<glm::vec4>& Out)
+{
+	for(std::size_t i = 0, n = In.size(); i < n; ++i)
+		Out[i] = M * In[i];
+}
+
+template<typename vecType>
+static int comp_points(glm::mat4 const& M, std::vector<vecType> const& In)
+{
+	int Error = 0;
+
+	std::vector<vecType> Naive(In.size());
+	std::vector<vecType> Batch(In.size());
+
+	clock_type::time_point const t0 = clock_type::now();
+	naive_points(M, In, Naive);
+	clock_type::time_point const t1 = clock_type::now();
+	glm::transformPoints(M, In.data(), Batch.data(), In.size());
+	clock_type::time_point const t2 = clock_type::now();
+
+	std::printf("- naive: %d us\n", elapsed(t0, t1));
+	std::printf("- batch: %d us\n", elapsed(t1, t2));
+
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += glm::all(glm::equal(Naive[i], Batch[i], 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int comp_streams(glm::mat4 const& M, std::vector<glm::vec3> const& In)
+{
+	int Error = 0;
+
+	std::size_t const Count = In.size();
+	std::vector<float> X(Count), Y(Count), Z(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		X[i] = In[i].x;
+		Y[i] = In[i].y;
+		Z[i] = In[i].z;
+	}
+
+	std::vector<float> NX(Count), NY(Count), NZ(Count);
+	std::vector<float> BX(Count), BY(Count), BZ(Count);
+
+	clock_type::time_point const t0 = clock_type::now();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec4 const P = M * glm::vec4(X[i], Y[i], Z[i], 1.0f);
+		NX[i] = P.x;
+		NY[i] = P.y;
+		NZ[i] = P.z;
+	}
+	clock_type::time_point const t1 = clock_type::now();
+	glm::transformPoints(M, X.data(), Y.data(), Z.data(), BX.data(), BY.data(), BZ.data(), Count);
+	clock_type::time_point const t2 = clock_type::now();
+
+	std::printf("- naive: %d us\n", elapsed(t0, t1));
+	std::printf("- batch: %d us\n", elapsed(t1, t2));
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(glm::vec3(NX[i], NY[i], NZ[i]), glm::vec3(BX[i], BY[i], BZ[i]), 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+#if defined(GLM_BATCH_TRANSFORM_AVX2)
+// The dispatch picks AVX2 when it can, time the SSE2 kernel against it
+static int comp_kernels(glm::mat4 const& M, std::vector<glm::vec3> const& In)
+{
+	int Error = 0;
+
+	if(!glm::detail::batch_transform_has_avx2())
+		return 0;
+
+	float Rows[16];
+	glm::detail::compute_batch_transform<float, glm::defaultp, true>::rows(M, 1.0f, Rows);
+
+	std::vector<glm::vec3> SSE(In.size());
+	std::vector<glm::vec3> AVX(In.size());
+	float const* Input = &In[0].x;
+
+	clock_type::time_point const t0 = clock_type::now();
+	glm::detail::batch_transform_aos3_sse<true>(Rows, Input, &SSE[0].x, In.size());
+	clock_type::time_point const t1 = clock_type::now();
+	glm::detail::batch_transform_aos3_avx2<true>(Rows, Input, &AVX[0].x, In.size());
+	clock_type::time_point const t2 = clock_type::now();
+
+	std::printf("- SSE2: %d us\n", elapsed(t0, t1));
+	std::printf("- AVX2: %d us\n", elapsed(t1, t2));
+
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += SSE[i] == AVX[i] ? 0 : 1;
+
+	return Error;
+}
+#endif
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	int Error = 0;
+
+	glm::mat4 M = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f));
+	M = glm::rotate(M, 0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+	std::vector<glm::vec3> Points(Samples);
+	std::vector<glm::vec4> Points4(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Points[i] = glm::vec3(static_cast<float>(i % 1000), static_cast<float>(i % 333), static_cast<float>(i % 77)) * 0.01f;
+		Points4[i] = glm::vec4(Points[i], 1.0f);
+	}
+
+	std::printf("mat4 * vec3 points:\n");
+	Error += comp_points(M, Points);
+
+	std::printf("mat4 * vec4 points:\n");
+	Error += comp_points(M, Points4);
+
+	std::printf("mat4 * x, y, z streams:\n");
+	Error += comp_streams(M, Points);
+
+#	if defined(GLM_BATCH_TRANSFORM_AVX2)
+		std::printf("vec3 points kernels:\n");
+		Error += comp_kernels(M, Points);
+#	endif
+
+	return Error;
+}
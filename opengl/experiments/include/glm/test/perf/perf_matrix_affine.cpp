@@ -0,0 +1,122 @@
+#include <glm/ext/matrix_affine.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_float3x4.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+// A scene graph where every node has a parent earlier in the array, each frame computes the
+// world transforms and writes them to the instance buffer uploaded to the GPU
+std::size_t const Nodes = 1 << 16;
+int const Frames = 50;
+
+template<typename matType>
+struct scene
+{
+	std::vector<std::size_t> Parents;
+	std::vector<matType> Locals;
+	std::vector<matType> Worlds;
+	std::vector<char> Instances;
+};
+
+static glm::mat4 make_local(std::size_t i)
+{
+	float const a = static_cast<float>(i);
+	glm::mat4 Result = glm::translate(glm::mat4(1.0f), glm::vec3(glm::sin(a), 0.5f, glm::cos(a)));
+	Result = glm::rotate(Result, a * 0.001f, glm::vec3(0.2f, 1.0f, 0.1f));
+	return glm::scale(Result, glm::vec3(1.0f + 1e-6f * a));
+}
+
+template<typename matType>
+static void init(scene<matType>& Scene, matType (*Convert)(glm::mat4 const&))
+{
+	Scene.Parents.resize(Nodes);
+	Scene.Locals.resize(Nodes);
+	Scene.Worlds.resize(Nodes);
+	Scene.Instances.resize(Nodes * sizeof(matType));
+	for(std::size_t i = 0; i < Nodes; ++i)
+	{
+		Scene.Parents[i] = i == 0 ? 0 : (i * 7919) % i;
+		Scene.Locals[i] = Convert(make_local(i));
+	}
+}
+
+static glm::mat4 identity_mat4(glm::mat4 const& m)
+{
+	return m;
+}
+
+static glm::mat3x4 to_affine(glm::mat4 const& m)
+{
+	return glm::mat3x4_cast(m);
+}
+
+static glm::mat4 compose(glm::mat4 const& a, glm::mat4 const& b)
+{
+	return a * b;
+}
+
+static glm::mat3x4 compose(glm::mat3x4 const& a, glm::mat3x4 const& b)
+{
+	return glm::affineCompose(a, b);
+}
+
+template<typename matType>
+static void update_hierarchy(scene<matType>& Scene)
+{
+	Scene.Worlds[0] = Scene.Locals[0];
+	for(std::size_t i = 1; i < Nodes; ++i)
+		Scene.Worlds[i] = compose(Scene.Worlds[Scene.Parents[i]], Scene.Locals[i]);
+}
+
+template<typename matType>
+static void upload(scene<matType>& Scene)
+{
+	std::memcpy(&Scene.Instances[0], &Scene.Worlds[0], Scene.Instances.size());
+}
+
+// Prints the time per frame of Func and returns it in milliseconds
+template<typename matType>
+static double perf(void (*Func)(scene<matType>&), scene<matType>& Scene, char const* Message)
+{
+	clock_type::time_point const t0 = clock_type::now();
+	for(int f = 0; f < Frames; ++f)
+		Func(Scene);
+	clock_type::time_point const t1 = clock_type::now();
+
+	double const Milliseconds = std::chrono::duration_cast<std::chrono::duration<double, std::milli> >(t1 - t0).count() / Frames;
+	std::printf("- %s: %.3f ms\n", Message, Milliseconds);
+	return Milliseconds;
+}
+
+int main()
+{
+	int Error = 0;
+
+	scene<glm::mat4> Scene4;
+	scene<glm::mat3x4> Scene3x4;
+	init(Scene4, identity_mat4);
+	init(Scene3x4, to_affine);
+
+	std::printf("%d nodes, world transforms:\n", static_cast<int>(Nodes));
+	perf(update_hierarchy<glm::mat4>, Scene4, "mat4 operator*");
+	perf(update_hierarchy<glm::mat3x4>, Scene3x4, "mat3x4 affineCompose");
+
+	for(std::size_t i = 0; i < Nodes; i += 997)
+		Error += glm::all(glm::equal(glm::mat4_cast(Scene3x4.Worlds[i]), Scene4.Worlds[i], 0.001f)) ? 0 : 1;
+
+	std::printf("%d nodes, instance buffer write:\n", static_cast<int>(Nodes));
+	std::printf("- mat4: %d KB\n", static_cast<int>(Scene4.Instances.size() / 1024));
+	std::printf("- mat3x4: %d KB\n", static_cast<int>(Scene3x4.Instances.size() / 1024));
+	perf(upload<glm::mat4>, Scene4, "mat4 copy");
+	perf(upload<glm::mat3x4>, Scene3x4, "mat3x4 copy");
+
+	Error += Scene3x4.Instances.size() * 4 == Scene4.Instances.size() * 3 ? 0 : 1;
+
+	return Error;
+}
@@ -3,9 +3,11 @@
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
 #include <vector>
 #include <chrono>
 #include <cstdio>
@@ -113,6 +115,60 @@ static int comp_mat4_inverse(std::size_t Samples)
 	return Error;
 }
 
+template <typename matType>
+static int launch_mat_batch(std::vector<matType> const& I, std::vector<matType>& O, void (*Func)(matType const*, matType*, std::size_t))
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Func(&I[0], &O[0], I.size());
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+// The batch kernels over the whole array against one SIMD glm::inverse call per matrix
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_batch(std::size_t Samples)
+{
+	typedef typename packedMatType::value_type T;
+
+	int Error = 0;
+
+	packedMatType const Scale(0.01, 0.02, 0.05, 0.04, 0.02, 0.08, 0.05, 0.01, 0.08, 0.03, 0.05, 0.06, 0.02, 0.03, 0.07, 0.05);
+
+	std::vector<alignedMatType> SIMD;
+	std::printf("- SIMD per matrix: %d us\n", launch_mat_inverse<alignedMatType>(SIMD, Scale, Samples));
+
+	std::vector<packedMatType> I(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<T>(i) + Scale;
+
+	std::vector<packedMatType> Inverse;
+	std::printf("- Batch inverse: %d us\n", launch_mat_batch<packedMatType>(I, Inverse, glm::inverse));
+
+	std::vector<packedMatType> InverseTranspose;
+	std::printf("- Batch inverseTranspose: %d us\n", launch_mat_batch<packedMatType>(I, InverseTranspose, glm::inverseTranspose));
+
+	std::vector<T> Determinant(Samples);
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	glm::determinant(&I[0], &Determinant[0], Samples);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+	std::printf("- Batch determinant: %d us\n", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count()));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedMatType const A = SIMD[i];
+		Error += glm::all(glm::equal(A, Inverse[i], static_cast<T>(0.001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::transpose(A), InverseTranspose[i], static_cast<T>(0.001))) ? 0 : 1;
+		T const D = glm::determinant(I[i]);
+		Error += glm::equal(D, Determinant[i], glm::abs(D) * static_cast<T>(0.001)) ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
 int main()
 {
 	std::size_t const Samples = 100000;
@@ -137,6 +193,9 @@ int main()
 	std::printf("glm::inverse(dmat4):\n");
 	Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Samples);
 
+	std::printf("glm::inverse(mat4 const*, mat4*, size_t):\n");
+	Error += comp_mat4_batch<glm::mat4, glm::aligned_mat4>(Samples);
+
 	return Error;
 }
 
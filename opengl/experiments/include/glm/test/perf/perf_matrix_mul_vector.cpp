@@ -94,8 +94,6 @@ static int comp_mat3_mul_vec3(std::size_t Samples)
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
 static int comp_mat4_mul_vec4(std::size_t Samples)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
@@ -111,7 +109,9 @@ static int comp_mat4_mul_vec4(std::size_t Samples)
 	{
 		packedVecType const A = SISD[i];
 		packedVecType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		// the products reach 1e5 where a float step is already 0.01, FMA
+		// kernels round once less than the generic code so compare in ULPs
+		Error += glm::all(glm::equal(A, B, 4)) ? 0 : 1;
 	}
 	
 	return Error;
@@ -0,0 +1,133 @@
+#include <glm/gtc/noise.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_int2.hpp>
+#include <glm/ext/vector_int3.hpp>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cfloat>
+
+// The documented bound, with slack for positions rounded once or twice under excess precision (x87)
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+	float const Bound = 1e-5f;
+#else
+	float const Bound = 1e-4f;
+#endif
+
+// With FMA contraction, perlin(vec3) may round gz to the other side of 0 where it is exactly 0, those samples use
+// another gradient than the batch functions, see gtc_noise. Up to one sample in ten per octave may do so.
+#if defined(__FMA__)
+#	define PERF_NOISE_FMA_TIES 10
+#endif
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+int const Octaves = 4;
+
+// Writes the grid with a loop over the scalar function, the reference for the batch functions
+template<bool Simplex, typename vecType, typename ivecType>
+static void scalar_grid(vecType const& Origin, vecType const& Step, ivecType const& Size, float* Out)
+{
+	int const Depth = ivecType::length() > 2 ? Size[ivecType::length() - 1] : 1;
+	std::size_t i = 0;
+	for(int z = 0; z < Depth; ++z)
+	for(int y = 0; y < Size.y; ++y)
+	for(int x = 0; x < Size.x; ++x, ++i)
+	{
+		vecType Index(static_cast<float>(x));
+		Index[1] = static_cast<float>(y);
+		if(ivecType::length() > 2)
+			Index[ivecType::length() - 1] = static_cast<float>(z);
+		vecType const Position = Origin + Step * Index;
+
+		float Sum = 0.0f;
+		float Frequency = 1.0f;
+		float Amplitude = 1.0f;
+		for(int o = 0; o < Octaves; ++o)
+		{
+			Sum += Amplitude * (Simplex ? glm::simplex(Position * Frequency) : glm::perlin(Position * Frequency));
+			Frequency *= 2.0f;
+			Amplitude *= 0.5f;
+		}
+		Out[i] = Sum;
+	}
+}
+
+template<bool Simplex, typename vecType, typename ivecType>
+static void batch_grid(vecType const& Origin, vecType const& Step, ivecType const& Size, float* Out, unsigned Threads)
+{
+	if(Simplex)
+		glm::simplexGrid(Origin, Step, Size, Out, Octaves, 2.0f, 0.5f, Threads);
+	else
+		glm::perlinGrid(Origin, Step, Size, Out, Octaves, 2.0f, 0.5f, Threads);
+}
+
+// Prints the noise samples per second, counting each octave as a sample, and returns the error count against Ref
+template<bool Simplex, typename vecType, typename ivecType>
+static int perf(ivecType const& Size, unsigned Threads, std::vector<float> const& Ref, char const* Message)
+{
+	vecType const Origin(-7.5f);
+	vecType const Step(0.013f);
+
+	std::vector<float> Out(Ref.size(), 0.0f);
+
+	clock_type::time_point const t0 = clock_type::now();
+	if(Threads == 0)
+		scalar_grid<Simplex>(Origin, Step, Size, &Out[0]);
+	else
+		batch_grid<Simplex>(Origin, Step, Size, &Out[0], Threads);
+	clock_type::time_point const t1 = clock_type::now();
+
+	double const Seconds = std::chrono::duration_cast<std::chrono::duration<double> >(t1 - t0).count();
+	std::printf("- %s: %.1f M samples/s\n", Message, static_cast<double>(Out.size()) * Octaves / Seconds * 1e-6);
+
+	// Every fBm sum must stay within Bound of the scalar loop, but for the FMA ties of 3D perlin
+	std::size_t Mismatch = 0;
+	for(std::size_t i = 0; i < Out.size(); ++i)
+		Mismatch += glm::abs(Out[i] - Ref[i]) > Bound ? 1 : 0;
+	std::size_t Ties = 0;
+#	if defined(PERF_NOISE_FMA_TIES)
+		if(!Simplex && ivecType::length() == 3)
+			Ties = Out.size() * Octaves / PERF_NOISE_FMA_TIES;
+#	endif
+	if(Mismatch > 0)
+		std::printf("  %lu samples past the bound, %lu allowed\n", static_cast<unsigned long>(Mismatch), static_cast<unsigned long>(Ties));
+	return Mismatch <= Ties ? 0 : 1;
+}
+
+template<bool Simplex, typename vecType, typename ivecType>
+static int perf_grid(ivecType const& Size, unsigned Threads, char const* Name)
+{
+	int Error = 0;
+
+	std::size_t Count = static_cast<std::size_t>(Size.x * Size.y);
+	if(ivecType::length() > 2)
+		Count *= static_cast<std::size_t>(Size[ivecType::length() - 1]);
+
+	std::vector<float> Ref(Count, 0.0f);
+	scalar_grid<Simplex>(vecType(-7.5f), vecType(0.013f), Size, &Ref[0]);
+
+	std::printf("%s:\n", Name);
+	Error += perf<Simplex, vecType>(Size, 0, Ref, "scalar loop");
+	Error += perf<Simplex, vecType>(Size, 1, Ref, "batch grid, 1 thread");
+	Error += perf<Simplex, vecType>(Size, Threads, Ref, "batch grid, all threads");
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	unsigned const Threads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+
+	Error += perf_grid<false, glm::vec2>(glm::ivec2(1024, 1024), Threads, "perlin 1024x1024 heightmap, 4 octaves");
+	Error += perf_grid<true, glm::vec2>(glm::ivec2(1024, 1024), Threads, "simplex 1024x1024 heightmap, 4 octaves");
+	Error += perf_grid<false, glm::vec3>(glm::ivec3(128, 128, 128), Threads, "perlin 128x128x128 volume, 4 octaves");
+	Error += perf_grid<true, glm::vec3>(glm::ivec3(128, 128, 128), Threads, "simplex 128x128x128 volume, 4 octaves");
+
+	return Error;
+}
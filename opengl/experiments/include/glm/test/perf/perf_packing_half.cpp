@@ -0,0 +1,83 @@
+#include <glm/gtc/packing.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+// A vertex buffer of positions, normals and texture coordinates converted to fp16 for upload
+std::size_t const Values = 1 << 22;
+int const Runs = 10;
+
+static void pack_scalar(std::vector<float> const& In, std::vector<glm::uint16>& Out)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Out[i] = static_cast<glm::uint16>(glm::detail::toFloat16(In[i]));
+}
+
+static void unpack_scalar(std::vector<glm::uint16> const& In, std::vector<float>& Out)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Out[i] = glm::detail::toFloat32(static_cast<glm::detail::hdata>(In[i]));
+}
+
+static void pack_half4x16(std::vector<float> const& In, std::vector<glm::uint16>& Out)
+{
+	for(std::size_t i = 0; i < In.size(); i += 4)
+	{
+		glm::uint64 const Packed = glm::packHalf4x16(glm::vec4(In[i + 0], In[i + 1], In[i + 2], In[i + 3]));
+		for(std::size_t j = 0; j < 4; ++j)
+			Out[i + j] = static_cast<glm::uint16>(Packed >> (j * 16));
+	}
+}
+
+static void pack_array(std::vector<float> const& In, std::vector<glm::uint16>& Out)
+{
+	glm::packHalf(&In[0], &Out[0], In.size());
+}
+
+static void unpack_array(std::vector<glm::uint16> const& In, std::vector<float>& Out)
+{
+	glm::unpackHalf(&In[0], &Out[0], In.size());
+}
+
+// Prints the values per nanosecond of Func over all the runs
+template<typename inType, typename outType>
+static void perf(void (*Func)(std::vector<inType> const&, std::vector<outType>&), std::vector<inType> const& In, std::vector<outType>& Out, char const* Message)
+{
+	clock_type::time_point const t0 = clock_type::now();
+	for(int r = 0; r < Runs; ++r)
+		Func(In, Out);
+	clock_type::time_point const t1 = clock_type::now();
+
+	double const Nanoseconds = std::chrono::duration_cast<std::chrono::duration<double, std::nano> >(t1 - t0).count();
+	std::printf("- %s: %.2f values/ns\n", Message, static_cast<double>(Values) * Runs / Nanoseconds);
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::vector<float> Floats(Values);
+	for(std::size_t i = 0; i < Values; ++i)
+		Floats[i] = glm::sin(static_cast<float>(i) * 0.001f) * static_cast<float>(i % 1000);
+
+	std::vector<glm::uint16> Reference(Values);
+	std::vector<glm::uint16> Halves(Values);
+	std::vector<float> Unpacked(Values);
+	std::vector<float> UnpackedReference(Values);
+
+	std::printf("%d floats to half:\n", static_cast<int>(Values));
+	perf(pack_scalar, Floats, Reference, "scalar detail::toFloat16");
+	perf(pack_half4x16, Floats, Halves, "packHalf4x16");
+	Error += Halves == Reference ? 0 : 1;
+	perf(pack_array, Floats, Halves, "packHalf array");
+	Error += Halves == Reference ? 0 : 1;
+
+	std::printf("%d halves to float:\n", static_cast<int>(Values));
+	perf(unpack_scalar, Reference, UnpackedReference, "scalar detail::toFloat32");
+	perf(unpack_array, Reference, Unpacked, "unpackHalf array");
+	Error += Unpacked == UnpackedReference ? 0 : 1;
+
+	return Error;
+}
@@ -0,0 +1,117 @@
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/quaternion_float.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+// Joints of a crowd of characters, each frame blends two poses and builds the joint matrices
+std::size_t const Joints = 1 << 16;
+int const Frames = 50;
+
+struct pose
+{
+	std::vector<float> Stream[4];
+
+	explicit pose(float Offset)
+	{
+		for(glm::length_t k = 0; k < 4; ++k)
+			Stream[k].resize(Joints);
+
+		for(std::size_t i = 0; i < Joints; ++i)
+		{
+			float const Angle = static_cast<float>(i) * 0.013f + Offset;
+			glm::quat const Q = glm::angleAxis(Angle, glm::normalize(glm::vec3(glm::sin(Angle), glm::cos(Angle * 3.0f), 0.5f)));
+			for(glm::length_t k = 0; k < 4; ++k)
+				Stream[k][i] = Q[k];
+		}
+	}
+
+	glm::quat get(std::size_t i) const
+	{
+		return glm::quat(Stream[3][i], Stream[0][i], Stream[1][i], Stream[2][i]);
+	}
+};
+
+static void blend_scalar(pose const& A, pose const& B, float a, std::vector<glm::mat4>& Out)
+{
+	for(std::size_t i = 0; i < Joints; ++i)
+		Out[i] = glm::mat4_cast(glm::slerp(A.get(i), B.get(i), a));
+}
+
+template<bool Slerp>
+static void blend_batch(pose const& A, pose const& B, float a, pose& Blend, std::vector<glm::mat4>& Out)
+{
+	float const* const x[4] = {&A.Stream[0][0], &A.Stream[1][0], &A.Stream[2][0], &A.Stream[3][0]};
+	float const* const y[4] = {&B.Stream[0][0], &B.Stream[1][0], &B.Stream[2][0], &B.Stream[3][0]};
+	float* const q[4] = {&Blend.Stream[0][0], &Blend.Stream[1][0], &Blend.Stream[2][0], &Blend.Stream[3][0]};
+
+	if(Slerp)
+		glm::slerp(x, y, a, q, Joints);
+	else
+		glm::nlerp(x, y, a, q, Joints);
+	glm::mat4_cast(q, &Out[0], Joints);
+}
+
+// Prints the joints per microsecond of Func over all the frames and returns the checksum of the last frame
+template<typename genFunc>
+static float perf(genFunc const& Func, std::vector<glm::mat4>& Out, char const* Message)
+{
+	clock_type::time_point const t0 = clock_type::now();
+	for(int f = 0; f < Frames; ++f)
+		Func(static_cast<float>(f) / static_cast<float>(Frames));
+	clock_type::time_point const t1 = clock_type::now();
+
+	double const Microseconds = std::chrono::duration_cast<std::chrono::duration<double, std::micro> >(t1 - t0).count();
+	std::printf("- %s: %.1f joints/us\n", Message, static_cast<double>(Joints) * Frames / Microseconds);
+
+	float Sum = 0.0f;
+	for(std::size_t i = 0; i < Out.size(); ++i)
+		Sum += Out[i][0][0] + Out[i][1][1] + Out[i][2][2];
+	return Sum;
+}
+
+struct run_scalar
+{
+	pose const& A;
+	pose const& B;
+	std::vector<glm::mat4>& Out;
+
+	run_scalar(pose const& a, pose const& b, std::vector<glm::mat4>& out) : A(a), B(b), Out(out) {}
+	void operator()(float a) const { blend_scalar(A, B, a, Out); }
+};
+
+template<bool Slerp>
+struct run_batch
+{
+	pose const& A;
+	pose const& B;
+	pose& Blend;
+	std::vector<glm::mat4>& Out;
+
+	run_batch(pose const& a, pose const& b, pose& blend, std::vector<glm::mat4>& out) : A(a), B(b), Blend(blend), Out(out) {}
+	void operator()(float a) const { blend_batch<Slerp>(A, B, a, Blend, Out); }
+};
+
+int main()
+{
+	int Error = 0;
+
+	pose const A(0.0f);
+	pose const B(1.3f);
+	pose Blend(0.0f);
+	std::vector<glm::mat4> Out(Joints);
+
+	std::printf("%d joints, pose blend and mat4_cast:\n", static_cast<int>(Joints));
+	float const Scalar = perf(run_scalar(A, B, Out), Out, "per joint glm::slerp + glm::mat4_cast");
+	float const Slerp = perf(run_batch<true>(A, B, Blend, Out), Out, "batch slerp + mat4_cast");
+	float const Nlerp = perf(run_batch<false>(A, B, Blend, Out), Out, "batch nlerp + mat4_cast");
+
+	// The batch slerp approximates acos and sin, nlerp moves at another speed between the poses
+	Error += glm::abs(Scalar - Slerp) < static_cast<float>(Joints) * 1e-5f ? 0 : 1;
+	Error += glm::abs(Scalar - Nlerp) < static_cast<float>(Joints) * 0.05f ? 0 : 1;
+
+	return Error;
+}
@@ -0,0 +1,145 @@
+#include <glm/gtc/random.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+std::size_t const Samples = 1 << 20;
+
+// Each run writes Samples floats or directions and returns the error count
+struct linear_rand
+{
+	int operator()(unsigned Seed) const
+	{
+		(void)Seed;
+		std::vector<float> Out(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+			Out[i] = glm::linearRand(-1.0f, 1.0f);
+		return check(Out);
+	}
+
+	static int check(std::vector<float> const& Out)
+	{
+		int Error = 0;
+		for(std::size_t i = 0; i < Out.size(); ++i)
+			Error += Out[i] >= -1.0f && Out[i] <= 1.0f ? 0 : 1;
+		return Error;
+	}
+};
+
+struct linear_rand_engine
+{
+	int operator()(unsigned Seed) const
+	{
+		glm::xoshiro256pp Engine(Seed);
+		std::vector<float> Out(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+			Out[i] = glm::linearRand(-1.0f, 1.0f, Engine);
+		return linear_rand::check(Out);
+	}
+};
+
+struct linear_rand_fill
+{
+	int operator()(unsigned Seed) const
+	{
+		glm::xoshiro256pp_x4 Engine(Seed);
+		std::vector<float> Out(Samples);
+		glm::fillLinearRand(&Out[0], Samples, -1.0f, 1.0f, Engine);
+		return linear_rand::check(Out);
+	}
+};
+
+struct spherical_rand
+{
+	int operator()(unsigned Seed) const
+	{
+		(void)Seed;
+		std::vector<glm::vec3> Out(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+			Out[i] = glm::sphericalRand(1.0f);
+		return check(Out);
+	}
+
+	static int check(std::vector<glm::vec3> const& Out)
+	{
+		int Error = 0;
+		for(std::size_t i = 0; i < Out.size(); ++i)
+			Error += glm::abs(glm::length(Out[i]) - 1.0f) < 0.0001f ? 0 : 1;
+		return Error;
+	}
+};
+
+struct spherical_rand_engine
+{
+	int operator()(unsigned Seed) const
+	{
+		glm::xoshiro256pp Engine(Seed);
+		std::vector<glm::vec3> Out(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+			Out[i] = glm::sphericalRand(1.0f, Engine);
+		return spherical_rand::check(Out);
+	}
+};
+
+struct spherical_rand_fill
+{
+	int operator()(unsigned Seed) const
+	{
+		glm::xoshiro256pp_x4 Engine(Seed);
+		std::vector<glm::vec3> Out(Samples);
+		glm::fillSphericalRand(&Out[0], Samples, 1.0f, Engine);
+		return spherical_rand::check(Out);
+	}
+};
+
+// Runs Func on Threads threads at once and prints the samples per second of all the threads
+template<typename genFunc>
+static int perf(genFunc const& Func, unsigned Threads, char const* Message)
+{
+	std::vector<int> Errors(Threads, 0);
+	std::vector<std::thread> Workers;
+
+	clock_type::time_point const t0 = clock_type::now();
+	for(unsigned t = 0; t < Threads; ++t)
+		Workers.push_back(std::thread([&Func, &Errors, t]() { Errors[t] = Func(t + 1); }));
+	for(unsigned t = 0; t < Threads; ++t)
+		Workers[t].join();
+	clock_type::time_point const t1 = clock_type::now();
+
+	double const Seconds = std::chrono::duration_cast<std::chrono::duration<double> >(t1 - t0).count();
+	std::printf("- %s, %u thread(s): %.1f M samples/s\n", Message, Threads, static_cast<double>(Samples) * Threads / Seconds * 1e-6);
+
+	int Error = 0;
+	for(unsigned t = 0; t < Threads; ++t)
+		Error += Errors[t];
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	unsigned const Threads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+	unsigned const Counts[] = {1, Threads};
+
+	for(std::size_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); ++i)
+	{
+		std::printf("linearRand:\n");
+		Error += perf(linear_rand(), Counts[i], "std::rand");
+		Error += perf(linear_rand_engine(), Counts[i], "xoshiro256pp");
+		Error += perf(linear_rand_fill(), Counts[i], "fillLinearRand xoshiro256pp_x4");
+
+		std::printf("sphericalRand:\n");
+		Error += perf(spherical_rand(), Counts[i], "std::rand");
+		Error += perf(spherical_rand_engine(), Counts[i], "xoshiro256pp");
+		Error += perf(spherical_rand_fill(), Counts[i], "fillSphericalRand xoshiro256pp_x4");
+	}
+
+	return Error;
+}
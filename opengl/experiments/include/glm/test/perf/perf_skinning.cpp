@@ -0,0 +1,118 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/dual_quaternion.hpp>
+#include <glm/ext/vector_int4.hpp>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+std::size_t const Vertices = 100000;
+int const Joints = 64;
+int const Frames = 20;
+
+struct mesh
+{
+	std::vector<glm::dualquat> DualQuats;
+	std::vector<glm::mat3x4> Matrices;
+	std::vector<glm::ivec4> Indices;
+	std::vector<glm::vec4> Weights;
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::vec3> Normals;
+	std::vector<glm::vec3> OutPositions;
+	std::vector<glm::vec3> OutNormals;
+
+	mesh() :
+		Indices(Vertices), Weights(Vertices), Positions(Vertices), Normals(Vertices), OutPositions(Vertices), OutNormals(Vertices)
+	{
+		for(int j = 0; j < Joints; ++j)
+		{
+			float const Angle = static_cast<float>(j) * 0.1f;
+			glm::dualquat const Joint(glm::angleAxis(Angle, glm::normalize(glm::vec3(glm::sin(Angle), glm::cos(Angle), 1.0f))), glm::vec3(0.0f, static_cast<float>(j) * 0.05f, 0.0f));
+			DualQuats.push_back(Joint);
+			Matrices.push_back(glm::mat3x4_cast(Joint));
+		}
+
+		for(std::size_t i = 0; i < Vertices; ++i)
+		{
+			float const t = static_cast<float>(i) / static_cast<float>(Vertices);
+			int const Joint = static_cast<int>(t * (Joints - 1));
+			Indices[i] = glm::ivec4(Joint, Joint + 1, (Joint + 7) % Joints, (Joint + 13) % Joints);
+			Weights[i] = glm::vec4(0.5f, 0.3f, 0.15f, 0.05f);
+			Positions[i] = glm::vec3(glm::sin(t * 100.0f), t * 3.0f, glm::cos(t * 100.0f));
+			Normals[i] = glm::normalize(glm::vec3(glm::sin(t * 100.0f), 0.1f, glm::cos(t * 100.0f)));
+		}
+	}
+};
+
+static void skin_naive(mesh& Mesh)
+{
+	for(std::size_t i = 0; i < Vertices; ++i)
+	{
+		glm::dualquat Blend = Mesh.DualQuats[Mesh.Indices[i][0]] * Mesh.Weights[i][0];
+		for(glm::length_t k = 1; k < 4; ++k)
+		{
+			glm::dualquat const& Joint = Mesh.DualQuats[Mesh.Indices[i][k]];
+			Blend = Blend + Joint * (glm::dot(Joint.real, Mesh.DualQuats[Mesh.Indices[i][0]].real) < 0.0f ? -Mesh.Weights[i][k] : Mesh.Weights[i][k]);
+		}
+		Blend = glm::normalize(Blend);
+		Mesh.OutPositions[i] = Blend * Mesh.Positions[i];
+		Mesh.OutNormals[i] = Blend.real * Mesh.Normals[i];
+	}
+}
+
+static void skin_dual_quat(mesh& Mesh, unsigned Threads)
+{
+	glm::skinDualQuat(&Mesh.DualQuats[0], &Mesh.Indices[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &Mesh.OutPositions[0], &Mesh.OutNormals[0], Vertices, Threads);
+}
+
+static void skin_linear(mesh& Mesh, unsigned Threads)
+{
+	glm::skinLinear(&Mesh.Matrices[0], &Mesh.Indices[0], &Mesh.Weights[0], &Mesh.Positions[0], &Mesh.Normals[0], &Mesh.OutPositions[0], &Mesh.OutNormals[0], Vertices, Threads);
+}
+
+// Prints the vertices per second and returns the error count of the skinned positions against Ref
+static int perf(mesh& Mesh, void (*Skin)(mesh&, unsigned), unsigned Threads, std::vector<glm::vec3> const& Ref, char const* Message)
+{
+	clock_type::time_point const t0 = clock_type::now();
+	for(int f = 0; f < Frames; ++f)
+		Skin(Mesh, Threads);
+	clock_type::time_point const t1 = clock_type::now();
+
+	double const Seconds = std::chrono::duration_cast<std::chrono::duration<double> >(t1 - t0).count();
+	std::printf("- %s, %u thread(s): %.1f M vertices/s\n", Message, Threads, static_cast<double>(Vertices) * Frames / Seconds * 1e-6);
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Vertices; ++i)
+		Error += glm::all(glm::lessThan(glm::abs(Mesh.OutPositions[i] - Ref[i]), glm::vec3(0.001f))) ? 0 : 1;
+	return Error;
+}
+
+static void naive(mesh& Mesh, unsigned)
+{
+	skin_naive(Mesh);
+}
+
+int main()
+{
+	int Error = 0;
+
+	mesh Mesh;
+	unsigned const Threads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+
+	skin_naive(Mesh);
+	std::vector<glm::vec3> const DualQuatRef(Mesh.OutPositions);
+	skin_linear(Mesh, 1);
+	std::vector<glm::vec3> const LinearRef(Mesh.OutPositions);
+
+	std::printf("%d vertices, %d joints, 4 influences:\n", static_cast<int>(Vertices), Joints);
+	Error += perf(Mesh, naive, 1, DualQuatRef, "per vertex tdualquat operators");
+	Error += perf(Mesh, skin_dual_quat, 1, DualQuatRef, "skinDualQuat");
+	Error += perf(Mesh, skin_dual_quat, Threads, DualQuatRef, "skinDualQuat");
+	Error += perf(Mesh, skin_linear, 1, LinearRef, "skinLinear");
+	Error += perf(Mesh, skin_linear, Threads, LinearRef, "skinLinear");
+
+	return Error;
+}
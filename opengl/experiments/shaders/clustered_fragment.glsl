@@ -0,0 +1,124 @@
+#version 460 core
+
+in vec2 texCoord;
+in vec3 viewPosition;
+in vec3 viewNormal;
+in vec3 worldPosition;
+in vec3 worldNormal;
+
+out vec4 fragColor;
+
+struct Light {
+  vec4 positionRange;
+  vec4 colorIntensity;
+  vec4 directionSpotAngle;
+};
+
+layout (std430, binding = 2) readonly buffer ViewLights {
+  Light viewLights[];
+};
+
+layout (std430, binding = 3) readonly buffer LightGrid {
+  uvec2 lightGrid[];
+};
+
+layout (std430, binding = 4) readonly buffer LightIndices {
+  uint lightIndexCount;
+  uint lightIndices[];
+};
+
+uniform sampler2D containerTexture;
+uniform sampler2D awesomeFaceTexture;
+
+uniform uvec3 gridSize;
+uniform vec2 tileSize;
+uniform float sliceScale;
+uniform float sliceBias;
+
+// directional sun with cascaded shadows, off while sunColor is black
+uniform vec3 sunDirection;
+uniform vec3 sunColor;
+uniform sampler2DArrayShadow shadowMap;
+uniform mat4 cascadeViewProjections[4];
+uniform float cascadeSplits[4];
+uniform float cascadeTexelSizes[4];
+
+const vec3 ambientColor = vec3(0.03);
+
+float sunVisibility(vec3 normal) {
+  float depth = -viewPosition.z;
+  int cascade = 0;
+  while (cascade < 4 && depth > cascadeSplits[cascade])
+    cascade++;
+  if (cascade == 4)
+    return 1.0;
+
+  // push the lookup along the normal by a texel and a half to hide acne
+  vec3 offsetPosition = worldPosition + normal * cascadeTexelSizes[cascade] * 1.5;
+  vec4 lightClip = cascadeViewProjections[cascade] * vec4(offsetPosition, 1.0);
+  vec3 shadowCoord = lightClip.xyz * 0.5 + 0.5;
+
+  // 3x3 taps on top of the 2x2 hardware filter
+  vec2 texelSize = 1.0 / vec2(textureSize(shadowMap, 0).xy);
+  float visibility = 0.0;
+  for (int y = -1; y <= 1; y++) {
+    for (int x = -1; x <= 1; x++) {
+      visibility += texture(shadowMap,
+                            vec4(shadowCoord.xy + vec2(x, y) * texelSize,
+                                 float(cascade), shadowCoord.z));
+    }
+  }
+
+  return visibility / 9.0;
+}
+
+void main() {
+  vec3 albedo = mix(texture(containerTexture, texCoord),
+                    texture(awesomeFaceTexture, texCoord), 0.2).rgb;
+
+  uint slice = uint(max(log(-viewPosition.z) * sliceScale + sliceBias, 0.0));
+  uvec2 tile = uvec2(gl_FragCoord.xy / tileSize);
+  tile = min(tile, gridSize.xy - 1u);
+  slice = min(slice, gridSize.z - 1u);
+  uint cluster = tile.x + gridSize.x * (tile.y + gridSize.y * slice);
+  uvec2 lightList = lightGrid[cluster];
+
+  vec3 normal = normalize(viewNormal);
+  vec3 toEye = normalize(-viewPosition);
+  vec3 lighting = ambientColor;
+
+  if (sunColor != vec3(0.0)) {
+    vec3 worldUnitNormal = normalize(worldNormal);
+    float sunDiffuse = max(dot(worldUnitNormal, -sunDirection), 0.0);
+    if (sunDiffuse > 0.0)
+      lighting += sunColor * sunDiffuse * sunVisibility(worldUnitNormal);
+  }
+
+  for (uint i = 0; i < lightList.y; i++) {
+    Light light = viewLights[lightIndices[lightList.x + i]];
+
+    vec3 toLight = light.positionRange.xyz - viewPosition;
+    float distance = length(toLight);
+    toLight /= distance;
+
+    // inverse square with a window so the light reaches zero at its range
+    float window = clamp(1.0 - pow(distance / light.positionRange.w, 4.0),
+                         0.0, 1.0);
+    float attenuation = window * window / (distance * distance + 1.0);
+
+    float spotAngle = light.directionSpotAngle.w;
+    if (spotAngle >= -1.0) {
+      float cosine = dot(-toLight, light.directionSpotAngle.xyz);
+      attenuation *= smoothstep(spotAngle, spotAngle + 0.05, cosine);
+    }
+
+    float diffuse = max(dot(normal, toLight), 0.0);
+    float specular =
+        pow(max(dot(normal, normalize(toLight + toEye)), 0.0), 32.0) * 0.25;
+
+    lighting += light.colorIntensity.rgb * light.colorIntensity.w *
+                attenuation * (diffuse + specular);
+  }
+
+  fragColor = vec4(albedo * lighting, 1.0);
+}
@@ -0,0 +1,33 @@
+#version 460 core
+
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec3 aNormal;
+// zero unless the mesh is drawn instanced
+layout (location = 3) in vec3 aInstanceOffset;
+
+out vec2 texCoord;
+out vec3 viewPosition;
+out vec3 viewNormal;
+out vec3 worldPosition;
+out vec3 worldNormal;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+void main() {
+  vec4 worldPosition4 =
+      model * vec4(aPosition, 1.0) + vec4(aInstanceOffset, 0.0);
+  vec4 position = view * worldPosition4;
+
+  worldPosition = worldPosition4.xyz;
+  viewPosition = position.xyz;
+  // models only use uniform or axis aligned scales, the normal is
+  // renormalized in the fragment shader so no inverse transpose is needed
+  worldNormal = mat3(model) * aNormal;
+  viewNormal = mat3(view) * worldNormal;
+  texCoord = aTexCoord;
+
+  gl_Position = projection * position;
+}
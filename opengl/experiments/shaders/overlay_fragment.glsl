@@ -0,0 +1,13 @@
+#version 460 core
+
+in vec2 texCoord;
+in vec4 quadColor;
+
+out vec4 fragColor;
+
+// the font atlas is swizzled to white with its coverage in alpha
+uniform sampler2D overlayTexture;
+
+void main() {
+  fragColor = texture(overlayTexture, texCoord) * quadColor;
+}
@@ -0,0 +1,23 @@
+#version 460 core
+
+layout (location = 0) in vec4 rectangle;
+layout (location = 1) in vec4 texCoordRectangle;
+layout (location = 2) in vec4 color;
+
+out vec2 texCoord;
+out vec4 quadColor;
+
+uniform vec2 screenSize;
+
+void main() {
+  // triangle strip corners 0 1 2 3 are (0,0) (1,0) (0,1) (1,1)
+  vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+  vec2 position = mix(rectangle.xy, rectangle.zw, corner);
+
+  // pixels from the top left to clip space
+  gl_Position =
+      vec4(position / screenSize * vec2(2.0, -2.0) + vec2(-1.0, 1.0), 0.0,
+           1.0);
+  texCoord = mix(texCoordRectangle.xy, texCoordRectangle.zw, corner);
+  quadColor = color;
+}
@@ -0,0 +1,15 @@
+#version 460 core
+
+in vec2 corner;
+in vec4 particleColor;
+
+out vec4 fragColor;
+
+void main() {
+  float distanceSquared = dot(corner, corner);
+  if (distanceSquared > 1.0)
+    discard;
+
+  fragColor = vec4(particleColor.rgb,
+                   particleColor.a * (1.0 - distanceSquared));
+}
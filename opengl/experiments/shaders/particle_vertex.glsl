@@ -0,0 +1,53 @@
+#version 460 core
+
+struct Particle {
+  vec4 positionLife;
+  vec4 velocityLifetime;
+};
+
+layout (std430, binding = 7) readonly buffer Particles {
+  Particle particles[];
+};
+
+layout (std430, binding = 11) readonly buffer SortEntries {
+  uvec2 sortEntries[];
+};
+
+// the CPU updater uploads xyz position and w remaining life fraction
+layout (std430, binding = 12) readonly buffer CpuParticles {
+  vec4 cpuParticles[];
+};
+
+out vec2 corner;
+out vec4 particleColor;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform float particleSize;
+uniform bool fromCpu;
+
+const vec2 corners[6] = vec2[](vec2(-1.0, -1.0), vec2(1.0, -1.0),
+                               vec2(1.0, 1.0), vec2(1.0, 1.0),
+                               vec2(-1.0, 1.0), vec2(-1.0, -1.0));
+
+void main() {
+  vec3 position;
+  float life;
+  if (fromCpu) {
+    position = cpuParticles[gl_InstanceID].xyz;
+    life = cpuParticles[gl_InstanceID].w;
+  } else {
+    Particle particle = particles[sortEntries[gl_InstanceID].y];
+    position = particle.positionLife.xyz;
+    life = particle.positionLife.w / particle.velocityLifetime.w;
+  }
+
+  // camera facing quad
+  corner = corners[gl_VertexID];
+  vec4 viewPosition = view * vec4(position, 1.0);
+  viewPosition.xy += corner * particleSize;
+  gl_Position = projection * viewPosition;
+
+  particleColor = vec4(mix(vec3(0.9, 0.2, 0.05), vec3(1.0, 0.85, 0.4), life),
+                       0.7 * life);
+}
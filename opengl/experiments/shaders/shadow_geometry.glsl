@@ -0,0 +1,18 @@
+#version 460 core
+
+// Routes every triangle to the shadow map layer of its cascade
+
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 3) out;
+
+flat in uint vertexCascade[];
+
+void main() {
+  for (int i = 0; i < 3; i++) {
+    gl_Layer = int(vertexCascade[0]);
+    gl_Position = gl_in[i].gl_Position;
+    EmitVertex();
+  }
+
+  EndPrimitive();
+}
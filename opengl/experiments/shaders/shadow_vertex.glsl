@@ -0,0 +1,24 @@
+#version 460 core
+
+layout (location = 0) in vec3 aPosition;
+
+struct ShadowInstance {
+  mat4 model;
+  uvec4 cascade;
+};
+
+layout (std430, binding = 0) readonly buffer ShadowInstances {
+  ShadowInstance instances[];
+};
+
+uniform mat4 lightViewProjections[4];
+
+flat out uint vertexCascade;
+
+void main() {
+  ShadowInstance instance = instances[gl_BaseInstance + gl_InstanceID];
+  vertexCascade = instance.cascade.x;
+
+  gl_Position = lightViewProjections[instance.cascade.x] * instance.model *
+                vec4(aPosition, 1.0);
+}
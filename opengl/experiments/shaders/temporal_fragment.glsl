@@ -0,0 +1,57 @@
+#version 460 core
+
+// Accumulates the jittered low resolution frames into a window sized
+// history. The history is reprojected with the depth of the current frame
+// and clamped to the current neighbourhood to limit ghosting
+
+out vec4 fragColor;
+
+uniform sampler2D sceneTexture;
+uniform sampler2D depthTexture;
+uniform sampler2D historyTexture;
+
+uniform vec2 windowSize;
+uniform ivec2 renderSize;
+// current jitter in render pixels
+uniform vec2 jitter;
+// 0 while the history is invalid, after a resize or on the first frame
+uniform float historyWeight;
+
+// both without jitter
+uniform mat4 inverseViewProjection;
+uniform mat4 previousViewProjection;
+
+void main() {
+  vec2 uv = gl_FragCoord.xy / windowSize;
+  // the jittered render shifted the whole image by `jitter` pixels
+  ivec2 pixel = ivec2(uv * vec2(renderSize) + jitter);
+  pixel = clamp(pixel, ivec2(0), renderSize - 1);
+
+  vec3 current = texelFetch(sceneTexture, pixel, 0).rgb;
+  vec3 neighbourhoodMinimum = current;
+  vec3 neighbourhoodMaximum = current;
+  for (int y = -1; y <= 1; y++) {
+    for (int x = -1; x <= 1; x++) {
+      ivec2 neighbour = clamp(pixel + ivec2(x, y), ivec2(0), renderSize - 1);
+      vec3 color = texelFetch(sceneTexture, neighbour, 0).rgb;
+      neighbourhoodMinimum = min(neighbourhoodMinimum, color);
+      neighbourhoodMaximum = max(neighbourhoodMaximum, color);
+    }
+  }
+
+  float depth = texelFetch(depthTexture, pixel, 0).r;
+  vec4 world = inverseViewProjection * vec4(uv * 2.0 - 1.0, depth * 2.0 - 1.0,
+                                            1.0);
+  vec4 previousClip = previousViewProjection * vec4(world.xyz / world.w, 1.0);
+  vec2 previousUv = previousClip.xy / previousClip.w * 0.5 + 0.5;
+
+  float weight = historyWeight;
+  if (any(lessThan(previousUv, vec2(0.0))) ||
+      any(greaterThan(previousUv, vec2(1.0))))
+    weight = 0.0;
+
+  vec3 history = texture(historyTexture, previousUv).rgb;
+  history = clamp(history, neighbourhoodMinimum, neighbourhoodMaximum);
+
+  fragColor = vec4(mix(current, history, weight), 1.0);
+}
@@ -0,0 +1,19 @@
+#version 460 core
+
+// Bilinear upscale of the rendered corner of the scene target to the window
+
+out vec4 fragColor;
+
+uniform sampler2D sceneTexture;
+uniform vec2 windowSize;
+// rendered size divided by the allocated size of the scene target
+uniform vec2 renderScale;
+
+void main() {
+  vec2 halfTexel = 0.5 / vec2(textureSize(sceneTexture, 0));
+  vec2 coord = gl_FragCoord.xy / windowSize * renderScale;
+  // never filter in the unused part of the target
+  coord = clamp(coord, halfTexel, renderScale - halfTexel);
+
+  fragColor = texture(sceneTexture, coord);
+}
@@ -0,0 +1,15 @@
+#version 460 core
+
+// Only ids are written, so overdraw costs a depth test and 8 bytes instead
+// of a full shading pass
+
+layout (early_fragment_tests) in;
+
+flat in uint instanceId;
+
+// x instance + 1 so that the cleared 0 means empty, y triangle
+out uvec2 visibility;
+
+void main() {
+  visibility = uvec2(instanceId + 1u, uint(gl_PrimitiveID));
+}
@@ -0,0 +1,19 @@
+#version 460 core
+
+// Copies the shaded pixels and their depth into the bound framebuffer, so
+// forward passes like transparency can still be drawn on top
+
+out vec4 fragColor;
+
+uniform usampler2D visibilityTexture;
+uniform sampler2D shadedTexture;
+uniform sampler2D depthTexture;
+
+void main() {
+  ivec2 pixel = ivec2(gl_FragCoord.xy);
+  if (texelFetch(visibilityTexture, pixel, 0).x == 0u)
+    discard;
+
+  fragColor = texelFetch(shadedTexture, pixel, 0);
+  gl_FragDepth = texelFetch(depthTexture, pixel, 0).r;
+}
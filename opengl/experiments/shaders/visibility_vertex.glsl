@@ -0,0 +1,16 @@
+#version 460 core
+
+layout (location = 0) in vec3 aPosition;
+
+layout (std430, binding = 6) readonly buffer Instances {
+  mat4 models[];
+};
+
+uniform mat4 viewProjection;
+
+flat out uint instanceId;
+
+void main() {
+  instanceId = uint(gl_BaseInstance + gl_InstanceID);
+  gl_Position = viewProjection * models[instanceId] * vec4(aPosition, 1.0);
+}
@@ -0,0 +1,92 @@
+#include <math.h>
+
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "benchmark_scene.h"
+#include "gpu_memory.h"
+#include "textures.h"
+
+const float fieldSpacing = 1.5f;
+
+void createBenchmarkScene(BenchmarkScene *scene, int fieldSize,
+                          int lightCount) {
+  scene->cube = createCubeMesh();
+  scene->cubeCount = fieldSize * fieldSize;
+  scene->halfField = fieldSize * fieldSpacing * 0.5f;
+
+  std::vector<glm::vec3> offsets;
+  for (auto z = 0; z < fieldSize; z++) {
+    for (auto x = 0; x < fieldSize; x++) {
+      offsets.push_back(glm::vec3(x * fieldSpacing - scene->halfField,
+                                  (float)((x * 7 + z * 13) % 3) * 0.5f,
+                                  z * fieldSpacing - scene->halfField));
+    }
+  }
+
+  scene->offsetsBuffer = createGpuBuffer(
+      GpuMemoryGeometry, GL_ARRAY_BUFFER, offsets.size() * sizeof(glm::vec3),
+      offsets.data(), GL_STATIC_DRAW);
+  attachInstanceOffsets(scene->cube, scene->offsetsBuffer);
+
+  scene->shaderProgram = createLitShaderProgram();
+  scene->containerTexture = buildContanierTexture();
+  scene->awesomeFaceTexture = buildAwesomeFaceTexture();
+
+  createClusteredLighting(&scene->lighting, lightCount);
+  std::vector<Light> lights(lightCount);
+  generateLights(lights.data(), lightCount,
+                 glm::vec3(-scene->halfField, 0.5f, -scene->halfField),
+                 glm::vec3(scene->halfField, 6.0f, scene->halfField), 1234);
+  uploadLights(&scene->lighting, lights.data(), lightCount);
+}
+
+void deleteBenchmarkScene(BenchmarkScene *scene) {
+  deleteClusteredLighting(&scene->lighting);
+  deleteGpuTextures(1, &scene->containerTexture);
+  deleteGpuTextures(1, &scene->awesomeFaceTexture);
+  deleteGpuProgram(scene->shaderProgram);
+  deleteGpuBuffers(1, &scene->offsetsBuffer);
+  deleteMesh(&scene->cube);
+}
+
+glm::mat4 benchmarkSceneView(const BenchmarkScene &scene, float angle) {
+  auto distance = scene.halfField + 6.0f;
+  auto eye = glm::vec3(sinf(angle) * distance, 14.0f, cosf(angle) * distance);
+  return glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+void drawBenchmarkScene(BenchmarkScene *scene, const glm::mat4 &view,
+                        const glm::mat4 &projection, int width, int height) {
+  drawBenchmarkScene(scene, scene->cube, view, projection, width, height);
+}
+
+void drawBenchmarkScene(BenchmarkScene *scene, const Mesh &cube,
+                        const glm::mat4 &view, const glm::mat4 &projection,
+                        int width, int height) {
+  updateClusters(&scene->lighting, view, projection, width, height);
+
+  glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, scene->containerTexture);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, scene->awesomeFaceTexture);
+  touchGpuTexture(scene->containerTexture);
+  touchGpuTexture(scene->awesomeFaceTexture);
+
+  auto program = scene->shaderProgram;
+  useClusteredLighting(scene->lighting, program, width, height);
+  glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE,
+                     glm::value_ptr(view));
+  glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE,
+                     glm::value_ptr(projection));
+  glUniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE,
+                     glm::value_ptr(glm::mat4(1.0f)));
+
+  glBindVertexArray(cube.vertexArrayObject);
+  glDrawArraysInstanced(GL_TRIANGLES, 0, cube.vertexCount, scene->cubeCount);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "clustered.h"
+#include "meshes.h"
+
+// A field of instanced cubes lit by clustered lights, the usual load for
+// the benchmarks
+struct BenchmarkScene {
+  Mesh cube;
+  unsigned int offsetsBuffer;
+  int cubeCount;
+  float halfField;
+
+  unsigned int shaderProgram;
+  unsigned int containerTexture;
+  unsigned int awesomeFaceTexture;
+  ClusteredLighting lighting;
+};
+
+void createBenchmarkScene(BenchmarkScene *scene, int fieldSize,
+                          int lightCount);
+void deleteBenchmarkScene(BenchmarkScene *scene);
+
+// Camera circling the field, `angle` in radians
+glm::mat4 benchmarkSceneView(const BenchmarkScene &scene, float angle);
+
+// Bins the lights and draws the field into the bound framebuffer
+void drawBenchmarkScene(BenchmarkScene *scene, const glm::mat4 &view,
+                        const glm::mat4 &projection, int width, int height);
+// Same, with the cube of a context sharing the scene, see shareMesh. The
+// instance offsets must be attached to it
+void drawBenchmarkScene(BenchmarkScene *scene, const Mesh &cube,
+                        const glm::mat4 &view, const glm::mat4 &projection,
+                        int width, int height);
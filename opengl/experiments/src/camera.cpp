@@ -1,8 +1,5 @@
-#include "glm/fwd.hpp"
-#include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
 
 #include "camera.h"
 
@@ -11,103 +8,191 @@ const auto upwardsInWorldSpace = glm::vec3(0.0f, 1.0f, 0.0f);
 // TODO(taylon): this would go to settings at some point... probably
 const float mouseSensitivity = 0.1f;
 
-CameraState initialCameraState() {
-  CameraState state;
-  state.yaw = -90.0f;
-  state.pitch = 0.0f;
-  state.fieldOfView = 60.0f;
-  state.position = glm::vec3(0.0f, 0.0f, 3.0f);
-  state.directionPointingAt = glm::vec3(0.0f, 0.0f, -1.0f);
+static void updateOrientation(Camera *camera) {
+  // yaw around the world up and then pitch around the camera right, the
+  // -90 makes a yaw of -90 the identity
+  auto yaw = glm::angleAxis(glm::radians(-camera->yaw - 90.0f),
+                            upwardsInWorldSpace);
+  auto pitch = glm::angleAxis(glm::radians(camera->pitch),
+                              glm::vec3(1.0f, 0.0f, 0.0f));
+  camera->orientation = yaw * pitch;
+  camera->viewVersion++;
+}
 
-  return state;
+void initCamera(Camera *camera, glm::vec3 position, float yaw, float pitch,
+                float fieldOfView, float aspectRatio) {
+  camera->position = position;
+  camera->yaw = yaw;
+  camera->pitch = pitch;
+  camera->fieldOfView = fieldOfView;
+  camera->aspectRatio = aspectRatio;
+  camera->nearPlane = cameraNearPlane;
+  camera->farPlane = cameraFarPlane;
+  camera->lastCursor = glm::dvec2(0.0);
+  camera->hasCursor = false;
+
+  // the caches start stale
+  camera->viewVersion = 1;
+  camera->projectionVersion = 1;
+  camera->cachedViewVersion = 0;
+  camera->cachedProjectionVersion = 0;
+  updateOrientation(camera);
 }
 
-auto cameraState = initialCameraState();
-
-glm::mat4 cameraViewMatrix() {
-  auto pitch = cameraState.pitch;
-  auto yaw = cameraState.yaw;
-  glm::vec3 direction;
-  direction.x = cos(glm::radians(yaw)) * cos(glm::radians(pitch));
-  direction.y = sin(glm::radians(pitch));
-  direction.z = sin(glm::radians(yaw)) * cos(glm::radians(pitch));
-  cameraState.directionPointingAt = glm::normalize(direction);
-
-  auto toTheRightFromCamera = glm::normalize(
-      glm::cross(upwardsInWorldSpace, cameraState.directionPointingAt));
-  auto upwardsFromCamera =
-      glm::cross(cameraState.directionPointingAt, toTheRightFromCamera);
-
-  return glm::lookAt(cameraState.position,
-                     cameraState.position + cameraState.directionPointingAt,
-                     upwardsFromCamera);
+void setCameraPose(Camera *camera, glm::vec3 position, float yaw,
+                   float pitch) {
+  camera->position = position;
+  camera->yaw = yaw;
+  camera->pitch = glm::clamp(pitch, -89.0f, 89.0f);
+  updateOrientation(camera);
 }
 
-glm::mat4 cameraProjectionMatrix() {
-  return glm::perspective(glm::radians(cameraState.fieldOfView),
-                          800.0f / 600.0f, 0.1f, 100.0f);
+void updateCamera(Camera *camera) {
+  auto viewChanged = camera->cachedViewVersion != camera->viewVersion;
+  auto projectionChanged =
+      camera->cachedProjectionVersion != camera->projectionVersion;
+  if (!viewChanged && !projectionChanged)
+    return;
+
+  if (viewChanged) {
+    // rigid transform, the inverse is the transposed rotation
+    auto rotation = glm::mat4_cast(glm::conjugate(camera->orientation));
+    camera->view = glm::translate(rotation, -camera->position);
+    camera->inverseView = glm::translate(glm::mat4(1.0f), camera->position) *
+                          glm::mat4_cast(camera->orientation);
+    camera->cachedViewVersion = camera->viewVersion;
+  }
+
+  if (projectionChanged) {
+    camera->projection =
+        glm::perspective(glm::radians(camera->fieldOfView),
+                         camera->aspectRatio, camera->nearPlane,
+                         camera->farPlane);
+    camera->inverseProjection = glm::inverse(camera->projection);
+    camera->cachedProjectionVersion = camera->projectionVersion;
+  }
+
+  camera->viewProjection = camera->projection * camera->view;
+  camera->inverseViewProjection =
+      camera->inverseView * camera->inverseProjection;
+
+  // Gribb/Hartmann, sums and differences of the rows of the clip matrix
+  auto &m = camera->viewProjection;
+  auto row = [&m](int i) {
+    return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+  };
+  camera->frustumPlanes[FrustumLeft] = row(3) + row(0);
+  camera->frustumPlanes[FrustumRight] = row(3) - row(0);
+  camera->frustumPlanes[FrustumBottom] = row(3) + row(1);
+  camera->frustumPlanes[FrustumTop] = row(3) - row(1);
+  camera->frustumPlanes[FrustumNear] = row(3) + row(2);
+  camera->frustumPlanes[FrustumFar] = row(3) - row(2);
+  for (auto &plane : camera->frustumPlanes)
+    plane /= glm::length(glm::vec3(plane));
 }
 
-// TODO(taylon): fix this, it is the width/height divided by 2
-auto lastX = 400.0f;
-auto lastY = 300.0f;
-void cameraLookAround(double xPosition, double yPosition) {
-  auto pitch = &cameraState.pitch;
-  auto yaw = &cameraState.yaw;
+const glm::mat4 &cameraViewMatrix(Camera *camera) {
+  updateCamera(camera);
+  return camera->view;
+}
 
-  auto xOffset = xPosition - lastX;
-  lastX = xPosition;
+const glm::mat4 &cameraProjectionMatrix(Camera *camera) {
+  updateCamera(camera);
+  return camera->projection;
+}
 
-  // reversed since y-coordinates range from bottom to top
-  auto yOffset = lastY - yPosition;
-  lastY = yPosition;
+const glm::mat4 &cameraViewProjectionMatrix(Camera *camera) {
+  updateCamera(camera);
+  return camera->viewProjection;
+}
 
-  xOffset *= mouseSensitivity;
-  yOffset *= mouseSensitivity;
+glm::vec3 cameraForward(const Camera &camera) {
+  return camera.orientation * glm::vec3(0.0f, 0.0f, -1.0f);
+}
 
-  *yaw += xOffset;
-  *pitch += yOffset;
+bool sphereInCameraFrustum(const Camera &camera, glm::vec3 center,
+                           float radius) {
+  for (auto &plane : camera.frustumPlanes) {
+    if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+      return false;
+  }
+  return true;
+}
 
-  if (*pitch > 89.0f) {
-    *pitch = 89.0f;
-  } else if (*pitch < -89.0f) {
-    *pitch = -89.0f;
+void cameraLookAround(Camera *camera, double xPosition, double yPosition) {
+  auto cursor = glm::dvec2(xPosition, yPosition);
+  if (!camera->hasCursor) {
+    camera->lastCursor = cursor;
+    camera->hasCursor = true;
   }
+
+  auto xOffset = cursor.x - camera->lastCursor.x;
+  // reversed since y-coordinates range from bottom to top
+  auto yOffset = camera->lastCursor.y - cursor.y;
+  camera->lastCursor = cursor;
+  if (xOffset == 0.0 && yOffset == 0.0)
+    return;
+
+  camera->yaw += xOffset * mouseSensitivity;
+  camera->pitch += yOffset * mouseSensitivity;
+
+  if (camera->pitch > 89.0f) {
+    camera->pitch = 89.0f;
+  } else if (camera->pitch < -89.0f) {
+    camera->pitch = -89.0f;
+  }
+
+  updateOrientation(camera);
 }
 
-void moveCamera(float movementSpeed, CameraMovementType movementType) {
-  auto directionPointingAt = cameraState.directionPointingAt;
+void moveCamera(Camera *camera, float movementSpeed,
+                CameraMovementType movementType) {
+  auto directionPointingAt = cameraForward(*camera);
+  // the yaw alone, so strafing stays level whatever the pitch
+  auto toTheRight = camera->orientation * glm::vec3(1.0f, 0.0f, 0.0f);
 
   switch (movementType) {
   case Forward:
-    cameraState.position += movementSpeed * directionPointingAt;
+    camera->position += movementSpeed * directionPointingAt;
     break;
   case Backwards:
-    cameraState.position -= movementSpeed * directionPointingAt;
+    camera->position -= movementSpeed * directionPointingAt;
     break;
   case Right:
-    cameraState.position +=
-        glm::normalize(glm::cross(directionPointingAt, upwardsInWorldSpace)) *
-        movementSpeed;
+    camera->position += toTheRight * movementSpeed;
     break;
   case Left:
-    cameraState.position -=
-        glm::normalize(glm::cross(directionPointingAt, upwardsInWorldSpace)) *
-        movementSpeed;
+    camera->position -= toTheRight * movementSpeed;
     break;
   }
 
   // keep it at the ground level
-  cameraState.position.y = 0;
+  camera->position.y = 0;
+  camera->viewVersion++;
+}
+
+void cameraZoomOut(Camera *camera, double offset) {
+  auto fieldOfView = camera->fieldOfView - (float)offset;
+  if (fieldOfView < 1.0f) {
+    fieldOfView = 1.0f;
+  } else if (fieldOfView > 60.0f) {
+    fieldOfView = 60.0f;
+  }
+
+  if (fieldOfView != camera->fieldOfView) {
+    camera->fieldOfView = fieldOfView;
+    camera->projectionVersion++;
+  }
 }
 
-void cameraZoomOut(double offset) {
-  auto fieldOfView = &cameraState.fieldOfView;
+void setCameraAspectRatio(Camera *camera, int width, int height) {
+  // minimized windows report a zero size, keep the last ratio
+  if (width <= 0 || height <= 0)
+    return;
 
-  *fieldOfView -= (float)offset;
-  if (*fieldOfView < 1.0f) {
-    *fieldOfView = 1.0f;
-  } else if (*fieldOfView > 60.0f) {
-    *fieldOfView = 60.0f;
+  auto aspectRatio = (float)width / (float)height;
+  if (aspectRatio != camera->aspectRatio) {
+    camera->aspectRatio = aspectRatio;
+    camera->projectionVersion++;
   }
 }
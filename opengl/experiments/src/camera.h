@@ -1,11 +1,57 @@
+#pragma once
+
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+const float cameraNearPlane = 0.1f;
+const float cameraFarPlane = 100.0f;
+
+// Order of Camera::frustumPlanes
+enum FrustumPlane {
+  FrustumLeft,
+  FrustumRight,
+  FrustumBottom,
+  FrustumTop,
+  FrustumNear,
+  FrustumFar,
+};
 
-struct CameraState {
+// Everything the camera state changes bumps a version, the matrices are
+// only rebuilt when the version they were built from is stale. Each camera
+// is independent, so split screen or shadow views just use more of them
+struct Camera {
+  glm::vec3 position;
+  glm::quat orientation;
+  // the input accumulates in these, the orientation is rebuilt from them
+  // and they keep the pitch clamped and the roll at zero
   float yaw;
   float pitch;
+
   float fieldOfView;
-  glm::vec3 position;
-  glm::vec3 directionPointingAt;
+  // width / height of the framebuffer the camera renders to
+  float aspectRatio;
+  float nearPlane;
+  float farPlane;
+
+  // cursor position of the last look around, the first one only sets it
+  glm::dvec2 lastCursor;
+  bool hasCursor;
+
+  // bumped by every change, consumers compare them to know if anything
+  // derived from the matrices is stale
+  unsigned int viewVersion;
+  unsigned int projectionVersion;
+  unsigned int cachedViewVersion;
+  unsigned int cachedProjectionVersion;
+
+  glm::mat4 view;
+  glm::mat4 inverseView;
+  glm::mat4 projection;
+  glm::mat4 inverseProjection;
+  glm::mat4 viewProjection;
+  glm::mat4 inverseViewProjection;
+  // world space, xyz normal pointing inside, w distance
+  glm::vec4 frustumPlanes[6];
 };
 
 // TODO(taylon): namespace this maybe?
@@ -16,9 +62,27 @@ enum CameraMovementType {
   Backwards,
 };
 
-glm::mat4 cameraViewMatrix();
-glm::mat4 cameraProjectionMatrix();
+// yaw and pitch in degrees, a yaw of -90 looks down -z
+void initCamera(Camera *camera, glm::vec3 position, float yaw, float pitch,
+                float fieldOfView, float aspectRatio);
+
+// Teleports the camera, a yaw of -90 looks down -z
+void setCameraPose(Camera *camera, glm::vec3 position, float yaw,
+                   float pitch);
+
+// Rebuilds the matrices and planes that are stale, the getters below call
+// it so it rarely needs to be called directly
+void updateCamera(Camera *camera);
+const glm::mat4 &cameraViewMatrix(Camera *camera);
+const glm::mat4 &cameraProjectionMatrix(Camera *camera);
+const glm::mat4 &cameraViewProjectionMatrix(Camera *camera);
+glm::vec3 cameraForward(const Camera &camera);
+
+// The planes must be up to date, see updateCamera
+bool sphereInCameraFrustum(const Camera &camera, glm::vec3 center,
+                           float radius);
 
-void moveCamera(float speed, CameraMovementType movementType);
-void cameraLookAround(double xPosition, double yPosition);
-void cameraZoomOut(double offset);
+void moveCamera(Camera *camera, float speed, CameraMovementType movementType);
+void cameraLookAround(Camera *camera, double xPosition, double yPosition);
+void cameraZoomOut(Camera *camera, double offset);
+void setCameraAspectRatio(Camera *camera, int width, int height);
@@ -0,0 +1,357 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include "benchmark_scene.h"
+#include "camera.h"
+#include "capture.h"
+#include "gpu_memory.h"
+
+static void encodePng(FrameCapture *capture, const CaptureJob &job,
+                      std::vector<unsigned char> *rgb) {
+  // GL rows start at the bottom and carry an alpha that is not meant to be
+  // saved
+  rgb->resize((size_t)job.width * job.height * 3);
+  for (auto y = 0; y < job.height; y++) {
+    auto source = &job.pixels[(size_t)(job.height - 1 - y) * job.width * 4];
+    auto destination = &(*rgb)[(size_t)y * job.width * 3];
+    for (auto x = 0; x < job.width; x++) {
+      destination[x * 3] = source[x * 4];
+      destination[x * 3 + 1] = source[x * 4 + 1];
+      destination[x * 3 + 2] = source[x * 4 + 2];
+    }
+  }
+
+  char fileName[1024];
+  snprintf(fileName, sizeof(fileName), "%s_%05d.png", capture->path,
+           job.index);
+  if (!stbi_write_png(fileName, job.width, job.height, 3, rgb->data(),
+                      job.width * 3))
+    fprintf(stderr, "unable to write %s\n", fileName);
+}
+
+static unsigned char clampByte(int value) {
+  return value > 255 ? 255 : (unsigned char)value;
+}
+
+static void encodeY4m(FrameCapture *capture, const CaptureJob &job,
+                      std::vector<unsigned char> *yuv) {
+  // 4:2:0 needs even sizes, an odd last row or column is dropped
+  auto width = job.width & ~1;
+  auto height = job.height & ~1;
+  auto lumaSize = (size_t)width * height;
+  auto chromaSize = lumaSize / 4;
+  yuv->resize(lumaSize + chromaSize * 2);
+  auto luma = yuv->data();
+  auto blue = luma + lumaSize;
+  auto red = blue + chromaSize;
+
+  // full range BT.601 in 8.8 fixed point, the offsets keep every
+  // intermediate positive
+  for (auto y = 0; y < height; y++) {
+    auto source = &job.pixels[(size_t)(job.height - 1 - y) * job.width * 4];
+    for (auto x = 0; x < width; x++) {
+      int r = source[x * 4], g = source[x * 4 + 1], b = source[x * 4 + 2];
+      luma[(size_t)y * width + x] = (77 * r + 150 * g + 29 * b + 128) >> 8;
+    }
+  }
+  for (auto y = 0; y < height / 2; y++) {
+    auto top = &job.pixels[(size_t)(job.height - 1 - y * 2) * job.width * 4];
+    auto bottom = top - (size_t)job.width * 4;
+    for (auto x = 0; x < width / 2; x++) {
+      auto i = x * 8;
+      int r = (top[i] + top[i + 4] + bottom[i] + bottom[i + 4] + 2) >> 2;
+      int g =
+          (top[i + 1] + top[i + 5] + bottom[i + 1] + bottom[i + 5] + 2) >> 2;
+      int b =
+          (top[i + 2] + top[i + 6] + bottom[i + 2] + bottom[i + 6] + 2) >> 2;
+      auto chroma = (size_t)y * (width / 2) + x;
+      blue[chroma] = clampByte((-43 * r - 85 * g + 128 * b + 32896) >> 8);
+      red[chroma] = clampByte((128 * r - 107 * g - 21 * b + 32896) >> 8);
+    }
+  }
+
+  // converted in parallel, written in order
+  std::unique_lock<std::mutex> lock(capture->mutex);
+  capture->videoFrameWritten.wait(
+      lock, [&] { return capture->nextVideoFrame == job.index; });
+
+  if (job.index == 0) {
+    capture->videoWidth = width;
+    capture->videoHeight = height;
+    fprintf(capture->videoFile, "YUV4MPEG2 W%d H%d F60:1 Ip A1:1 C420jpeg\n",
+            width, height);
+  }
+  if (width == capture->videoWidth && height == capture->videoHeight) {
+    fputs("FRAME\n", capture->videoFile);
+    fwrite(yuv->data(), 1, yuv->size(), capture->videoFile);
+  } else {
+    fprintf(stderr, "skipping frame %d, y4m streams can not change size\n",
+            job.index);
+  }
+
+  capture->nextVideoFrame++;
+  capture->videoFrameWritten.notify_all();
+}
+
+static void captureWorker(FrameCapture *capture) {
+  std::vector<unsigned char> converted;
+  while (true) {
+    CaptureJob job;
+    {
+      std::unique_lock<std::mutex> lock(capture->mutex);
+      capture->jobAdded.wait(
+          lock, [&] { return capture->stopping || !capture->jobs.empty(); });
+      if (capture->jobs.empty())
+        return;
+
+      job = std::move(capture->jobs.front());
+      capture->jobs.pop_front();
+    }
+
+    if (capture->format == CapturePng)
+      encodePng(capture, job, &converted);
+    else
+      encodeY4m(capture, job, &converted);
+
+    std::lock_guard<std::mutex> lock(capture->mutex);
+    capture->encoded++;
+    capture->freePixels.push_back(std::move(job.pixels));
+  }
+}
+
+bool createFrameCapture(FrameCapture *capture, const char *path,
+                        CaptureFormat format, int workerCount) {
+  capture->format = format;
+  capture->path = path;
+
+  capture->videoFile = NULL;
+  if (format == CaptureY4m) {
+    capture->videoFile = fopen(path, "wb");
+    if (capture->videoFile == NULL) {
+      fprintf(stderr, "unable to open %s\n", path);
+      return false;
+    }
+  }
+  capture->videoWidth = 0;
+  capture->videoHeight = 0;
+  capture->nextVideoFrame = 0;
+
+  for (auto i = 0; i < captureLatency; i++) {
+    capture->pixelBuffers[i] = createGpuBuffer(
+        GpuMemoryStaging, GL_PIXEL_PACK_BUFFER, 0, NULL, GL_STREAM_READ);
+    capture->fences[i] = NULL;
+    capture->capacities[i] = 0;
+  }
+  capture->frame = 0;
+  capture->queued = 0;
+
+  capture->totalMilliseconds = 0.0;
+  capture->samples = 0;
+  capture->stalls = 0;
+  capture->dropped = 0;
+  capture->encoded = 0;
+
+  capture->stopping = false;
+  for (auto i = 0; i < workerCount; i++)
+    capture->workers.push_back(std::thread(captureWorker, capture));
+
+  return true;
+}
+
+// Maps a finished readback and hands it to the workers
+static void collectCapture(FrameCapture *capture, int slot, bool mayDrop) {
+  auto fence = (GLsync)capture->fences[slot];
+  capture->fences[slot] = NULL;
+
+  // with captureLatency frames in between this should never wait
+  if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) ==
+      GL_TIMEOUT_EXPIRED) {
+    if (mayDrop)
+      capture->stalls++;
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+  }
+  glDeleteSync(fence);
+
+  CaptureJob job;
+  job.width = capture->widths[slot];
+  job.height = capture->heights[slot];
+  {
+    std::lock_guard<std::mutex> lock(capture->mutex);
+    if (mayDrop && capture->jobs.size() >= maxQueuedCaptures) {
+      capture->dropped++;
+      return;
+    }
+
+    job.index = capture->queued++;
+    if (!capture->freePixels.empty()) {
+      job.pixels = std::move(capture->freePixels.back());
+      capture->freePixels.pop_back();
+    }
+  }
+
+  auto size = (size_t)job.width * job.height * 4;
+  job.pixels.resize(size);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, capture->pixelBuffers[slot]);
+  auto mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+  if (mapped != NULL) {
+    memcpy(job.pixels.data(), mapped, size);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  std::lock_guard<std::mutex> lock(capture->mutex);
+  capture->jobs.push_back(std::move(job));
+  capture->jobAdded.notify_one();
+}
+
+void captureFrame(FrameCapture *capture, int width, int height) {
+  if (width <= 0 || height <= 0)
+    return;
+
+  auto start = glfwGetTime();
+  auto slot = capture->frame % captureLatency;
+
+  // the slot still holds the frame from captureLatency frames ago
+  if (capture->fences[slot] != NULL)
+    collectCapture(capture, slot, true);
+
+  auto size = width * height * 4;
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, capture->pixelBuffers[slot]);
+  if (size > capture->capacities[slot]) {
+    resizeGpuBuffer(capture->pixelBuffers[slot], GL_PIXEL_PACK_BUFFER, size,
+                    NULL, GL_STREAM_READ);
+    capture->capacities[slot] = size;
+  }
+  // BGRA is what most drivers store, but RGBA keeps the encoders simple and
+  // is still a straight copy on the GPU
+  glPixelStorei(GL_PACK_ALIGNMENT, 4);
+  glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  capture->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  capture->widths[slot] = width;
+  capture->heights[slot] = height;
+  capture->frame++;
+
+  capture->totalMilliseconds += (glfwGetTime() - start) * 1000.0;
+  capture->samples++;
+}
+
+void finishFrameCapture(FrameCapture *capture) {
+  // oldest first so the frames keep their order
+  for (auto i = 0; i < captureLatency; i++) {
+    auto slot = (capture->frame + i) % captureLatency;
+    if (capture->fences[slot] != NULL)
+      collectCapture(capture, slot, false);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(capture->mutex);
+    capture->stopping = true;
+  }
+  capture->jobAdded.notify_all();
+  for (auto &worker : capture->workers)
+    worker.join();
+  capture->workers.clear();
+
+  if (capture->videoFile != NULL)
+    fclose(capture->videoFile);
+  deleteGpuBuffers(captureLatency, capture->pixelBuffers);
+}
+
+void printCaptureStats(FrameCapture *capture) {
+  std::lock_guard<std::mutex> lock(capture->mutex);
+  printf("capture | %.3f ms per frame on the render thread, %d encoded, %d "
+         "queued, %d dropped, %d stalls\n",
+         capture->samples > 0 ? capture->totalMilliseconds / capture->samples
+                              : 0.0,
+         capture->encoded, (int)capture->jobs.size(), capture->dropped,
+         capture->stalls);
+}
+
+void runCaptureBenchmark(GLFWwindow *window) {
+  const char *modeNames[] = {"no capture", "png", "y4m"};
+  const char *paths[] = {NULL, "/tmp/openglfun_capture",
+                         "/tmp/openglfun_capture.y4m"};
+  const int measuredFrames = 300;
+  const double frameBudget = 1.0 / 60.0;
+
+  glfwSetWindowSize(window, 1280, 720);
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+  glViewport(0, 0, width, height);
+
+  BenchmarkScene scene;
+  createBenchmarkScene(&scene, 48, 1000);
+
+  auto projection =
+      glm::perspective(glm::radians(60.0f), (float)width / (float)height,
+                       cameraNearPlane, cameraFarPlane);
+
+  auto workerCount =
+      glm::clamp((int)std::thread::hardware_concurrency() / 2, 1, 4);
+  printf("capture: %dx%d at 60 fps, %d encoder threads\n", width, height,
+         workerCount);
+
+  for (auto mode = 0; mode < 3; mode++) {
+    FrameCapture capture;
+    if (mode > 0 &&
+        !createFrameCapture(&capture, paths[mode],
+                            mode == 1 ? CapturePng : CaptureY4m, workerCount))
+      continue;
+
+    auto totalWork = 0.0;
+    auto longestWork = 0.0;
+    auto missedFrames = 0;
+    for (auto frame = 0; frame < measuredFrames; frame++) {
+      auto frameStart = glfwGetTime();
+
+      auto view = benchmarkSceneView(scene, frame * 0.01f);
+      drawBenchmarkScene(&scene, view, projection, width, height);
+
+      if (mode > 0)
+        captureFrame(&capture, width, height);
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+
+      // pace to 60 fps, what is left of the budget is idle time
+      auto work = glfwGetTime() - frameStart;
+      totalWork += work;
+      longestWork = fmax(longestWork, work);
+      if (work > frameBudget)
+        missedFrames++;
+      else
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(frameBudget - work));
+    }
+
+    printf("%-10s | frame work %.3f ms average, %.3f ms worst, %d of %d "
+           "frames over budget\n",
+           modeNames[mode], totalWork * 1000.0 / measuredFrames,
+           longestWork * 1000.0, missedFrames, measuredFrames);
+
+    if (mode > 0) {
+      printCaptureStats(&capture);
+      auto drainStart = glfwGetTime();
+      finishFrameCapture(&capture);
+      printf("%-10s | %.1f ms to encode the remaining frames, written to %s\n",
+             modeNames[mode], (glfwGetTime() - drainStart) * 1000.0,
+             paths[mode]);
+    }
+  }
+
+  deleteBenchmarkScene(&scene);
+}
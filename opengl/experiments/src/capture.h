@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdio.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <GLFW/glfw3.h>
+
+// Frames are mapped this many frames after their glReadPixels, by then the
+// GPU has long finished writing them so the map never stalls
+const int captureLatency = 3;
+// frames waiting for a worker past this are dropped instead of queued
+const int maxQueuedCaptures = 16;
+
+enum CaptureFormat {
+  // one numbered png per frame
+  CapturePng,
+  // all frames in a single raw 4:2:0 YUV4MPEG2 stream
+  CaptureY4m,
+};
+
+struct CaptureJob {
+  std::vector<unsigned char> pixels;
+  int width;
+  int height;
+  int index;
+};
+
+struct FrameCapture {
+  CaptureFormat format;
+  // png file prefix or y4m file
+  const char *path;
+
+  unsigned int pixelBuffers[captureLatency];
+  // GLsync, kept opaque so this header does not need glad
+  void *fences[captureLatency];
+  int widths[captureLatency];
+  int heights[captureLatency];
+  int capacities[captureLatency];
+  int frame;
+  // frames handed to the workers so far, the y4m frame number
+  int queued;
+
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable jobAdded;
+  std::deque<CaptureJob> jobs;
+  // pixel storage given back by the workers to be reused
+  std::vector<std::vector<unsigned char>> freePixels;
+  bool stopping;
+
+  // y4m frames are converted in parallel but written in order
+  FILE *videoFile;
+  int videoWidth;
+  int videoHeight;
+  int nextVideoFrame;
+  std::condition_variable videoFrameWritten;
+
+  // render thread cost of capturing
+  double totalMilliseconds;
+  int samples;
+  int stalls;
+  int dropped;
+  int encoded;
+};
+
+bool createFrameCapture(FrameCapture *capture, const char *path,
+                        CaptureFormat format, int workerCount);
+// Encodes everything still in flight before returning
+void finishFrameCapture(FrameCapture *capture);
+
+// Queues the readback of the default framebuffer, call it right before
+// swapping. It hands the frame from captureLatency frames ago to the workers
+void captureFrame(FrameCapture *capture, int width, int height);
+
+void printCaptureStats(FrameCapture *capture);
+
+// Renders a lit cube field paced at 60 fps without capturing, then
+// capturing to png and to y4m, and compares the frame times
+void runCaptureBenchmark(GLFWwindow *window);
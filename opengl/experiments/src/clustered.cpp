@@ -0,0 +1,364 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "camera.h"
+#include "clustered.h"
+#include "gpu_memory.h"
+#include "meshes.h"
+#include "shaders.h"
+#include "shadows.h"
+#include "textures.h"
+
+// Shader storage binding points, see shaders/cluster_*.comp
+const int lightsBinding = 0;
+const int clusterBoundsBinding = 1;
+const int viewLightsBinding = 2;
+const int lightGridBinding = 3;
+const int lightIndicesBinding = 4;
+
+const int lightIndexCapacity = clusterCount * averageLightsPerCluster;
+
+static unsigned int createStorageBuffer(size_t size) {
+  auto buffer = createGpuBuffer(GpuMemoryStorage, GL_SHADER_STORAGE_BUFFER,
+                                size, NULL, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  return buffer;
+}
+
+unsigned int createLitShaderProgram() {
+  auto shaderProgram =
+      createShaderProgram("../shaders/clustered_vertex.glsl",
+                          "../shaders/clustered_fragment.glsl");
+
+  glUseProgram(shaderProgram);
+  glUniform1i(glGetUniformLocation(shaderProgram, "containerTexture"), 0);
+  glUniform1i(glGetUniformLocation(shaderProgram, "awesomeFaceTexture"), 1);
+  // samplers of different types must not share a unit, even unused ones
+  glUniform1i(glGetUniformLocation(shaderProgram, "shadowMap"),
+              shadowMapTextureUnit);
+
+  return shaderProgram;
+}
+
+void createClusteredLighting(ClusteredLighting *lighting, int lightCapacity) {
+  lighting->boundsProgram =
+      createComputeProgram("../shaders/cluster_bounds.comp");
+  lighting->transformProgram =
+      createComputeProgram("../shaders/cluster_transform_lights.comp");
+  lighting->binningProgram =
+      createComputeProgram("../shaders/cluster_lights.comp");
+
+  lighting->lightCapacity = lightCapacity;
+  lighting->lightCount = 0;
+  lighting->lightBuffer = createStorageBuffer(lightCapacity * sizeof(Light));
+  lighting->viewLightBuffer =
+      createStorageBuffer(lightCapacity * sizeof(Light));
+  lighting->clusterBoundsBuffer =
+      createStorageBuffer(clusterCount * 2 * sizeof(glm::vec4));
+  lighting->lightGridBuffer =
+      createStorageBuffer(clusterCount * 2 * sizeof(uint32_t));
+  // the first uint is the allocation counter for the index list
+  lighting->lightIndexBuffer =
+      createStorageBuffer((1 + lightIndexCapacity) * sizeof(uint32_t));
+
+  lighting->boundsWidth = 0;
+  lighting->boundsHeight = 0;
+
+  createGpuTimer(&lighting->boundsTimer);
+  createGpuTimer(&lighting->binningTimer);
+}
+
+void deleteClusteredLighting(ClusteredLighting *lighting) {
+  deleteGpuProgram(lighting->boundsProgram);
+  deleteGpuProgram(lighting->transformProgram);
+  deleteGpuProgram(lighting->binningProgram);
+
+  unsigned int buffers[] = {
+      lighting->lightBuffer,     lighting->viewLightBuffer,
+      lighting->clusterBoundsBuffer, lighting->lightGridBuffer,
+      lighting->lightIndexBuffer};
+  deleteGpuBuffers(5, buffers);
+
+  deleteGpuTimer(&lighting->boundsTimer);
+  deleteGpuTimer(&lighting->binningTimer);
+}
+
+void uploadLights(ClusteredLighting *lighting, const Light *lights,
+                  int lightCount) {
+  if (lightCount > lighting->lightCapacity) {
+    fprintf(stderr, "too many lights (%d), only %d fit\n", lightCount,
+            lighting->lightCapacity);
+    lightCount = lighting->lightCapacity;
+  }
+
+  lighting->lightCount = lightCount;
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, lighting->lightBuffer);
+  glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, lightCount * sizeof(Light),
+                  lights);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+static float randomFloat(unsigned int *state, float minimum, float maximum) {
+  // xorshift32, deterministic for a given seed so benchmark runs compare
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return minimum + (maximum - minimum) * ((*state >> 8) / 16777216.0f);
+}
+
+void generateLights(Light *lights, int lightCount, glm::vec3 boxMinimum,
+                    glm::vec3 boxMaximum, unsigned int seed) {
+  auto state = seed != 0 ? seed : 1u;
+
+  for (auto i = 0; i < lightCount; i++) {
+    auto &light = lights[i];
+    light.positionRange =
+        glm::vec4(randomFloat(&state, boxMinimum.x, boxMaximum.x),
+                  randomFloat(&state, boxMinimum.y, boxMaximum.y),
+                  randomFloat(&state, boxMinimum.z, boxMaximum.z),
+                  randomFloat(&state, 1.5f, 4.0f));
+    light.colorIntensity = glm::vec4(
+        randomFloat(&state, 0.2f, 1.0f), randomFloat(&state, 0.2f, 1.0f),
+        randomFloat(&state, 0.2f, 1.0f), randomFloat(&state, 2.0f, 6.0f));
+
+    if (i % 4 == 3) {
+      // spots mostly point down at the scene
+      auto direction = glm::normalize(
+          glm::vec3(randomFloat(&state, -0.5f, 0.5f), -1.0f,
+                    randomFloat(&state, -0.5f, 0.5f)));
+      auto outerAngle = randomFloat(&state, 25.0f, 45.0f);
+      light.directionSpotAngle =
+          glm::vec4(direction, cosf(glm::radians(outerAngle)));
+    } else {
+      light.directionSpotAngle = glm::vec4(0.0f, -1.0f, 0.0f, -2.0f);
+    }
+  }
+}
+
+void updateClusters(ClusteredLighting *lighting, const glm::mat4 &view,
+                    const glm::mat4 &projection, int width, int height) {
+  beginGpuTimer(&lighting->boundsTimer);
+  if (width != lighting->boundsWidth || height != lighting->boundsHeight ||
+      projection != lighting->boundsProjection) {
+    lighting->boundsProjection = projection;
+    lighting->boundsWidth = width;
+    lighting->boundsHeight = height;
+
+    auto program = lighting->boundsProgram;
+    glUseProgram(program);
+    glUniformMatrix4fv(glGetUniformLocation(program, "inverseProjection"), 1,
+                       GL_FALSE, glm::value_ptr(glm::inverse(projection)));
+    glUniform2f(glGetUniformLocation(program, "screenSize"), (float)width,
+                (float)height);
+    glUniform3ui(glGetUniformLocation(program, "gridSize"), clusterGridX,
+                 clusterGridY, clusterGridZ);
+    glUniform1f(glGetUniformLocation(program, "nearPlane"), cameraNearPlane);
+    glUniform1f(glGetUniformLocation(program, "farPlane"), cameraFarPlane);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, clusterBoundsBinding,
+                     lighting->clusterBoundsBuffer);
+    glDispatchCompute((clusterCount + 63) / 64, 1, 1);
+  }
+  endGpuTimer(&lighting->boundsTimer);
+
+  beginGpuTimer(&lighting->binningTimer);
+
+  // lights to view space, once per light instead of once per cluster test
+  auto program = lighting->transformProgram;
+  glUseProgram(program);
+  glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE,
+                     glm::value_ptr(view));
+  glUniform1ui(glGetUniformLocation(program, "lightCount"),
+               lighting->lightCount);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightsBinding,
+                   lighting->lightBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, viewLightsBinding,
+                   lighting->viewLightBuffer);
+  glDispatchCompute((lighting->lightCount + 63) / 64, 1, 1);
+
+  // reset the index list allocator
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, lighting->lightIndexBuffer);
+  glClearBufferSubData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, 0,
+                       sizeof(uint32_t), GL_RED_INTEGER, GL_UNSIGNED_INT,
+                       NULL);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+  // one work group per cluster
+  program = lighting->binningProgram;
+  glUseProgram(program);
+  glUniform1ui(glGetUniformLocation(program, "lightCount"),
+               lighting->lightCount);
+  glUniform1ui(glGetUniformLocation(program, "lightIndexCapacity"),
+               lightIndexCapacity);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, clusterBoundsBinding,
+                   lighting->clusterBoundsBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, viewLightsBinding,
+                   lighting->viewLightBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightGridBinding,
+                   lighting->lightGridBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightIndicesBinding,
+                   lighting->lightIndexBuffer);
+  glDispatchCompute(clusterCount, 1, 1);
+
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+  endGpuTimer(&lighting->binningTimer);
+}
+
+void useClusteredLighting(const ClusteredLighting &lighting,
+                          unsigned int shaderProgram, int width, int height) {
+  glUseProgram(shaderProgram);
+
+  // slice = log(depth) * scale + bias, the inverse of the exponential split
+  // in shaders/cluster_bounds.comp
+  auto logDepthRange = logf(cameraFarPlane / cameraNearPlane);
+  glUniform3ui(glGetUniformLocation(shaderProgram, "gridSize"), clusterGridX,
+               clusterGridY, clusterGridZ);
+  glUniform2f(glGetUniformLocation(shaderProgram, "tileSize"),
+              (float)width / clusterGridX, (float)height / clusterGridY);
+  glUniform1f(glGetUniformLocation(shaderProgram, "sliceScale"),
+              clusterGridZ / logDepthRange);
+  glUniform1f(glGetUniformLocation(shaderProgram, "sliceBias"),
+              -clusterGridZ * logf(cameraNearPlane) / logDepthRange);
+
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, viewLightsBinding,
+                   lighting.viewLightBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightGridBinding,
+                   lighting.lightGridBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightIndicesBinding,
+                   lighting.lightIndexBuffer);
+}
+
+void runClusteredLightingBenchmark(GLFWwindow *window) {
+  const int lightCounts[] = {1000, 2000, 5000, 10000};
+  const int fieldSize = 64;
+  const float fieldSpacing = 1.5f;
+  const int warmupFrames = 30;
+  const int measuredFrames = 240;
+
+  auto cube = createCubeMesh();
+
+  std::vector<glm::vec3> offsets;
+  auto halfField = fieldSize * fieldSpacing * 0.5f;
+  for (auto z = 0; z < fieldSize; z++) {
+    for (auto x = 0; x < fieldSize; x++) {
+      offsets.push_back(glm::vec3(x * fieldSpacing - halfField,
+                                  (float)((x * 7 + z * 13) % 3) * 0.5f,
+                                  z * fieldSpacing - halfField));
+    }
+  }
+
+  auto offsetsBuffer = createGpuBuffer(
+      GpuMemoryGeometry, GL_ARRAY_BUFFER, offsets.size() * sizeof(glm::vec3),
+      offsets.data(), GL_STATIC_DRAW);
+  attachInstanceOffsets(cube, offsetsBuffer);
+
+  auto shaderProgram = createLitShaderProgram();
+
+  auto containerTexture = buildContanierTexture();
+  auto awesomeFaceTexture = buildAwesomeFaceTexture();
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, containerTexture);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, awesomeFaceTexture);
+
+  ClusteredLighting lighting;
+  createClusteredLighting(&lighting, lightCounts[3]);
+
+  GpuTimer shadingTimer;
+  createGpuTimer(&shadingTimer);
+
+  std::vector<Light> lights(lightCounts[3]);
+  generateLights(lights.data(), (int)lights.size(),
+                 glm::vec3(-halfField, 0.5f, -halfField),
+                 glm::vec3(halfField, 6.0f, halfField), 1234);
+
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+  glViewport(0, 0, width, height);
+
+  auto view = glm::lookAt(glm::vec3(0.0f, 14.0f, halfField + 6.0f),
+                          glm::vec3(0.0f, 0.0f, 0.0f),
+                          glm::vec3(0.0f, 1.0f, 0.0f));
+  auto projection =
+      glm::perspective(glm::radians(60.0f), (float)width / (float)height,
+                       cameraNearPlane, cameraFarPlane);
+
+  printf("clustered lighting: %d cubes, %dx%d, %dx%dx%d clusters\n",
+         fieldSize * fieldSize, width, height, clusterGridX, clusterGridY,
+         clusterGridZ);
+
+  for (auto lightCount : lightCounts) {
+    uploadLights(&lighting, lights.data(), lightCount);
+
+    double cpuStart = 0.0;
+    for (auto frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+      if (frame == warmupFrames) {
+        resetGpuTimerAverage(&lighting.boundsTimer);
+        resetGpuTimerAverage(&lighting.binningTimer);
+        resetGpuTimerAverage(&shadingTimer);
+        cpuStart = glfwGetTime();
+      }
+
+      // force the bounds pass so its cost shows up, normally it only runs
+      // when the projection changes
+      lighting.boundsWidth = 0;
+      updateClusters(&lighting, view, projection, width, height);
+
+      beginGpuTimer(&shadingTimer);
+      glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+      useClusteredLighting(lighting, shaderProgram, width, height);
+      glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1,
+                         GL_FALSE, glm::value_ptr(view));
+      glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1,
+                         GL_FALSE, glm::value_ptr(projection));
+      glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1,
+                         GL_FALSE, glm::value_ptr(glm::mat4(1.0f)));
+
+      glBindVertexArray(cube.vertexArrayObject);
+      glDrawArraysInstanced(GL_TRIANGLES, 0, cube.vertexCount,
+                            (int)offsets.size());
+      endGpuTimer(&shadingTimer);
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+    auto cpuMilliseconds = (glfwGetTime() - cpuStart) * 1000.0 / measuredFrames;
+
+    uint32_t usedIndices;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, lighting.lightIndexBuffer);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(usedIndices),
+                       &usedIndices);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    printf("%5d lights | bounds %.3f ms, binning %.3f ms, shading %.3f ms, "
+           "frame %.3f ms | %.1f lights per cluster%s\n",
+           lightCount, gpuTimerAverageMilliseconds(lighting.boundsTimer),
+           gpuTimerAverageMilliseconds(lighting.binningTimer),
+           gpuTimerAverageMilliseconds(shadingTimer), cpuMilliseconds,
+           (double)usedIndices / clusterCount,
+           usedIndices > (uint32_t)lightIndexCapacity ? " (index list full)"
+                                                      : "");
+  }
+
+  deleteGpuTimer(&shadingTimer);
+  deleteClusteredLighting(&lighting);
+  deleteGpuTextures(1, &containerTexture);
+  deleteGpuTextures(1, &awesomeFaceTexture);
+  deleteGpuProgram(shaderProgram);
+  deleteGpuBuffers(1, &offsetsBuffer);
+  deleteMesh(&cube);
+}
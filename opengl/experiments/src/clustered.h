@@ -0,0 +1,77 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "gpu_timer.h"
+
+// 16x9 screen tiles split in 24 exponential depth slices
+const int clusterGridX = 16;
+const int clusterGridY = 9;
+const int clusterGridZ = 24;
+const int clusterCount = clusterGridX * clusterGridY * clusterGridZ;
+
+// Must match shaders/cluster_lights.comp
+const int maxLightsPerCluster = 256;
+const int averageLightsPerCluster = 64;
+
+// Same layout as `Light` in the cluster shaders (std430)
+struct Light {
+  // xyz position, w range
+  glm::vec4 positionRange;
+  // rgb color, w intensity
+  glm::vec4 colorIntensity;
+  // xyz direction, w cosine of the outer cone angle, below -1 for point
+  // lights
+  glm::vec4 directionSpotAngle;
+};
+
+struct ClusteredLighting {
+  unsigned int boundsProgram;
+  unsigned int transformProgram;
+  unsigned int binningProgram;
+
+  unsigned int lightBuffer;
+  unsigned int viewLightBuffer;
+  unsigned int clusterBoundsBuffer;
+  unsigned int lightGridBuffer;
+  unsigned int lightIndexBuffer;
+
+  int lightCount;
+  int lightCapacity;
+
+  // cluster bounds only depend on these, so they are rebuilt when they
+  // change instead of every frame
+  glm::mat4 boundsProjection;
+  int boundsWidth;
+  int boundsHeight;
+
+  GpuTimer boundsTimer;
+  GpuTimer binningTimer;
+};
+
+// Program built from shaders/clustered_*.glsl with its samplers assigned,
+// the shadow map sampler included even if shadows are never used
+unsigned int createLitShaderProgram();
+
+void createClusteredLighting(ClusteredLighting *lighting, int lightCapacity);
+void deleteClusteredLighting(ClusteredLighting *lighting);
+
+void uploadLights(ClusteredLighting *lighting, const Light *lights,
+                  int lightCount);
+// Random point and spot lights spread over a box, a quarter are spots
+void generateLights(Light *lights, int lightCount, glm::vec3 boxMinimum,
+                    glm::vec3 boxMaximum, unsigned int seed);
+
+// Bins the lights into the clusters of the given view, it must run once per
+// frame before drawing with the clustered shaders
+void updateClusters(ClusteredLighting *lighting, const glm::mat4 &view,
+                    const glm::mat4 &projection, int width, int height);
+// Binds the light lists and sets the uniforms the clustered fragment shader
+// needs to find its cluster
+void useClusteredLighting(const ClusteredLighting &lighting,
+                          unsigned int shaderProgram, int width, int height);
+
+// Renders a field of cubes lit by 1k to 10k lights and reports the GPU time
+// of each pass
+void runClusteredLightingBenchmark(GLFWwindow *window);
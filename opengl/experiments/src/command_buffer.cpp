@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "command_buffer.h"
+
+// payloads, all 4 byte aligned so they can be read in place
+struct ClearCommand {
+  float color[4];
+  uint32_t mask;
+};
+
+struct ViewportCommand {
+  int32_t x, y, width, height;
+};
+
+struct BindTextureCommand {
+  int32_t unit;
+  uint32_t target;
+  uint32_t texture;
+};
+
+struct UniformIntCommand {
+  int32_t location;
+  int32_t value;
+};
+
+struct UniformFloatCommand {
+  int32_t location;
+  float value;
+};
+
+struct UniformVec4Command {
+  int32_t location;
+  float value[4];
+};
+
+struct UniformMat4Command {
+  int32_t location;
+  float value[16];
+};
+
+struct DrawArraysCommand {
+  uint32_t mode;
+  int32_t first;
+  int32_t count;
+  int32_t instanceCount;
+};
+
+void resetCommandBuffer(CommandBuffer *buffer) {
+  buffer->size = 0;
+  buffer->commandCount = 0;
+  buffer->drawCount = 0;
+}
+
+static void record(CommandBuffer *buffer, CommandOpcode opcode,
+                   const void *payload, size_t payloadSize) {
+  CommandHeader header = {opcode, (uint16_t)payloadSize};
+  auto needed = buffer->size + sizeof(header) + payloadSize;
+  if (needed > buffer->data.size())
+    buffer->data.resize(needed > 4096 ? needed * 2 : 4096);
+
+  auto out = buffer->data.data() + buffer->size;
+  memcpy(out, &header, sizeof(header));
+  if (payloadSize > 0)
+    memcpy(out + sizeof(header), payload, payloadSize);
+  buffer->size = needed;
+  buffer->commandCount++;
+}
+
+void recordClear(CommandBuffer *buffer, glm::vec4 color, unsigned int mask) {
+  ClearCommand command = {{color.r, color.g, color.b, color.a}, mask};
+  record(buffer, CommandClear, &command, sizeof(command));
+}
+
+void recordViewport(CommandBuffer *buffer, int x, int y, int width,
+                    int height) {
+  ViewportCommand command = {x, y, width, height};
+  record(buffer, CommandViewport, &command, sizeof(command));
+}
+
+void recordUseProgram(CommandBuffer *buffer, unsigned int program) {
+  uint32_t command = program;
+  record(buffer, CommandUseProgram, &command, sizeof(command));
+}
+
+void recordBindTexture(CommandBuffer *buffer, int unit, unsigned int target,
+                       unsigned int texture) {
+  BindTextureCommand command = {unit, target, texture};
+  record(buffer, CommandBindTexture, &command, sizeof(command));
+}
+
+void recordBindVertexArray(CommandBuffer *buffer, unsigned int vertexArray) {
+  uint32_t command = vertexArray;
+  record(buffer, CommandBindVertexArray, &command, sizeof(command));
+}
+
+void recordUniform(CommandBuffer *buffer, int location, int value) {
+  UniformIntCommand command = {location, value};
+  record(buffer, CommandUniformInt, &command, sizeof(command));
+}
+
+void recordUniform(CommandBuffer *buffer, int location, float value) {
+  UniformFloatCommand command = {location, value};
+  record(buffer, CommandUniformFloat, &command, sizeof(command));
+}
+
+void recordUniform(CommandBuffer *buffer, int location,
+                   const glm::vec4 &value) {
+  UniformVec4Command command;
+  command.location = location;
+  memcpy(command.value, &value[0], sizeof(command.value));
+  record(buffer, CommandUniformVec4, &command, sizeof(command));
+}
+
+void recordUniform(CommandBuffer *buffer, int location,
+                   const glm::mat4 &value) {
+  UniformMat4Command command;
+  command.location = location;
+  memcpy(command.value, &value[0][0], sizeof(command.value));
+  record(buffer, CommandUniformMat4, &command, sizeof(command));
+}
+
+void recordDrawArrays(CommandBuffer *buffer, unsigned int mode, int first,
+                      int count) {
+  DrawArraysCommand command = {mode, first, count, 1};
+  record(buffer, CommandDrawArrays, &command, sizeof(command));
+  buffer->drawCount++;
+}
+
+void recordDrawArraysInstanced(CommandBuffer *buffer, unsigned int mode,
+                               int first, int count, int instanceCount) {
+  DrawArraysCommand command = {mode, first, count, instanceCount};
+  record(buffer, CommandDrawArraysInstanced, &command, sizeof(command));
+  buffer->drawCount++;
+}
+
+void replayCommandBuffer(const CommandBuffer &buffer) {
+  auto in = buffer.data.data();
+  auto end = in + buffer.size;
+
+  while (in < end) {
+    CommandHeader header;
+    memcpy(&header, in, sizeof(header));
+    auto payload = in + sizeof(header);
+    in = payload + header.size;
+
+    switch (header.opcode) {
+    case CommandClear: {
+      auto command = (const ClearCommand *)payload;
+      glClearColor(command->color[0], command->color[1], command->color[2],
+                   command->color[3]);
+      glClear(command->mask);
+      break;
+    }
+    case CommandViewport: {
+      auto command = (const ViewportCommand *)payload;
+      glViewport(command->x, command->y, command->width, command->height);
+      break;
+    }
+    case CommandUseProgram:
+      glUseProgram(*(const uint32_t *)payload);
+      break;
+    case CommandBindTexture: {
+      auto command = (const BindTextureCommand *)payload;
+      glActiveTexture(GL_TEXTURE0 + command->unit);
+      glBindTexture(command->target, command->texture);
+      break;
+    }
+    case CommandBindVertexArray:
+      glBindVertexArray(*(const uint32_t *)payload);
+      break;
+    case CommandUniformInt: {
+      auto command = (const UniformIntCommand *)payload;
+      glUniform1i(command->location, command->value);
+      break;
+    }
+    case CommandUniformFloat: {
+      auto command = (const UniformFloatCommand *)payload;
+      glUniform1f(command->location, command->value);
+      break;
+    }
+    case CommandUniformVec4: {
+      auto command = (const UniformVec4Command *)payload;
+      glUniform4fv(command->location, 1, command->value);
+      break;
+    }
+    case CommandUniformMat4: {
+      auto command = (const UniformMat4Command *)payload;
+      glUniformMatrix4fv(command->location, 1, GL_FALSE, command->value);
+      break;
+    }
+    case CommandDrawArrays: {
+      auto command = (const DrawArraysCommand *)payload;
+      glDrawArrays(command->mode, command->first, command->count);
+      break;
+    }
+    case CommandDrawArraysInstanced: {
+      auto command = (const DrawArraysCommand *)payload;
+      glDrawArraysInstanced(command->mode, command->first, command->count,
+                            command->instanceCount);
+      break;
+    }
+    default:
+      fprintf(stderr, "unknown render command %d\n", header.opcode);
+      return;
+    }
+  }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// Every command is a header followed by its payload, both plain data, so
+// recording is a memcpy into a linear buffer and never touches GL. Uniform
+// locations and object names must be resolved before recording
+enum CommandOpcode : uint16_t {
+  CommandClear,
+  CommandViewport,
+  CommandUseProgram,
+  CommandBindTexture,
+  CommandBindVertexArray,
+  CommandUniformInt,
+  CommandUniformFloat,
+  CommandUniformVec4,
+  CommandUniformMat4,
+  CommandDrawArrays,
+  CommandDrawArraysInstanced,
+};
+
+struct CommandHeader {
+  CommandOpcode opcode;
+  // payload bytes after the header
+  uint16_t size;
+};
+
+struct CommandBuffer {
+  std::vector<unsigned char> data;
+  // bytes in use, data only grows so its storage is reused every frame
+  size_t size;
+  int commandCount;
+  int drawCount;
+};
+
+void resetCommandBuffer(CommandBuffer *buffer);
+
+void recordClear(CommandBuffer *buffer, glm::vec4 color, unsigned int mask);
+void recordViewport(CommandBuffer *buffer, int x, int y, int width,
+                    int height);
+void recordUseProgram(CommandBuffer *buffer, unsigned int program);
+void recordBindTexture(CommandBuffer *buffer, int unit, unsigned int target,
+                       unsigned int texture);
+void recordBindVertexArray(CommandBuffer *buffer, unsigned int vertexArray);
+void recordUniform(CommandBuffer *buffer, int location, int value);
+void recordUniform(CommandBuffer *buffer, int location, float value);
+void recordUniform(CommandBuffer *buffer, int location, const glm::vec4 &value);
+void recordUniform(CommandBuffer *buffer, int location, const glm::mat4 &value);
+void recordDrawArrays(CommandBuffer *buffer, unsigned int mode, int first,
+                      int count);
+void recordDrawArraysInstanced(CommandBuffer *buffer, unsigned int mode,
+                               int first, int count, int instanceCount);
+
+// Issues the recorded commands on the current context
+void replayCommandBuffer(const CommandBuffer &buffer);
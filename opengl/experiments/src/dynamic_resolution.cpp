@@ -0,0 +1,413 @@
+#include <math.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "camera.h"
+#include "clustered.h"
+#include "dynamic_resolution.h"
+#include "gpu_memory.h"
+#include "meshes.h"
+#include "shaders.h"
+#include "textures.h"
+
+// Texture units of the upscale passes, above the ones the scene uses
+const int sceneTextureUnit = 6;
+const int sceneDepthTextureUnit = 7;
+const int historyTextureUnit = 8;
+
+// how much of the history is kept every frame
+const float historyWeight = 0.9f;
+// the controller ignores errors smaller than this to not oscillate
+const float scaleDeadband = 0.03f;
+// and only moves part of the way, the measured time is gpuTimerLatency
+// frames old
+const float scaleResponse = 0.25f;
+const int jitterSequenceLength = 8;
+
+void createDynamicResolution(DynamicResolution *resolution,
+                             float targetMilliseconds, bool temporal) {
+  resolution->targetMilliseconds = targetMilliseconds;
+  resolution->minimumScale = 0.5f;
+  resolution->maximumScale = 1.0f;
+  resolution->temporal = temporal;
+  resolution->scale = 1.0f;
+
+  resolution->windowWidth = 0;
+  resolution->windowHeight = 0;
+  resolution->renderWidth = 0;
+  resolution->renderHeight = 0;
+
+  glGenFramebuffers(1, &resolution->framebuffer);
+  glGenFramebuffers(2, resolution->historyFramebuffers);
+  resolution->colorTexture = 0;
+  resolution->depthTexture = 0;
+  resolution->historyTextures[0] = 0;
+  resolution->historyTextures[1] = 0;
+  resolution->historyIndex = 0;
+  resolution->historyValid = false;
+
+  resolution->jitter = glm::vec2(0.0f);
+  resolution->previousViewProjection = glm::mat4(1.0f);
+  resolution->frame = 0;
+
+  resolution->upscaleProgram = createShaderProgram(
+      "../shaders/fullscreen_vertex.glsl", "../shaders/upscale_fragment.glsl");
+  glUseProgram(resolution->upscaleProgram);
+  glUniform1i(glGetUniformLocation(resolution->upscaleProgram, "sceneTexture"),
+              sceneTextureUnit);
+
+  resolution->temporalProgram = createShaderProgram(
+      "../shaders/fullscreen_vertex.glsl", "../shaders/temporal_fragment.glsl");
+  glUseProgram(resolution->temporalProgram);
+  glUniform1i(
+      glGetUniformLocation(resolution->temporalProgram, "sceneTexture"),
+      sceneTextureUnit);
+  glUniform1i(
+      glGetUniformLocation(resolution->temporalProgram, "depthTexture"),
+      sceneDepthTextureUnit);
+  glUniform1i(
+      glGetUniformLocation(resolution->temporalProgram, "historyTexture"),
+      historyTextureUnit);
+
+  glGenVertexArrays(1, &resolution->vertexArray);
+  createGpuTimer(&resolution->frameTimer);
+}
+
+static void deleteTargets(DynamicResolution *resolution) {
+  unsigned int textures[] = {resolution->colorTexture,
+                             resolution->depthTexture,
+                             resolution->historyTextures[0],
+                             resolution->historyTextures[1]};
+  deleteGpuTextures(4, textures);
+}
+
+void deleteDynamicResolution(DynamicResolution *resolution) {
+  deleteTargets(resolution);
+  glDeleteFramebuffers(1, &resolution->framebuffer);
+  glDeleteFramebuffers(2, resolution->historyFramebuffers);
+  deleteGpuProgram(resolution->upscaleProgram);
+  deleteGpuProgram(resolution->temporalProgram);
+  glDeleteVertexArrays(1, &resolution->vertexArray);
+  deleteGpuTimer(&resolution->frameTimer);
+}
+
+static unsigned int createTarget(GLenum format, int width, int height) {
+  auto texture = createGpuTexture(GpuMemoryRenderTargets, GL_TEXTURE_2D, 1,
+                                  format, width, height, 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+  return texture;
+}
+
+static void resizeTargets(DynamicResolution *resolution, int width,
+                          int height) {
+  deleteTargets(resolution);
+  resolution->windowWidth = width;
+  resolution->windowHeight = height;
+
+  resolution->colorTexture = createTarget(GL_RGBA8, width, height);
+  resolution->depthTexture =
+      createTarget(GL_DEPTH_COMPONENT32F, width, height);
+  glBindFramebuffer(GL_FRAMEBUFFER, resolution->framebuffer);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         resolution->colorTexture, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D,
+                         resolution->depthTexture, 0);
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    fprintf(stderr, "dynamic resolution framebuffer is incomplete\n");
+
+  // float history so the slow blend does not band
+  for (auto i = 0; i < 2; i++) {
+    resolution->historyTextures[i] = createTarget(GL_RGBA16F, width, height);
+    glBindFramebuffer(GL_FRAMEBUFFER, resolution->historyFramebuffers[i]);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           resolution->historyTextures[i], 0);
+  }
+  resolution->historyValid = false;
+
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static float halton(int index, int base) {
+  auto fraction = 1.0f;
+  auto result = 0.0f;
+  while (index > 0) {
+    fraction /= base;
+    result += fraction * (index % base);
+    index /= base;
+  }
+
+  return result;
+}
+
+void beginDynamicResolutionFrame(DynamicResolution *resolution,
+                                 int windowWidth, int windowHeight) {
+  // minimized windows report a zero size, keep rendering at the last one
+  if ((windowWidth != resolution->windowWidth ||
+       windowHeight != resolution->windowHeight) &&
+      windowWidth > 0 && windowHeight > 0)
+    resizeTargets(resolution, windowWidth, windowHeight);
+
+  beginGpuTimer(&resolution->frameTimer);
+
+  auto measured = (float)resolution->frameTimer.lastMilliseconds;
+  if (measured > 0.0f) {
+    // GPU time mostly follows the pixel count, which goes with the square
+    // of the scale
+    auto ideal = resolution->scale *
+                 sqrtf(resolution->targetMilliseconds / measured);
+    ideal = fminf(fmaxf(ideal, resolution->minimumScale),
+                  resolution->maximumScale);
+    if (fabsf(ideal - resolution->scale) > scaleDeadband * resolution->scale)
+      resolution->scale += (ideal - resolution->scale) * scaleResponse;
+  }
+
+  resolution->renderWidth =
+      glm::max(1, (int)(resolution->windowWidth * resolution->scale + 0.5f));
+  resolution->renderHeight =
+      glm::max(1, (int)(resolution->windowHeight * resolution->scale + 0.5f));
+
+  if (resolution->temporal) {
+    // offsets in -0.5..0.5 pixels that cover the pixel evenly over a few
+    // frames, index 0 of the sequence is skipped since it is always 0
+    auto index = resolution->frame % jitterSequenceLength + 1;
+    resolution->jitter =
+        glm::vec2(halton(index, 2) - 0.5f, halton(index, 3) - 0.5f);
+  }
+  resolution->frame++;
+}
+
+glm::mat4 jitterProjection(const DynamicResolution &resolution,
+                           const glm::mat4 &projection) {
+  if (!resolution.temporal)
+    return projection;
+
+  // applied after the projection so it moves by the same amount in NDC
+  // everywhere regardless of depth
+  auto offset = glm::vec3(2.0f * resolution.jitter.x / resolution.renderWidth,
+                          2.0f * resolution.jitter.y / resolution.renderHeight,
+                          0.0f);
+  return glm::translate(glm::mat4(1.0f), offset) * projection;
+}
+
+void bindDynamicResolutionTarget(const DynamicResolution &resolution) {
+  glBindFramebuffer(GL_FRAMEBUFFER, resolution.framebuffer);
+  glViewport(0, 0, resolution.renderWidth, resolution.renderHeight);
+}
+
+void endDynamicResolutionFrame(DynamicResolution *resolution,
+                               const glm::mat4 &view,
+                               const glm::mat4 &projection) {
+  glDisable(GL_DEPTH_TEST);
+  glActiveTexture(GL_TEXTURE0 + sceneTextureUnit);
+  glBindTexture(GL_TEXTURE_2D, resolution->colorTexture);
+  glBindVertexArray(resolution->vertexArray);
+
+  auto windowSize =
+      glm::vec2(resolution->windowWidth, resolution->windowHeight);
+  glViewport(0, 0, resolution->windowWidth, resolution->windowHeight);
+
+  if (resolution->temporal) {
+    auto program = resolution->temporalProgram;
+    auto viewProjection = projection * view;
+    auto read = resolution->historyIndex;
+    auto write = 1 - read;
+
+    glActiveTexture(GL_TEXTURE0 + sceneDepthTextureUnit);
+    glBindTexture(GL_TEXTURE_2D, resolution->depthTexture);
+    glActiveTexture(GL_TEXTURE0 + historyTextureUnit);
+    glBindTexture(GL_TEXTURE_2D, resolution->historyTextures[read]);
+
+    glUseProgram(program);
+    glUniform2fv(glGetUniformLocation(program, "windowSize"), 1,
+                 glm::value_ptr(windowSize));
+    glUniform2i(glGetUniformLocation(program, "renderSize"),
+                resolution->renderWidth, resolution->renderHeight);
+    glUniform2fv(glGetUniformLocation(program, "jitter"), 1,
+                 glm::value_ptr(resolution->jitter));
+    glUniform1f(glGetUniformLocation(program, "historyWeight"),
+                resolution->historyValid ? historyWeight : 0.0f);
+    glUniformMatrix4fv(glGetUniformLocation(program, "inverseViewProjection"),
+                       1, GL_FALSE,
+                       glm::value_ptr(glm::inverse(viewProjection)));
+    glUniformMatrix4fv(
+        glGetUniformLocation(program, "previousViewProjection"), 1, GL_FALSE,
+        glm::value_ptr(resolution->previousViewProjection));
+
+    glBindFramebuffer(GL_FRAMEBUFFER, resolution->historyFramebuffers[write]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER,
+                      resolution->historyFramebuffers[write]);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, resolution->windowWidth, resolution->windowHeight,
+                      0, 0, resolution->windowWidth, resolution->windowHeight,
+                      GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+    resolution->historyIndex = write;
+    resolution->historyValid = true;
+    resolution->previousViewProjection = viewProjection;
+  } else {
+    auto program = resolution->upscaleProgram;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glUseProgram(program);
+    glUniform2fv(glGetUniformLocation(program, "windowSize"), 1,
+                 glm::value_ptr(windowSize));
+    glUniform2f(glGetUniformLocation(program, "renderScale"),
+                (float)resolution->renderWidth / resolution->windowWidth,
+                (float)resolution->renderHeight / resolution->windowHeight);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glEnable(GL_DEPTH_TEST);
+  endGpuTimer(&resolution->frameTimer);
+}
+
+void printDynamicResolutionStats(DynamicResolution *resolution) {
+  printf("dynamic resolution | scale %.2f (%dx%d), GPU frame %.3f ms, "
+         "target %.3f ms\n",
+         resolution->scale, resolution->renderWidth, resolution->renderHeight,
+         gpuTimerAverageMilliseconds(resolution->frameTimer),
+         resolution->targetMilliseconds);
+  resetGpuTimerAverage(&resolution->frameTimer);
+}
+
+void runDynamicResolutionBenchmark(GLFWwindow *window,
+                                   float targetMilliseconds) {
+  // the light count goes up and back down so the scale has to follow
+  const int phaseLightCounts[] = {1000, 4000, 10000, 4000, 1000};
+  const int framesPerPhase = 180;
+  const int fieldSize = 64;
+  const float fieldSpacing = 1.5f;
+
+  // a hidden window can still be resized, 1080p gives the controller room
+  glfwSetWindowSize(window, 1920, 1080);
+  int windowWidth, windowHeight;
+  glfwGetFramebufferSize(window, &windowWidth, &windowHeight);
+
+  auto cube = createCubeMesh();
+
+  std::vector<glm::vec3> offsets;
+  auto halfField = fieldSize * fieldSpacing * 0.5f;
+  for (auto z = 0; z < fieldSize; z++) {
+    for (auto x = 0; x < fieldSize; x++) {
+      offsets.push_back(glm::vec3(x * fieldSpacing - halfField,
+                                  (float)((x * 7 + z * 13) % 3) * 0.5f,
+                                  z * fieldSpacing - halfField));
+    }
+  }
+
+  auto offsetsBuffer = createGpuBuffer(
+      GpuMemoryGeometry, GL_ARRAY_BUFFER, offsets.size() * sizeof(glm::vec3),
+      offsets.data(), GL_STATIC_DRAW);
+  attachInstanceOffsets(cube, offsetsBuffer);
+
+  auto shaderProgram = createLitShaderProgram();
+  auto containerTexture = buildContanierTexture();
+  auto awesomeFaceTexture = buildAwesomeFaceTexture();
+
+  auto maxLights = phaseLightCounts[2];
+  ClusteredLighting lighting;
+  createClusteredLighting(&lighting, maxLights);
+  std::vector<Light> lights(maxLights);
+  generateLights(lights.data(), maxLights,
+                 glm::vec3(-halfField, 0.5f, -halfField),
+                 glm::vec3(halfField, 6.0f, halfField), 1234);
+
+  auto projection = glm::perspective(
+      glm::radians(60.0f), (float)windowWidth / (float)windowHeight,
+      cameraNearPlane, cameraFarPlane);
+
+  printf("dynamic resolution: %dx%d window, target %.2f ms, %d cubes\n",
+         windowWidth, windowHeight, targetMilliseconds, fieldSize * fieldSize);
+
+  for (auto temporal = 0; temporal < 2; temporal++) {
+    DynamicResolution resolution;
+    createDynamicResolution(&resolution, targetMilliseconds, temporal);
+    printf("%s upscaling\n", temporal ? "temporal" : "bilinear");
+
+    auto frame = 0;
+    for (auto lightCount : phaseLightCounts) {
+      uploadLights(&lighting, lights.data(), lightCount);
+
+      auto scaleSum = 0.0;
+      auto minimumScale = 1.0f;
+      auto maximumScale = 0.0f;
+      auto cpuStart = glfwGetTime();
+      resetGpuTimerAverage(&resolution.frameTimer);
+
+      for (auto phaseFrame = 0; phaseFrame < framesPerPhase; phaseFrame++) {
+        // slow orbit so the temporal history has to be reprojected
+        auto angle = frame++ * 0.002f;
+        auto eye = glm::vec3(sinf(angle) * (halfField + 6.0f), 14.0f,
+                             cosf(angle) * (halfField + 6.0f));
+        auto view = glm::lookAt(eye, glm::vec3(0.0f),
+                                glm::vec3(0.0f, 1.0f, 0.0f));
+
+        beginDynamicResolutionFrame(&resolution, windowWidth, windowHeight);
+        auto width = resolution.renderWidth;
+        auto height = resolution.renderHeight;
+        scaleSum += resolution.scale;
+        minimumScale = fminf(minimumScale, resolution.scale);
+        maximumScale = fmaxf(maximumScale, resolution.scale);
+
+        updateClusters(&lighting, view, projection, width, height);
+
+        bindDynamicResolutionTarget(resolution);
+        glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, containerTexture);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, awesomeFaceTexture);
+
+        auto jitteredProjection = jitterProjection(resolution, projection);
+        useClusteredLighting(lighting, shaderProgram, width, height);
+        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1,
+                           GL_FALSE, glm::value_ptr(view));
+        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"),
+                           1, GL_FALSE, glm::value_ptr(jitteredProjection));
+        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1,
+                           GL_FALSE, glm::value_ptr(glm::mat4(1.0f)));
+
+        glBindVertexArray(cube.vertexArrayObject);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, cube.vertexCount,
+                              (int)offsets.size());
+
+        endDynamicResolutionFrame(&resolution, view, projection);
+
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+      }
+
+      auto cpuMilliseconds =
+          (glfwGetTime() - cpuStart) * 1000.0 / framesPerPhase;
+      printf("%5d lights | scale %.2f average (%.2f - %.2f), ending at "
+             "%dx%d | GPU frame %.3f ms, frame %.3f ms\n",
+             lightCount, scaleSum / framesPerPhase, minimumScale,
+             maximumScale, resolution.renderWidth, resolution.renderHeight,
+             gpuTimerAverageMilliseconds(resolution.frameTimer),
+             cpuMilliseconds);
+    }
+
+    deleteDynamicResolution(&resolution);
+  }
+
+  deleteClusteredLighting(&lighting);
+  deleteGpuTextures(1, &containerTexture);
+  deleteGpuTextures(1, &awesomeFaceTexture);
+  deleteGpuProgram(shaderProgram);
+  deleteGpuBuffers(1, &offsetsBuffer);
+  deleteMesh(&cube);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "gpu_timer.h"
+
+// The scene is rendered into an offscreen target at a fraction of the
+// window size. A controller picks the fraction every frame from the
+// measured GPU frame time, then the frame is upscaled to the window, either
+// bilinearly or by accumulating jittered frames over time
+struct DynamicResolution {
+  float targetMilliseconds;
+  float minimumScale;
+  float maximumScale;
+  bool temporal;
+
+  float scale;
+  int windowWidth;
+  int windowHeight;
+  int renderWidth;
+  int renderHeight;
+
+  // allocated at the window size, only the bottom left render size corner
+  // is used so scale changes never reallocate
+  unsigned int framebuffer;
+  unsigned int colorTexture;
+  unsigned int depthTexture;
+
+  unsigned int historyFramebuffers[2];
+  unsigned int historyTextures[2];
+  int historyIndex;
+  bool historyValid;
+
+  // in render pixels
+  glm::vec2 jitter;
+  glm::mat4 previousViewProjection;
+  int frame;
+
+  unsigned int upscaleProgram;
+  unsigned int temporalProgram;
+  unsigned int vertexArray;
+
+  GpuTimer frameTimer;
+};
+
+void createDynamicResolution(DynamicResolution *resolution,
+                             float targetMilliseconds, bool temporal);
+void deleteDynamicResolution(DynamicResolution *resolution);
+
+// Must be the first GPU work of the frame, it starts the frame timer and
+// picks the render size from the last measured frame time
+void beginDynamicResolutionFrame(DynamicResolution *resolution,
+                                 int windowWidth, int windowHeight);
+
+// Shifts the projection by the jitter of this frame, a no-op without
+// temporal accumulation
+glm::mat4 jitterProjection(const DynamicResolution &resolution,
+                           const glm::mat4 &projection);
+
+// Binds the offscreen target with a render sized viewport
+void bindDynamicResolutionTarget(const DynamicResolution &resolution);
+
+// Upscales the frame into the default framebuffer and stops the frame
+// timer. The projection is the one without jitter
+void endDynamicResolutionFrame(DynamicResolution *resolution,
+                               const glm::mat4 &view,
+                               const glm::mat4 &projection);
+
+void printDynamicResolutionStats(DynamicResolution *resolution);
+
+// Ramps the number of lights over a lit cube field and reports how the
+// resolution scale follows the GPU frame time
+void runDynamicResolutionBenchmark(GLFWwindow *window,
+                                   float targetMilliseconds);
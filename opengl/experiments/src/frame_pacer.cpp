@@ -0,0 +1,172 @@
+#include <stdio.h>
+
+#include <chrono>
+#include <thread>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "benchmark_scene.h"
+#include "camera.h"
+#include "frame_pacer.h"
+
+// woken up this much before the predicted start of the frame, to absorb
+// sleep and estimate jitter
+const double pacingMargin = 0.001;
+// the OS sleep overshoots, the last stretch is spent yielding instead
+const double spinThreshold = 0.0005;
+
+void createFramePacer(FramePacer *pacer, GLFWwindow *window, SwapMode mode,
+                      bool lowLatency) {
+  pacer->window = window;
+  pacer->mode = setSwapMode(mode);
+  pacer->lowLatency = lowLatency;
+
+  auto monitor = glfwGetWindowMonitor(window);
+  if (monitor == NULL)
+    monitor = glfwGetPrimaryMonitor();
+  auto videoMode = monitor != NULL ? glfwGetVideoMode(monitor) : NULL;
+  auto refreshRate =
+      videoMode != NULL && videoMode->refreshRate > 0 ? videoMode->refreshRate
+                                                      : 60;
+  pacer->refreshPeriod = 1.0 / refreshRate;
+
+  pacer->lastPresentTime = 0.0;
+  pacer->presentInterval = pacer->refreshPeriod;
+  pacer->renderEstimate = 0.0;
+  pacer->inputTime = glfwGetTime();
+
+  pacer->totalLatency = 0.0;
+  pacer->totalRender = 0.0;
+  pacer->totalSleep = 0.0;
+  pacer->samples = 0;
+  pacer->missed = 0;
+}
+
+void waitForFrameStart(FramePacer *pacer) {
+  if (!pacer->lowLatency || pacer->lastPresentTime == 0.0)
+    return;
+
+  auto deadline = pacer->lastPresentTime + pacer->refreshPeriod -
+                  pacer->renderEstimate - pacingMargin;
+  auto start = glfwGetTime();
+  auto now = start;
+  if (deadline - now > spinThreshold) {
+    std::this_thread::sleep_for(
+        std::chrono::duration<double>(deadline - now - spinThreshold));
+  }
+  while ((now = glfwGetTime()) < deadline)
+    std::this_thread::yield();
+
+  pacer->totalSleep += now - start;
+}
+
+void markInputSampled(FramePacer *pacer) { pacer->inputTime = glfwGetTime(); }
+
+void presentFrame(FramePacer *pacer) {
+  // the wait for the GPU is only worth it when the render time feeds the
+  // pacing
+  if (pacer->lowLatency)
+    glFinish();
+  auto renderTime = glfwGetTime() - pacer->inputTime;
+
+  glfwSwapBuffers(pacer->window);
+  glFinish();
+  auto presentTime = glfwGetTime();
+
+  if (pacer->lastPresentTime > 0.0) {
+    auto interval = presentTime - pacer->lastPresentTime;
+    pacer->presentInterval = pacer->presentInterval * 0.9 + interval * 0.1;
+    if (pacer->mode != SwapImmediate && interval > pacer->refreshPeriod * 1.5)
+      pacer->missed++;
+  }
+  pacer->lastPresentTime = presentTime;
+
+  if (renderTime > pacer->renderEstimate)
+    pacer->renderEstimate = renderTime;
+  else
+    pacer->renderEstimate = pacer->renderEstimate * 0.95 + renderTime * 0.05;
+
+  // the frame scans out over the following refresh, half of it gets to the
+  // middle of the screen
+  pacer->totalLatency +=
+      presentTime - pacer->inputTime + pacer->refreshPeriod * 0.5;
+  pacer->totalRender += renderTime;
+  pacer->samples++;
+}
+
+double motionToPhotonMilliseconds(const FramePacer &pacer) {
+  return pacer.samples > 0 ? pacer.totalLatency * 1000.0 / pacer.samples
+                           : 0.0;
+}
+
+void printFramePacerStats(FramePacer *pacer) {
+  const char *modeNames[] = {"immediate", "vsync", "adaptive vsync"};
+  auto samples = pacer->samples > 0 ? pacer->samples : 1;
+  auto latency = motionToPhotonMilliseconds(*pacer);
+
+  printf("frame pacing | %s%s, present every %.2f ms, render %.2f ms, "
+         "slept %.2f ms, motion to photon %.2f ms (%.2f frames), %d missed\n",
+         modeNames[pacer->mode], pacer->lowLatency ? " low latency" : "",
+         pacer->presentInterval * 1000.0,
+         pacer->totalRender * 1000.0 / samples,
+         pacer->totalSleep * 1000.0 / samples, latency,
+         latency / (pacer->refreshPeriod * 1000.0), pacer->missed);
+
+  pacer->totalLatency = 0.0;
+  pacer->totalRender = 0.0;
+  pacer->totalSleep = 0.0;
+  pacer->samples = 0;
+  pacer->missed = 0;
+}
+
+void runLatencyBenchmark(GLFWwindow *window) {
+  struct PacingConfiguration {
+    SwapMode mode;
+    bool lowLatency;
+  };
+  const PacingConfiguration configurations[] = {
+      {SwapVsync, false},
+      {SwapVsync, true},
+      {SwapAdaptive, true},
+      {SwapImmediate, false},
+  };
+  const int measuredFrames = 300;
+
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+  glViewport(0, 0, width, height);
+
+  BenchmarkScene scene;
+  createBenchmarkScene(&scene, 32, 500);
+  auto projection =
+      glm::perspective(glm::radians(60.0f), (float)width / (float)height,
+                       cameraNearPlane, cameraFarPlane);
+
+  printf("latency: %dx%d, %d cubes, hidden windows may not be synced to "
+         "the display\n",
+         width, height, scene.cubeCount);
+
+  auto frame = 0;
+  for (auto &configuration : configurations) {
+    FramePacer pacer;
+    createFramePacer(&pacer, window, configuration.mode,
+                     configuration.lowLatency);
+
+    for (auto i = 0; i < measuredFrames; i++) {
+      waitForFrameStart(&pacer);
+      glfwPollEvents();
+      markInputSampled(&pacer);
+
+      auto view = benchmarkSceneView(scene, frame++ * 0.01f);
+      drawBenchmarkScene(&scene, view, projection, width, height);
+      presentFrame(&pacer);
+    }
+
+    printFramePacerStats(&pacer);
+  }
+
+  setSwapMode(SwapVsync);
+  deleteBenchmarkScene(&scene);
+}
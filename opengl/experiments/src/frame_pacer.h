@@ -0,0 +1,52 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+
+#include "window.h"
+
+// Presents frames and estimates when the display shows them. In low
+// latency mode the start of each frame is delayed to just before the
+// deadline of the next refresh, so the input it samples is as fresh as
+// possible when the frame reaches the screen
+struct FramePacer {
+  GLFWwindow *window;
+  SwapMode mode;
+  bool lowLatency;
+
+  double refreshPeriod;
+  // when the last swap completed, roughly when it got to the display
+  double lastPresentTime;
+  double presentInterval;
+  // input sampling to GPU done, rises at once and decays slowly so the
+  // pacer errs on the side of waking up early
+  double renderEstimate;
+  double inputTime;
+
+  // since the last report
+  double totalLatency;
+  double totalRender;
+  double totalSleep;
+  int samples;
+  int missed;
+};
+
+void createFramePacer(FramePacer *pacer, GLFWwindow *window, SwapMode mode,
+                      bool lowLatency);
+
+// Sleeps until the latest point the frame can start and still make the
+// next refresh, returns at once without low latency
+void waitForFrameStart(FramePacer *pacer);
+// Call right after polling the input of the frame
+void markInputSampled(FramePacer *pacer);
+// Swaps and waits for the swap to complete, like the glFinish after swap
+// option of GLFW's tests/inputlag.c
+void presentFrame(FramePacer *pacer);
+
+// Input sampling to the middle of the scanout of the frame, averaged since
+// the last report
+double motionToPhotonMilliseconds(const FramePacer &pacer);
+
+void printFramePacerStats(FramePacer *pacer);
+
+// Compares the latency of the pacing and swap modes on a lit cube field
+void runLatencyBenchmark(GLFWwindow *window);
@@ -0,0 +1,645 @@
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+
+#include "gltf.h"
+#include "gpu_memory.h"
+#include "json.h"
+
+const uint32_t glbMagic = 0x46546C67;     // "glTF"
+const uint32_t glbJsonChunk = 0x4E4F534A; // "JSON"
+const uint32_t glbBinaryChunk = 0x004E4942; // "BIN\0"
+
+struct GltfPendingLoad {
+  std::string filePath;
+  void *mapping;
+  size_t mappingSize;
+
+  const char *json;
+  size_t jsonLength;
+  const unsigned char *binary;
+  size_t binaryLength;
+
+  std::thread worker;
+  std::atomic<bool> ready;
+  bool succeeded;
+  std::string error;
+
+  GltfScene scene;
+  double startTime;
+  double parseSeconds;
+  double decodeSeconds;
+};
+
+static bool mapGlbFile(GltfPendingLoad *load) {
+  auto fileDescriptor = open(load->filePath.c_str(), O_RDONLY);
+  if (fileDescriptor < 0) {
+    load->error = "unable to open the file";
+    return false;
+  }
+
+  struct stat fileStatus;
+  if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size < 20) {
+    close(fileDescriptor);
+    load->error = "file is too small to be a glb";
+    return false;
+  }
+
+  load->mappingSize = (size_t)fileStatus.st_size;
+  load->mapping =
+      mmap(NULL, load->mappingSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  // the mapping keeps its own reference to the file
+  close(fileDescriptor);
+
+  if (load->mapping == MAP_FAILED) {
+    load->mapping = NULL;
+    load->error = "unable to map the file";
+    return false;
+  }
+
+  auto bytes = (const unsigned char *)load->mapping;
+  uint32_t header[3];
+  memcpy(header, bytes, sizeof(header));
+  if (header[0] != glbMagic || header[1] != 2 ||
+      header[2] > load->mappingSize) {
+    load->error = "not a glTF 2.0 binary file";
+    return false;
+  }
+
+  // chunks: JSON first (required), then an optional BIN chunk
+  size_t offset = 12;
+  while (offset + 8 <= header[2]) {
+    uint32_t chunk[2];
+    memcpy(chunk, bytes + offset, sizeof(chunk));
+    offset += 8;
+    if (offset + chunk[0] > header[2]) {
+      load->error = "chunk extends past the end of the file";
+      return false;
+    }
+
+    if (chunk[1] == glbJsonChunk && load->json == NULL) {
+      load->json = (const char *)bytes + offset;
+      load->jsonLength = chunk[0];
+    } else if (chunk[1] == glbBinaryChunk && load->binary == NULL) {
+      load->binary = bytes + offset;
+      load->binaryLength = chunk[0];
+    }
+
+    offset += chunk[0];
+  }
+
+  if (load->json == NULL) {
+    load->error = "missing JSON chunk";
+    return false;
+  }
+
+  // start paging the binary chunk in while the worker parses the JSON
+  if (load->binary != NULL) {
+    auto pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    auto pageStart = (size_t)(load->binary - bytes) & ~(pageSize - 1);
+    madvise((char *)load->mapping + pageStart,
+            load->binaryLength + ((size_t)(load->binary - bytes) - pageStart),
+            MADV_WILLNEED);
+  }
+
+  return true;
+}
+
+static int componentCountOf(const std::string &type) {
+  if (type == "SCALAR")
+    return 1;
+  if (type == "VEC2")
+    return 2;
+  if (type == "VEC3")
+    return 3;
+  if (type == "VEC4")
+    return 4;
+
+  return 0;
+}
+
+static size_t componentSizeOf(unsigned int componentType) {
+  switch (componentType) {
+  case GL_BYTE:
+  case GL_UNSIGNED_BYTE:
+    return 1;
+  case GL_SHORT:
+  case GL_UNSIGNED_SHORT:
+    return 2;
+  case GL_UNSIGNED_INT:
+  case GL_FLOAT:
+    return 4;
+  }
+
+  return 0;
+}
+
+static glm::vec3 readVec3(const JsonValue *value, glm::vec3 fallback) {
+  if (value == NULL || value->type != JsonArray || value->array.size() != 3)
+    return fallback;
+
+  return glm::vec3(value->array[0].asFloat(), value->array[1].asFloat(),
+                   value->array[2].asFloat());
+}
+
+static bool decodeNodes(const JsonValue &document, GltfScene *scene,
+                        std::string *error) {
+  auto nodes = document.find("nodes");
+  if (nodes == NULL)
+    return true;
+
+  scene->nodes.resize(nodes->array.size());
+  std::vector<bool> isChild(nodes->array.size(), false);
+
+  for (size_t i = 0; i < nodes->array.size(); i++) {
+    auto &source = nodes->array[i];
+    auto &node = scene->nodes[i];
+    node.mesh = -1;
+    if (auto mesh = source.find("mesh"))
+      node.mesh = mesh->asInt(-1);
+    if (node.mesh >= (int)scene->meshes.size())
+      node.mesh = -1;
+
+    if (auto children = source.find("children")) {
+      for (auto &child : children->array) {
+        auto childIndex = child.asInt(-1);
+        if (childIndex < 0 || childIndex >= (int)nodes->array.size()) {
+          *error = "node child out of range";
+          return false;
+        }
+        node.children.push_back(childIndex);
+        isChild[childIndex] = true;
+      }
+    }
+
+    auto matrix = source.find("matrix");
+    if (matrix != NULL && matrix->array.size() == 16) {
+      // glTF matrices are column-major, same as glm
+      float values[16];
+      for (auto j = 0; j < 16; j++)
+        values[j] = matrix->array[j].asFloat();
+
+      glm::vec3 skew;
+      glm::vec4 perspective;
+      if (!glm::decompose(glm::make_mat4(values), node.scale, node.rotation,
+                          node.translation, skew, perspective)) {
+        // singular matrix, the node collapses to nothing
+        node.translation = glm::vec3(0.0f);
+        node.rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        node.scale = glm::vec3(0.0f);
+      }
+    } else {
+      node.translation =
+          readVec3(source.find("translation"), glm::vec3(0.0f));
+      node.scale = readVec3(source.find("scale"), glm::vec3(1.0f));
+      node.rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+      auto rotation = source.find("rotation");
+      if (rotation != NULL && rotation->array.size() == 4) {
+        // glTF stores quaternions as x, y, z, w
+        node.rotation = glm::quat(
+            rotation->array[3].asFloat(), rotation->array[0].asFloat(),
+            rotation->array[1].asFloat(), rotation->array[2].asFloat());
+      }
+    }
+  }
+
+  // roots come from the default scene, or every node without a parent
+  const JsonValue *rootList = NULL;
+  if (auto scenes = document.find("scenes")) {
+    auto sceneIndex = (size_t)0;
+    if (auto defaultScene = document.find("scene"))
+      sceneIndex = defaultScene->asSize(0);
+    if (sceneIndex < scenes->array.size())
+      rootList = scenes->array[sceneIndex].find("nodes");
+  }
+
+  if (rootList != NULL) {
+    for (auto &root : rootList->array) {
+      auto rootIndex = root.asInt(-1);
+      if (rootIndex >= 0 && rootIndex < (int)scene->nodes.size())
+        scene->rootNodes.push_back(rootIndex);
+    }
+  } else {
+    for (size_t i = 0; i < isChild.size(); i++) {
+      if (!isChild[i])
+        scene->rootNodes.push_back((int)i);
+    }
+  }
+
+  // resolve world matrices, iteratively since exported hierarchies can be
+  // very deep
+  std::vector<bool> visited(scene->nodes.size(), false);
+  std::vector<std::pair<int, glm::mat4>> stack;
+  for (auto root : scene->rootNodes)
+    stack.push_back(std::make_pair(root, glm::mat4(1.0f)));
+
+  while (!stack.empty()) {
+    auto entry = stack.back();
+    stack.pop_back();
+
+    if (visited[entry.first]) {
+      *error = "node hierarchy is not a tree";
+      return false;
+    }
+    visited[entry.first] = true;
+
+    auto &node = scene->nodes[entry.first];
+    node.worldMatrix = entry.second *
+                       glm::translate(glm::mat4(1.0f), node.translation) *
+                       glm::mat4_cast(node.rotation) *
+                       glm::scale(glm::mat4(1.0f), node.scale);
+
+    for (auto child : node.children)
+      stack.push_back(std::make_pair(child, node.worldMatrix));
+  }
+
+  return true;
+}
+
+static bool decodeAccessor(const JsonValue &document, GltfScene *scene,
+                           int accessorIndex, GltfAttribute *attribute,
+                           int *count, std::string *error) {
+  auto accessors = document.find("accessors");
+  if (accessors == NULL || accessorIndex < 0 ||
+      accessorIndex >= (int)accessors->array.size()) {
+    *error = "accessor out of range";
+    return false;
+  }
+
+  auto &accessor = accessors->array[accessorIndex];
+  auto bufferView = accessor.find("bufferView");
+  if (bufferView == NULL || accessor.find("sparse") != NULL) {
+    *error = "sparse and implicit accessors are not supported";
+    return false;
+  }
+
+  attribute->bufferView = bufferView->asInt(-1);
+  if (attribute->bufferView < 0 ||
+      attribute->bufferView >= (int)scene->bufferViews.size()) {
+    *error = "buffer view out of range";
+    return false;
+  }
+
+  attribute->byteOffset = 0;
+  if (auto byteOffset = accessor.find("byteOffset"))
+    attribute->byteOffset = byteOffset->asSize(SIZE_MAX);
+
+  attribute->componentType = 0;
+  if (auto componentType = accessor.find("componentType"))
+    attribute->componentType = (unsigned int)componentType->asInt();
+
+  attribute->normalized = false;
+  if (auto normalized = accessor.find("normalized"))
+    attribute->normalized = normalized->boolean;
+
+  attribute->componentCount = 0;
+  if (auto type = accessor.find("type"))
+    attribute->componentCount = componentCountOf(type->string);
+
+  *count = 0;
+  if (auto accessorCount = accessor.find("count"))
+    *count = accessorCount->asInt();
+
+  if (attribute->componentCount == 0 || *count <= 0) {
+    *error = "unsupported accessor type";
+    return false;
+  }
+
+  auto componentSize = componentSizeOf(attribute->componentType);
+  if (componentSize == 0) {
+    *error = "unsupported accessor component type";
+    return false;
+  }
+
+  // the last element must end inside the view, and the view was already
+  // checked against the binary chunk, so a truncated file is rejected here
+  // instead of being read out of bounds by the driver
+  auto &view = scene->bufferViews[attribute->bufferView];
+  auto elementSize = componentSize * (size_t)attribute->componentCount;
+  auto stride = view.byteStride != 0 ? (size_t)view.byteStride : elementSize;
+  if (view.byteStride < 0 || stride < elementSize) {
+    *error = "buffer view stride is smaller than its elements";
+    return false;
+  }
+
+  if (attribute->byteOffset > view.byteLength ||
+      (size_t)(*count - 1) * stride + elementSize >
+          view.byteLength - attribute->byteOffset) {
+    *error = "accessor extends past the end of its buffer view";
+    return false;
+  }
+  view.used = true;
+
+  return true;
+}
+
+static bool decodeMeshes(const JsonValue &document, GltfScene *scene,
+                         std::string *error) {
+  auto meshes = document.find("meshes");
+  if (meshes == NULL)
+    return true;
+
+  scene->meshes.resize(meshes->array.size());
+  for (size_t i = 0; i < meshes->array.size(); i++) {
+    auto primitives = meshes->array[i].find("primitives");
+    if (primitives == NULL)
+      continue;
+
+    for (auto &source : primitives->array) {
+      auto attributes = source.find("attributes");
+      auto position = attributes ? attributes->find("POSITION") : NULL;
+      if (position == NULL) {
+        *error = "primitive without POSITION";
+        return false;
+      }
+
+      GltfPrimitive primitive;
+      primitive.vertexArrayObject = 0;
+      primitive.mode = GL_TRIANGLES;
+      if (auto mode = source.find("mode"))
+        primitive.mode = (unsigned int)mode->asInt(GL_TRIANGLES);
+
+      const struct {
+        const char *name;
+        int location;
+      } semantics[] = {
+          {"POSITION", gltfPositionLocation},
+          {"TEXCOORD_0", gltfTexCoordLocation},
+          {"NORMAL", gltfNormalLocation},
+      };
+
+      for (auto &semantic : semantics) {
+        auto accessorIndex = attributes->find(semantic.name);
+        if (accessorIndex == NULL)
+          continue;
+
+        GltfAttribute attribute;
+        int count;
+        if (!decodeAccessor(document, scene, accessorIndex->asInt(-1),
+                            &attribute, &count, error))
+          return false;
+
+        attribute.location = semantic.location;
+        primitive.attributes.push_back(attribute);
+
+        if (semantic.location == gltfPositionLocation)
+          primitive.count = count;
+      }
+
+      primitive.indexType = 0;
+      primitive.indexBufferView = -1;
+      primitive.indexByteOffset = 0;
+      if (auto indices = source.find("indices")) {
+        GltfAttribute indexAccessor;
+        if (!decodeAccessor(document, scene, indices->asInt(-1),
+                            &indexAccessor, &primitive.count, error))
+          return false;
+
+        if (indexAccessor.componentType != GL_UNSIGNED_BYTE &&
+            indexAccessor.componentType != GL_UNSIGNED_SHORT &&
+            indexAccessor.componentType != GL_UNSIGNED_INT) {
+          *error = "unsupported index component type";
+          return false;
+        }
+
+        primitive.indexType = indexAccessor.componentType;
+        primitive.indexBufferView = indexAccessor.bufferView;
+        primitive.indexByteOffset = indexAccessor.byteOffset;
+      }
+
+      scene->meshes[i].primitives.push_back(primitive);
+    }
+  }
+
+  return true;
+}
+
+static bool decodeBufferViews(const JsonValue &document, size_t binaryLength,
+                              GltfScene *scene, std::string *error) {
+  auto bufferViews = document.find("bufferViews");
+  if (bufferViews == NULL)
+    return true;
+
+  // only the embedded BIN chunk is supported, so buffer 0 must have no uri
+  auto buffers = document.find("buffers");
+  if (buffers != NULL) {
+    for (auto &buffer : buffers->array) {
+      if (buffer.find("uri") != NULL) {
+        *error = "external buffers are not supported";
+        return false;
+      }
+    }
+  }
+
+  for (auto &source : bufferViews->array) {
+    GltfBufferView view;
+    view.byteOffset = 0;
+    view.byteLength = 0;
+    view.byteStride = 0;
+    view.used = false;
+    view.buffer = 0;
+
+    if (auto byteOffset = source.find("byteOffset"))
+      view.byteOffset = byteOffset->asSize(SIZE_MAX);
+    if (auto byteLength = source.find("byteLength"))
+      view.byteLength = byteLength->asSize(SIZE_MAX);
+    if (auto byteStride = source.find("byteStride"))
+      view.byteStride = byteStride->asInt(-1);
+
+    // written so that huge values cannot wrap around
+    auto buffer = source.find("buffer");
+    if (buffer == NULL || buffer->asInt(-1) != 0 ||
+        view.byteLength > binaryLength ||
+        view.byteOffset > binaryLength - view.byteLength) {
+      *error = "buffer view out of the binary chunk";
+      return false;
+    }
+
+    scene->bufferViews.push_back(view);
+  }
+
+  return true;
+}
+
+static void parseAndDecode(GltfPendingLoad *load) {
+  auto parseStart = glfwGetTime();
+  JsonValue document;
+  load->succeeded =
+      parseJson(load->json, load->jsonLength, &document, &load->error);
+  load->parseSeconds = glfwGetTime() - parseStart;
+
+  if (load->succeeded) {
+    auto decodeStart = glfwGetTime();
+    load->succeeded =
+        decodeBufferViews(document, load->binaryLength, &load->scene,
+                          &load->error) &&
+        decodeMeshes(document, &load->scene, &load->error) &&
+        decodeNodes(document, &load->scene, &load->error);
+    load->decodeSeconds = glfwGetTime() - decodeStart;
+  }
+
+  load->ready.store(true, std::memory_order_release);
+}
+
+GltfPendingLoad *beginGltfLoad(const char *filePath) {
+  auto load = new GltfPendingLoad();
+  load->filePath = filePath;
+  load->mapping = NULL;
+  load->json = NULL;
+  load->binary = NULL;
+  load->jsonLength = 0;
+  load->binaryLength = 0;
+  load->succeeded = false;
+  load->parseSeconds = 0.0;
+  load->decodeSeconds = 0.0;
+  load->startTime = glfwGetTime();
+
+  if (!mapGlbFile(load)) {
+    load->ready.store(true);
+    return load;
+  }
+
+  load->ready.store(false);
+  load->worker = std::thread(parseAndDecode, load);
+
+  return load;
+}
+
+bool isGltfLoadReady(GltfPendingLoad *load) {
+  return load->ready.load(std::memory_order_acquire);
+}
+
+static void uploadScene(GltfPendingLoad *load) {
+  auto &scene = load->scene;
+
+  // one immutable buffer per used view, the driver copies directly out of
+  // the page cache through the mapping
+  for (auto &view : scene.bufferViews) {
+    if (!view.used)
+      continue;
+
+    view.buffer = createGpuBufferStorage(GpuMemoryGeometry,
+                                         GL_COPY_WRITE_BUFFER, view.byteLength,
+                                         load->binary + view.byteOffset, 0);
+  }
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  for (auto &mesh : scene.meshes) {
+    for (auto &primitive : mesh.primitives) {
+      glGenVertexArrays(1, &primitive.vertexArrayObject);
+      glBindVertexArray(primitive.vertexArrayObject);
+
+      for (auto &attribute : primitive.attributes) {
+        auto &view = scene.bufferViews[attribute.bufferView];
+        glBindBuffer(GL_ARRAY_BUFFER, view.buffer);
+        glVertexAttribPointer(attribute.location, attribute.componentCount,
+                              attribute.componentType, attribute.normalized,
+                              view.byteStride, (void *)attribute.byteOffset);
+        glEnableVertexAttribArray(attribute.location);
+      }
+
+      if (primitive.indexType != 0) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,
+                     scene.bufferViews[primitive.indexBufferView].buffer);
+      }
+    }
+  }
+
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+bool finishGltfLoad(GltfPendingLoad *load, GltfScene *scene,
+                    GltfLoadTimings *timings) {
+  if (load->worker.joinable())
+    load->worker.join();
+
+  auto succeeded = load->succeeded;
+  double uploadSeconds = 0.0;
+  if (succeeded) {
+    auto uploadStart = glfwGetTime();
+    uploadScene(load);
+    // make the timing honest, buffer uploads are otherwise deferred
+    glFinish();
+    uploadSeconds = glfwGetTime() - uploadStart;
+
+    *scene = std::move(load->scene);
+  } else {
+    fprintf(stderr, "unable to load %s: %s\n", load->filePath.c_str(),
+            load->error.c_str());
+  }
+
+  if (timings != NULL) {
+    timings->parseSeconds = load->parseSeconds;
+    timings->decodeSeconds = load->decodeSeconds;
+    timings->uploadSeconds = uploadSeconds;
+    timings->totalSeconds = glfwGetTime() - load->startTime;
+  }
+
+  if (load->mapping != NULL)
+    munmap(load->mapping, load->mappingSize);
+  delete load;
+
+  return succeeded;
+}
+
+bool loadGltf(const char *filePath, GltfScene *scene,
+              GltfLoadTimings *timings) {
+  return finishGltfLoad(beginGltfLoad(filePath), scene, timings);
+}
+
+void drawGltfScene(const GltfScene &scene, int modelUniformLocation) {
+  // only the nodes reachable from the scene roots are drawn, nodes that
+  // belong to other scenes of the file never got a world matrix
+  std::vector<int> stack(scene.rootNodes.rbegin(), scene.rootNodes.rend());
+  while (!stack.empty()) {
+    auto &node = scene.nodes[stack.back()];
+    stack.pop_back();
+    stack.insert(stack.end(), node.children.rbegin(), node.children.rend());
+
+    if (node.mesh < 0)
+      continue;
+
+    glUniformMatrix4fv(modelUniformLocation, 1, GL_FALSE,
+                       glm::value_ptr(node.worldMatrix));
+
+    for (auto &primitive : scene.meshes[node.mesh].primitives) {
+      glBindVertexArray(primitive.vertexArrayObject);
+      if (primitive.indexType != 0) {
+        glDrawElements(primitive.mode, primitive.count, primitive.indexType,
+                       (void *)primitive.indexByteOffset);
+      } else {
+        glDrawArrays(primitive.mode, 0, primitive.count);
+      }
+    }
+  }
+}
+
+void deleteGltfScene(GltfScene *scene) {
+  for (auto &mesh : scene->meshes) {
+    for (auto &primitive : mesh.primitives)
+      glDeleteVertexArrays(1, &primitive.vertexArrayObject);
+  }
+
+  for (auto &view : scene->bufferViews) {
+    if (view.buffer != 0)
+      deleteGpuBuffers(1, &view.buffer);
+  }
+
+  *scene = GltfScene();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Attribute locations used when uploading glTF primitives, they match the
+// layout in shaders/vertex.glsl
+const int gltfPositionLocation = 0;
+const int gltfTexCoordLocation = 1;
+const int gltfNormalLocation = 2;
+
+struct GltfBufferView {
+  size_t byteOffset;
+  size_t byteLength;
+  int byteStride;
+  bool used;
+  unsigned int buffer;
+};
+
+struct GltfAttribute {
+  int location;
+  int componentCount;
+  unsigned int componentType;
+  bool normalized;
+  int bufferView;
+  size_t byteOffset;
+};
+
+struct GltfPrimitive {
+  std::vector<GltfAttribute> attributes;
+  unsigned int mode;
+  int count;
+  // 0 when the primitive is not indexed
+  unsigned int indexType;
+  int indexBufferView;
+  size_t indexByteOffset;
+
+  unsigned int vertexArrayObject;
+};
+
+struct GltfMesh {
+  std::vector<GltfPrimitive> primitives;
+};
+
+struct GltfNode {
+  int mesh;
+  std::vector<int> children;
+
+  glm::vec3 translation;
+  glm::quat rotation;
+  glm::vec3 scale;
+
+  glm::mat4 worldMatrix;
+};
+
+struct GltfScene {
+  std::vector<GltfBufferView> bufferViews;
+  std::vector<GltfMesh> meshes;
+  std::vector<GltfNode> nodes;
+  std::vector<int> rootNodes;
+};
+
+struct GltfLoadTimings {
+  double parseSeconds;
+  double decodeSeconds;
+  double uploadSeconds;
+  double totalSeconds;
+};
+
+struct GltfPendingLoad;
+
+// Maps the .glb file and starts parsing it on a worker thread, it does not
+// touch OpenGL so it can be called at any point of the frame
+GltfPendingLoad *beginGltfLoad(const char *filePath);
+bool isGltfLoadReady(GltfPendingLoad *load);
+// Waits for the worker if needed and uploads the binary chunk straight from
+// the mapped file, it must be called on the thread that owns the GL context.
+// `load` is released either way
+bool finishGltfLoad(GltfPendingLoad *load, GltfScene *scene,
+                    GltfLoadTimings *timings);
+
+bool loadGltf(const char *filePath, GltfScene *scene,
+              GltfLoadTimings *timings);
+
+void drawGltfScene(const GltfScene &scene, int modelUniformLocation);
+void deleteGltfScene(GltfScene *scene);
+
+// Loads `filePath` several times and reports the time spent in each stage,
+// a synthetic scene is generated when `filePath` is NULL
+void runGltfLoadBenchmark(const char *filePath);
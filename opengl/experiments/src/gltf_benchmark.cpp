@@ -0,0 +1,231 @@
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "gltf.h"
+
+const char *syntheticScenePath = "/tmp/openglfun_benchmark.glb";
+
+// 512 meshes of 64x64 vertices referenced by 16k nodes, around 110MB of
+// vertex and index data, which is in the range of a real game level
+const int syntheticMeshCount = 512;
+const int syntheticGridSize = 64;
+const int syntheticGroupCount = 256;
+const int syntheticNodesPerGroup = 64;
+const int syntheticIterations = 5;
+
+static void appendFormat(std::string *out, const char *format, ...) {
+  char buffer[1024];
+  va_list arguments;
+  va_start(arguments, format);
+  auto length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+  va_end(arguments);
+
+  out->append(buffer, length < (int)sizeof(buffer) ? length : sizeof(buffer));
+}
+
+static bool writeSyntheticScene(const char *filePath) {
+  const auto vertexCount = syntheticGridSize * syntheticGridSize;
+  const auto indexCount =
+      (syntheticGridSize - 1) * (syntheticGridSize - 1) * 6;
+  const auto vertexStride = 8 * (int)sizeof(float);
+  const auto vertexBytes = (size_t)vertexCount * vertexStride;
+  const auto indexBytes = (size_t)indexCount * sizeof(uint32_t);
+
+  // every mesh is the same wavy grid with a different phase, it is only
+  // here to look like real data to the driver
+  std::vector<unsigned char> binary;
+  binary.reserve((vertexBytes + indexBytes) * syntheticMeshCount);
+  std::vector<float> vertices(vertexCount * 8);
+  std::vector<uint32_t> indices;
+  indices.reserve(indexCount);
+
+  for (auto y = 0; y < syntheticGridSize - 1; y++) {
+    for (auto x = 0; x < syntheticGridSize - 1; x++) {
+      uint32_t corner = y * syntheticGridSize + x;
+      uint32_t quad[] = {corner, corner + 1, corner + syntheticGridSize,
+                         corner + 1, corner + syntheticGridSize + 1,
+                         corner + syntheticGridSize};
+      indices.insert(indices.end(), quad, quad + 6);
+    }
+  }
+
+  std::string json;
+  json.reserve(8 * 1024 * 1024);
+  json += "{\"asset\":{\"version\":\"2.0\",\"generator\":\"openglfun\"},";
+
+  std::string bufferViews = "\"bufferViews\":[";
+  std::string accessors = "\"accessors\":[";
+  std::string meshes = "\"meshes\":[";
+
+  for (auto mesh = 0; mesh < syntheticMeshCount; mesh++) {
+    for (auto i = 0; i < vertexCount; i++) {
+      auto u = (float)(i % syntheticGridSize) / (syntheticGridSize - 1);
+      auto v = (float)(i / syntheticGridSize) / (syntheticGridSize - 1);
+      auto vertex = &vertices[i * 8];
+      vertex[0] = u - 0.5f;
+      vertex[1] = 0.05f * sinf(10.0f * u + (float)mesh);
+      vertex[2] = v - 0.5f;
+      vertex[3] = u;
+      vertex[4] = v;
+      vertex[5] = 0.0f;
+      vertex[6] = 1.0f;
+      vertex[7] = 0.0f;
+    }
+
+    auto vertexOffset = binary.size();
+    binary.insert(binary.end(), (unsigned char *)vertices.data(),
+                  (unsigned char *)vertices.data() + vertexBytes);
+    auto indexOffset = binary.size();
+    binary.insert(binary.end(), (unsigned char *)indices.data(),
+                  (unsigned char *)indices.data() + indexBytes);
+
+    auto separator = mesh == 0 ? "" : ",";
+    appendFormat(&bufferViews,
+                 "%s{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu,"
+                 "\"byteStride\":%d,\"target\":34962},"
+                 "{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu,"
+                 "\"target\":34963}",
+                 separator, vertexOffset, vertexBytes, vertexStride,
+                 indexOffset, indexBytes);
+
+    auto view = mesh * 2;
+    appendFormat(&accessors,
+                 "%s{\"bufferView\":%d,\"componentType\":5126,\"count\":%d,"
+                 "\"type\":\"VEC3\",\"min\":[-0.5,-0.05,-0.5],"
+                 "\"max\":[0.5,0.05,0.5]},"
+                 "{\"bufferView\":%d,\"byteOffset\":12,"
+                 "\"componentType\":5126,\"count\":%d,\"type\":\"VEC2\"},"
+                 "{\"bufferView\":%d,\"byteOffset\":20,"
+                 "\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"},"
+                 "{\"bufferView\":%d,\"componentType\":5125,\"count\":%d,"
+                 "\"type\":\"SCALAR\"}",
+                 separator, view, vertexCount, view, vertexCount, view,
+                 vertexCount, view + 1, indexCount);
+
+    auto accessor = mesh * 4;
+    appendFormat(&meshes,
+                 "%s{\"primitives\":[{\"attributes\":{\"POSITION\":%d,"
+                 "\"TEXCOORD_0\":%d,\"NORMAL\":%d},\"indices\":%d}]}",
+                 separator, accessor, accessor + 1, accessor + 2,
+                 accessor + 3);
+  }
+
+  // groups are laid on a grid, leaves alternate between TRS and matrix
+  // nodes so both decode paths are exercised
+  std::string nodes = "\"nodes\":[";
+  std::string roots = "\"scenes\":[{\"nodes\":[";
+  auto leafBase = syntheticGroupCount;
+  for (auto group = 0; group < syntheticGroupCount; group++) {
+    appendFormat(&nodes, "%s{\"translation\":[%d,0,%d],\"children\":[",
+                 group == 0 ? "" : ",", (group % 16) * 10, (group / 16) * 10);
+    for (auto child = 0; child < syntheticNodesPerGroup; child++) {
+      appendFormat(&nodes, "%s%d", child == 0 ? "" : ",",
+                   leafBase + group * syntheticNodesPerGroup + child);
+    }
+    nodes += "]}";
+
+    appendFormat(&roots, "%s%d", group == 0 ? "" : ",", group);
+  }
+
+  for (auto leaf = 0; leaf < syntheticGroupCount * syntheticNodesPerGroup;
+       leaf++) {
+    auto x = (float)(leaf % 8);
+    auto z = (float)((leaf / 8) % 8);
+    auto mesh = leaf % syntheticMeshCount;
+    if (leaf % 2 == 0) {
+      appendFormat(&nodes,
+                   ",{\"mesh\":%d,\"translation\":[%g,0,%g],"
+                   "\"rotation\":[0,0.3826834,0,0.9238795],"
+                   "\"scale\":[1,1,1]}",
+                   mesh, x, z);
+    } else {
+      appendFormat(&nodes,
+                   ",{\"mesh\":%d,\"matrix\":[0.7071068,0,-0.7071068,0,"
+                   "0,1,0,0,0.7071068,0,0.7071068,0,%g,0,%g,1]}",
+                   mesh, x, z);
+    }
+  }
+
+  json += bufferViews + "],";
+  json += accessors + "],";
+  json += meshes + "],";
+  json += nodes + "],";
+  json += roots + "]}],\"scene\":0,";
+  appendFormat(&json, "\"buffers\":[{\"byteLength\":%zu}]}", binary.size());
+
+  // chunks are 4-byte aligned, JSON pads with spaces and BIN with zeros
+  while (json.size() % 4 != 0)
+    json.push_back(' ');
+  while (binary.size() % 4 != 0)
+    binary.push_back(0);
+
+  auto file = fopen(filePath, "wb");
+  if (file == NULL) {
+    fprintf(stderr, "unable to open the file: %s\n", filePath);
+    return false;
+  }
+
+  uint32_t header[] = {0x46546C67, 2,
+                       (uint32_t)(12 + 8 + json.size() + 8 + binary.size())};
+  uint32_t jsonChunk[] = {(uint32_t)json.size(), 0x4E4F534A};
+  uint32_t binaryChunk[] = {(uint32_t)binary.size(), 0x004E4942};
+  fwrite(header, sizeof(header), 1, file);
+  fwrite(jsonChunk, sizeof(jsonChunk), 1, file);
+  fwrite(json.data(), 1, json.size(), file);
+  fwrite(binaryChunk, sizeof(binaryChunk), 1, file);
+  fwrite(binary.data(), 1, binary.size(), file);
+  fclose(file);
+
+  return true;
+}
+
+void runGltfLoadBenchmark(const char *filePath) {
+  if (filePath == NULL) {
+    printf("generating synthetic scene at %s\n", syntheticScenePath);
+    if (!writeSyntheticScene(syntheticScenePath))
+      return;
+    filePath = syntheticScenePath;
+  }
+
+  GltfLoadTimings total = {};
+  for (auto i = 0; i < syntheticIterations; i++) {
+    GltfScene scene;
+    GltfLoadTimings timings;
+    if (!loadGltf(filePath, &scene, &timings))
+      return;
+
+    size_t uploadedBytes = 0;
+    for (auto &view : scene.bufferViews)
+      uploadedBytes += view.used ? view.byteLength : 0;
+
+    printf("run %d: %zu nodes, %zu meshes, %.1f MB uploaded | parse %.2f ms, "
+           "decode %.2f ms, upload %.2f ms, total %.2f ms\n",
+           i, scene.nodes.size(), scene.meshes.size(),
+           uploadedBytes / (1024.0 * 1024.0), timings.parseSeconds * 1000.0,
+           timings.decodeSeconds * 1000.0, timings.uploadSeconds * 1000.0,
+           timings.totalSeconds * 1000.0);
+
+    total.parseSeconds += timings.parseSeconds;
+    total.decodeSeconds += timings.decodeSeconds;
+    total.uploadSeconds += timings.uploadSeconds;
+    total.totalSeconds += timings.totalSeconds;
+
+    deleteGltfScene(&scene);
+  }
+
+  printf("average over %d runs | parse %.2f ms, decode %.2f ms, upload %.2f "
+         "ms, total %.2f ms\n",
+         syntheticIterations,
+         total.parseSeconds * 1000.0 / syntheticIterations,
+         total.decodeSeconds * 1000.0 / syntheticIterations,
+         total.uploadSeconds * 1000.0 / syntheticIterations,
+         total.totalSeconds * 1000.0 / syntheticIterations);
+}
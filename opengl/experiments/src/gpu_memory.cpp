@@ -0,0 +1,508 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <stb_image.h>
+#include <glad/glad.h>
+
+#include "gpu_memory.h"
+
+// Not in the glad loader, the values are from the extension specs
+#ifndef GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX 0x9047
+#endif
+#ifndef GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX 0x9049
+#endif
+#ifndef GL_TEXTURE_FREE_MEMORY_ATI
+#define GL_TEXTURE_FREE_MEMORY_ATI 0x87FC
+#endif
+
+struct GpuBufferEntry {
+  GpuMemoryCategory category;
+  size_t size;
+};
+
+struct GpuTextureEntry {
+  GpuMemoryCategory category;
+  unsigned int target;
+  unsigned int internalFormat;
+  int width;
+  int height;
+  int layers;
+  int levels;
+  // streamed textures only, the mips below it have been released
+  int baseLevel;
+  size_t bytes;
+  unsigned int lastUsedFrame;
+
+  bool streamed;
+  std::string path;
+  // what the file is uploaded as
+  unsigned int format;
+  int channels;
+};
+
+struct GpuProgramEntry {
+  size_t size;
+};
+
+static struct {
+  std::mutex mutex;
+  std::unordered_map<unsigned int, GpuBufferEntry> buffers;
+  std::unordered_map<unsigned int, GpuTextureEntry> textures;
+  std::unordered_map<unsigned int, GpuProgramEntry> programs;
+
+  size_t bytes[gpuMemoryCategoryCount];
+  int resources[gpuMemoryCategoryCount];
+  size_t budget;
+  unsigned int frame;
+  int droppedLevels;
+  int restoredTextures;
+
+  // 0 unknown, 1 NVX, 2 ATI, 3 neither
+  int driverQuery;
+} registry;
+
+static void addBytes(GpuMemoryCategory category, size_t bytes) {
+  registry.bytes[category] += bytes;
+}
+
+static void removeBytes(GpuMemoryCategory category, size_t bytes) {
+  registry.bytes[category] -= bytes;
+}
+
+// An estimate for the formats the samples use, drivers are free to pad
+static size_t formatBytes(unsigned int internalFormat) {
+  switch (internalFormat) {
+  case GL_R8:
+  case GL_RED:
+    return 1;
+  case GL_RG8:
+  case GL_RG:
+  case GL_R16F:
+    return 2;
+  case GL_RGBA16F:
+  case GL_RG32UI:
+  case GL_RG32F:
+    return 8;
+  case GL_RGBA32F:
+  case GL_RGBA32UI:
+    return 16;
+  default:
+    // RGB is padded to 4 bytes by every driver that matters
+    return 4;
+  }
+}
+
+static size_t levelBytes(const GpuTextureEntry &texture, int level) {
+  auto width = texture.width >> level;
+  auto height = texture.height >> level;
+  return (size_t)(width > 0 ? width : 1) * (height > 0 ? height : 1) *
+         texture.layers * formatBytes(texture.internalFormat);
+}
+
+static size_t textureBytes(const GpuTextureEntry &texture, int baseLevel) {
+  size_t bytes = 0;
+  for (auto level = baseLevel; level < texture.levels; level++)
+    bytes += levelBytes(texture, level);
+  return bytes;
+}
+
+static int mipLevels(int width, int height) {
+  auto levels = 1;
+  while ((width | height) >> levels)
+    levels++;
+  return levels;
+}
+
+static void trackBuffer(unsigned int buffer, GpuMemoryCategory category,
+                        size_t size) {
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.buffers[buffer] = {category, size};
+  addBytes(category, size);
+  registry.resources[category]++;
+}
+
+unsigned int createGpuBuffer(GpuMemoryCategory category, unsigned int target,
+                             size_t size, const void *data,
+                             unsigned int usage) {
+  unsigned int buffer;
+  glGenBuffers(1, &buffer);
+  glBindBuffer(target, buffer);
+  if (size > 0)
+    glBufferData(target, size, data, usage);
+
+  trackBuffer(buffer, category, size);
+  return buffer;
+}
+
+unsigned int createGpuBufferStorage(GpuMemoryCategory category,
+                                    unsigned int target, size_t size,
+                                    const void *data, unsigned int flags) {
+  unsigned int buffer;
+  glGenBuffers(1, &buffer);
+  glBindBuffer(target, buffer);
+  glBufferStorage(target, size, data, flags);
+
+  trackBuffer(buffer, category, size);
+  return buffer;
+}
+
+void resizeGpuBuffer(unsigned int buffer, unsigned int target, size_t size,
+                     const void *data, unsigned int usage) {
+  glBindBuffer(target, buffer);
+  glBufferData(target, size, data, usage);
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto entry = registry.buffers.find(buffer);
+  if (entry == registry.buffers.end())
+    return;
+  removeBytes(entry->second.category, entry->second.size);
+  entry->second.size = size;
+  addBytes(entry->second.category, size);
+}
+
+void deleteGpuBuffers(int count, const unsigned int *buffers) {
+  glDeleteBuffers(count, buffers);
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto i = 0; i < count; i++) {
+    auto entry = registry.buffers.find(buffers[i]);
+    if (entry == registry.buffers.end())
+      continue;
+    removeBytes(entry->second.category, entry->second.size);
+    registry.resources[entry->second.category]--;
+    registry.buffers.erase(entry);
+  }
+}
+
+static void trackTexture(unsigned int texture, GpuTextureEntry entry) {
+  entry.bytes = textureBytes(entry, entry.baseLevel);
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  entry.lastUsedFrame = registry.frame;
+  addBytes(entry.category, entry.bytes);
+  registry.resources[entry.category]++;
+  registry.textures[texture] = entry;
+}
+
+unsigned int createGpuTexture(GpuMemoryCategory category, unsigned int target,
+                              int levels, unsigned int internalFormat,
+                              int width, int height, int layers) {
+  unsigned int texture;
+  glGenTextures(1, &texture);
+  glBindTexture(target, texture);
+  if (target == GL_TEXTURE_2D_ARRAY || target == GL_TEXTURE_3D)
+    glTexStorage3D(target, levels, internalFormat, width, height, layers);
+  else
+    glTexStorage2D(target, levels, internalFormat, width, height);
+
+  GpuTextureEntry entry = {};
+  entry.category = category;
+  entry.target = target;
+  entry.internalFormat = internalFormat;
+  entry.width = width;
+  entry.height = height;
+  entry.layers = layers;
+  entry.levels = levels;
+  trackTexture(texture, entry);
+  return texture;
+}
+
+// Uploads the whole chain from the file into the bound texture, false when
+// the file cannot be read
+static bool uploadStreamedLevels(GpuTextureEntry *entry) {
+  int width, height, channels;
+  auto data = stbi_load(entry->path.c_str(), &width, &height, &channels,
+                        entry->channels);
+  if (data == NULL) {
+    fprintf(stderr, "failed to load texture: %s\n", entry->path.c_str());
+    return false;
+  }
+  if (entry->channels == 0) {
+    entry->channels = channels;
+    entry->format = channels == 1   ? GL_RED
+                    : channels == 2 ? GL_RG
+                    : channels == 3 ? GL_RGB
+                                    : GL_RGBA;
+    entry->internalFormat = entry->format;
+  }
+  entry->width = width;
+  entry->height = height;
+  entry->levels = mipLevels(width, height);
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+  glTexImage2D(GL_TEXTURE_2D, 0, entry->internalFormat, width, height, 0,
+               entry->format, GL_UNSIGNED_BYTE, data);
+  glGenerateMipmap(GL_TEXTURE_2D);
+  stbi_image_free(data);
+
+  entry->baseLevel = 0;
+  return true;
+}
+
+unsigned int loadStreamedTexture(const char *path) {
+  unsigned int texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+
+  // wrapping
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+  // filtering
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+  GpuTextureEntry entry = {};
+  entry.category = GpuMemoryTextures;
+  entry.target = GL_TEXTURE_2D;
+  entry.layers = 1;
+  entry.streamed = true;
+  entry.path = path;
+  if (!uploadStreamedLevels(&entry)) {
+    glDeleteTextures(1, &texture);
+    return 0;
+  }
+
+  trackTexture(texture, entry);
+  return texture;
+}
+
+void touchGpuTexture(unsigned int texture) {
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto entry = registry.textures.find(texture);
+  if (entry != registry.textures.end())
+    entry->second.lastUsedFrame = registry.frame;
+}
+
+void deleteGpuTextures(int count, const unsigned int *textures) {
+  glDeleteTextures(count, textures);
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto i = 0; i < count; i++) {
+    auto entry = registry.textures.find(textures[i]);
+    if (entry == registry.textures.end())
+      continue;
+    removeBytes(entry->second.category, entry->second.bytes);
+    registry.resources[entry->second.category]--;
+    registry.textures.erase(entry);
+  }
+}
+
+void registerGpuProgram(unsigned int program) {
+  int size = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.programs[program] = {(size_t)size};
+  addBytes(GpuMemoryPrograms, size);
+  registry.resources[GpuMemoryPrograms]++;
+}
+
+void deleteGpuProgram(unsigned int program) {
+  glDeleteProgram(program);
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto entry = registry.programs.find(program);
+  if (entry == registry.programs.end())
+    return;
+  removeBytes(GpuMemoryPrograms, entry->second.size);
+  registry.resources[GpuMemoryPrograms]--;
+  registry.programs.erase(entry);
+}
+
+void setGpuMemoryBudget(size_t bytes) {
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.budget = bytes;
+}
+
+static size_t totalBytes() {
+  size_t total = 0;
+  for (auto category = 0; category < gpuMemoryCategoryCount; category++)
+    total += registry.bytes[category];
+  return total;
+}
+
+// Sampling starts at the next level and the released one is respecified
+// empty, which frees it without changing the texture name
+static void dropTopLevel(unsigned int texture, GpuTextureEntry *entry) {
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, entry->baseLevel + 1);
+  glTexImage2D(GL_TEXTURE_2D, entry->baseLevel, entry->internalFormat, 0, 0,
+               0, entry->format, GL_UNSIGNED_BYTE, NULL);
+
+  auto freed = levelBytes(*entry, entry->baseLevel);
+  entry->baseLevel++;
+  entry->bytes -= freed;
+  removeBytes(entry->category, freed);
+  registry.droppedLevels++;
+}
+
+static bool canDropLevel(const GpuTextureEntry &entry) {
+  auto level = entry.baseLevel + 1;
+  return entry.streamed && level < entry.levels &&
+         (entry.width >> level) >= streamedTextureMinimumSize &&
+         (entry.height >> level) >= streamedTextureMinimumSize;
+}
+
+void beginGpuMemoryFrame() {
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.frame++;
+  if (registry.budget == 0)
+    return;
+
+  int boundTexture;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &boundTexture);
+
+  // least recently used first, one level at a time so the textures in use
+  // keep as much detail as the budget allows
+  auto total = totalBytes();
+  while (total > registry.budget) {
+    GpuTextureEntry *oldest = NULL;
+    unsigned int oldestTexture = 0;
+    for (auto &pair : registry.textures) {
+      if (!canDropLevel(pair.second))
+        continue;
+      if (oldest == NULL ||
+          pair.second.lastUsedFrame < oldest->lastUsedFrame ||
+          (pair.second.lastUsedFrame == oldest->lastUsedFrame &&
+           pair.second.bytes > oldest->bytes)) {
+        oldest = &pair.second;
+        oldestTexture = pair.first;
+      }
+    }
+    if (oldest == NULL)
+      break;
+
+    auto before = oldest->bytes;
+    dropTopLevel(oldestTexture, oldest);
+    total -= before - oldest->bytes;
+  }
+
+  // brings back the most recently used texture that fits with some room to
+  // spare, so it is not dropped again right away. One per frame since it
+  // reads the file
+  if (total <= registry.budget) {
+    GpuTextureEntry *newest = NULL;
+    unsigned int newestTexture = 0;
+    for (auto &pair : registry.textures) {
+      auto &entry = pair.second;
+      if (!entry.streamed || entry.baseLevel == 0 ||
+          registry.frame - entry.lastUsedFrame > 1)
+        continue;
+      auto grown = textureBytes(entry, 0) - entry.bytes;
+      if ((total + grown) * 10 > registry.budget * 9)
+        continue;
+      if (newest == NULL || entry.lastUsedFrame > newest->lastUsedFrame) {
+        newest = &entry;
+        newestTexture = pair.first;
+      }
+    }
+
+    if (newest != NULL) {
+      glBindTexture(GL_TEXTURE_2D, newestTexture);
+      removeBytes(newest->category, newest->bytes);
+      if (uploadStreamedLevels(newest)) {
+        registry.restoredTextures++;
+      } else {
+        // keep what it has, trying again every frame would not help
+        newest->streamed = false;
+      }
+      newest->bytes = textureBytes(*newest, newest->baseLevel);
+      addBytes(newest->category, newest->bytes);
+    }
+  }
+
+  glBindTexture(GL_TEXTURE_2D, boundTexture);
+}
+
+static void queryDriverMemory(GpuMemoryStats *stats) {
+  stats->driverTotalKilobytes = -1;
+  stats->driverAvailableKilobytes = -1;
+
+  if (registry.driverQuery == 0) {
+    registry.driverQuery = 3;
+    int extensionCount;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (auto i = 0; i < extensionCount; i++) {
+      auto name = (const char *)glGetStringi(GL_EXTENSIONS, i);
+      if (strcmp(name, "GL_NVX_gpu_memory_info") == 0)
+        registry.driverQuery = 1;
+      else if (strcmp(name, "GL_ATI_meminfo") == 0 &&
+               registry.driverQuery != 1)
+        registry.driverQuery = 2;
+    }
+  }
+
+  if (registry.driverQuery == 1) {
+    glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX,
+                  &stats->driverTotalKilobytes);
+    glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX,
+                  &stats->driverAvailableKilobytes);
+  } else if (registry.driverQuery == 2) {
+    // total free, largest free block, total and largest auxiliary
+    int free[4];
+    glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, free);
+    stats->driverAvailableKilobytes = free[0];
+  }
+}
+
+GpuMemoryStats gpuMemoryStats() {
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  GpuMemoryStats stats;
+  for (auto category = 0; category < gpuMemoryCategoryCount; category++) {
+    stats.bytes[category] = registry.bytes[category];
+    stats.resources[category] = registry.resources[category];
+  }
+  stats.totalBytes = totalBytes();
+  stats.budget = registry.budget;
+  stats.droppedLevels = registry.droppedLevels;
+  stats.restoredTextures = registry.restoredTextures;
+  queryDriverMemory(&stats);
+
+  return stats;
+}
+
+const char *gpuMemoryCategoryName(GpuMemoryCategory category) {
+  switch (category) {
+  case GpuMemoryTextures:
+    return "textures";
+  case GpuMemoryRenderTargets:
+    return "render targets";
+  case GpuMemoryGeometry:
+    return "geometry";
+  case GpuMemoryStorage:
+    return "storage";
+  case GpuMemoryStaging:
+    return "staging";
+  case GpuMemoryPrograms:
+    return "programs";
+  default:
+    return "unknown";
+  }
+}
+
+void printGpuMemoryStats() {
+  auto stats = gpuMemoryStats();
+  const auto megabyte = 1024.0 * 1024.0;
+
+  printf("gpu memory: %.2f MB", stats.totalBytes / megabyte);
+  if (stats.budget > 0)
+    printf(" of %.2f MB", stats.budget / megabyte);
+  printf(", %d levels dropped, %d textures restored\n", stats.droppedLevels,
+         stats.restoredTextures);
+  for (auto category = 0; category < gpuMemoryCategoryCount; category++) {
+    printf("  %-15s %8.2f MB in %d\n",
+           gpuMemoryCategoryName((GpuMemoryCategory)category),
+           stats.bytes[category] / megabyte, stats.resources[category]);
+  }
+  if (stats.driverTotalKilobytes >= 0 || stats.driverAvailableKilobytes >= 0)
+    printf("  driver: %d KB available of %d KB\n",
+           stats.driverAvailableKilobytes, stats.driverTotalKilobytes);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stddef.h>
+
+// Streamed textures never lose mips below this size
+const int streamedTextureMinimumSize = 32;
+
+enum GpuMemoryCategory {
+  // sampled textures, streamed ones can be downgraded
+  GpuMemoryTextures,
+  GpuMemoryRenderTargets,
+  // vertex and instance data
+  GpuMemoryGeometry,
+  // shader storage read and written by compute
+  GpuMemoryStorage,
+  // mapped rings and readback buffers
+  GpuMemoryStaging,
+  // sized by their program binaries, the closest thing drivers report
+  GpuMemoryPrograms,
+  gpuMemoryCategoryCount,
+};
+
+struct GpuMemoryStats {
+  size_t bytes[gpuMemoryCategoryCount];
+  int resources[gpuMemoryCategoryCount];
+  size_t totalBytes;
+  // 0 when there is none
+  size_t budget;
+
+  // streamed texture levels released to stay in the budget, and the
+  // textures brought back to full size once there was room again
+  int droppedLevels;
+  int restoredTextures;
+
+  // from GL_NVX_gpu_memory_info or GL_ATI_meminfo, in KiB like the
+  // extensions report it, -1 when the driver does not say
+  int driverTotalKilobytes;
+  int driverAvailableKilobytes;
+};
+
+// Every buffer, texture and program goes through these so the totals are
+// exact for what the app created. The registry is shared by all contexts
+// and threads, GL names are assumed unique across them, which holds for
+// contexts sharing objects
+
+// Generates the buffer, leaves it bound to `target` and fills it, `size`
+// can be 0 for buffers that are only sized later with resizeGpuBuffer
+unsigned int createGpuBuffer(GpuMemoryCategory category, unsigned int target,
+                             size_t size, const void *data, unsigned int usage);
+// glBufferStorage, for immutable and persistently mapped buffers
+unsigned int createGpuBufferStorage(GpuMemoryCategory category,
+                                    unsigned int target, size_t size,
+                                    const void *data, unsigned int flags);
+// glBufferData on an existing buffer, also for orphaning
+void resizeGpuBuffer(unsigned int buffer, unsigned int target, size_t size,
+                     const void *data, unsigned int usage);
+void deleteGpuBuffers(int count, const unsigned int *buffers);
+
+// Immutable storage, left bound to `target`. `layers` is 1 for 2D textures
+unsigned int createGpuTexture(GpuMemoryCategory category, unsigned int target,
+                              int levels, unsigned int internalFormat,
+                              int width, int height, int layers);
+// A mipmapped texture from an image file. It is allowed to lose its top
+// mips when the budget is exceeded and is reloaded from the file once it
+// fits again. Returns 0 when the file cannot be read
+unsigned int loadStreamedTexture(const char *path);
+// Marks the texture as used this frame, call it where it is bound
+void touchGpuTexture(unsigned int texture);
+void deleteGpuTextures(int count, const unsigned int *textures);
+
+// Called by linkShaderProgram, so programs never need to register manually
+void registerGpuProgram(unsigned int program);
+void deleteGpuProgram(unsigned int program);
+
+// 0 turns the budget off
+void setGpuMemoryBudget(size_t bytes);
+// Advances the frame the textures are touched in and drops or restores
+// streamed mips to keep under the budget, call it at the start of a frame
+void beginGpuMemoryFrame();
+
+GpuMemoryStats gpuMemoryStats();
+const char *gpuMemoryCategoryName(GpuMemoryCategory category);
+void printGpuMemoryStats();
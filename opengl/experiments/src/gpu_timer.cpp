@@ -0,0 +1,51 @@
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+#include "gpu_timer.h"
+
+void createGpuTimer(GpuTimer *timer) {
+  glGenQueries(gpuTimerLatency, timer->startQueries);
+  glGenQueries(gpuTimerLatency, timer->endQueries);
+  timer->frame = 0;
+  timer->lastMilliseconds = 0.0;
+  resetGpuTimerAverage(timer);
+}
+
+void deleteGpuTimer(GpuTimer *timer) {
+  glDeleteQueries(gpuTimerLatency, timer->startQueries);
+  glDeleteQueries(gpuTimerLatency, timer->endQueries);
+}
+
+void beginGpuTimer(GpuTimer *timer) {
+  auto slot = timer->frame % gpuTimerLatency;
+
+  // collect what this slot measured `gpuTimerLatency` frames ago before
+  // reusing it, by now the GPU is done with it
+  if (timer->frame >= gpuTimerLatency) {
+    uint64_t start, end;
+    glGetQueryObjectui64v(timer->startQueries[slot], GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(timer->endQueries[slot], GL_QUERY_RESULT, &end);
+
+    timer->lastMilliseconds = (double)(end - start) / 1000000.0;
+    timer->totalMilliseconds += timer->lastMilliseconds;
+    timer->samples++;
+  }
+
+  glQueryCounter(timer->startQueries[slot], GL_TIMESTAMP);
+}
+
+void endGpuTimer(GpuTimer *timer) {
+  glQueryCounter(timer->endQueries[timer->frame % gpuTimerLatency],
+                 GL_TIMESTAMP);
+  timer->frame++;
+}
+
+double gpuTimerAverageMilliseconds(const GpuTimer &timer) {
+  return timer.samples > 0 ? timer.totalMilliseconds / timer.samples : 0.0;
+}
+
+void resetGpuTimerAverage(GpuTimer *timer) {
+  timer->totalMilliseconds = 0.0;
+  timer->samples = 0;
+}
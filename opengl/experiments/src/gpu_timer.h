@@ -0,0 +1,25 @@
+#pragma once
+
+// Results are read back this many frames late so the CPU never waits on
+// the GPU to finish a query
+const int gpuTimerLatency = 4;
+
+struct GpuTimer {
+  unsigned int startQueries[gpuTimerLatency];
+  unsigned int endQueries[gpuTimerLatency];
+  int frame;
+
+  double lastMilliseconds;
+  double totalMilliseconds;
+  int samples;
+};
+
+void createGpuTimer(GpuTimer *timer);
+void deleteGpuTimer(GpuTimer *timer);
+
+// Timestamp based, so timers can overlap and nest freely
+void beginGpuTimer(GpuTimer *timer);
+void endGpuTimer(GpuTimer *timer);
+
+double gpuTimerAverageMilliseconds(const GpuTimer &timer);
+void resetGpuTimerAverage(GpuTimer *timer);
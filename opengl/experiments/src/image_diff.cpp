@@ -0,0 +1,118 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "image_diff.h"
+
+struct DiffSums {
+  int differingPixels;
+  int maxDifference;
+  uint64_t squaredError;
+};
+
+static void compareScalar(const unsigned char *a, const unsigned char *b,
+                          int pixelCount, int tolerance, DiffSums *sums) {
+  for (auto i = 0; i < pixelCount; i++) {
+    auto differs = false;
+    for (auto channel = 0; channel < 3; channel++) {
+      auto difference = abs(a[i * 4 + channel] - b[i * 4 + channel]);
+      differs |= difference > tolerance;
+      if (difference > sums->maxDifference)
+        sums->maxDifference = difference;
+      sums->squaredError += difference * difference;
+    }
+    sums->differingPixels += differs;
+  }
+}
+
+#if defined(__SSE2__)
+// 4 pixels per iteration. Each 32 bit squared error lane grows by up to
+// 4 * 255^2 per iteration and would overflow after about 16000 of them, so
+// the lanes are flushed into the 64 bit total well before that
+static int compareSse2(const unsigned char *a, const unsigned char *b,
+                       int pixelCount, int tolerance, DiffSums *sums) {
+  const int flushInterval = 2048;
+  auto colorMask = _mm_set1_epi32(0x00ffffff);
+  auto toleranceBytes = _mm_set1_epi8((char)tolerance);
+  auto zero = _mm_setzero_si128();
+  auto maxDifference = zero;
+
+  auto vectorPixels = pixelCount & ~3;
+  for (auto start = 0; start < vectorPixels; start += flushInterval * 4) {
+    auto end = start + flushInterval * 4;
+    if (end > vectorPixels)
+      end = vectorPixels;
+
+    auto squaredError = zero;
+    auto differing = zero;
+    for (auto i = start; i < end; i += 4) {
+      auto pixelsA = _mm_and_si128(
+          _mm_loadu_si128((const __m128i *)(a + i * 4)), colorMask);
+      auto pixelsB = _mm_and_si128(
+          _mm_loadu_si128((const __m128i *)(b + i * 4)), colorMask);
+
+      // no unsigned abs in SSE2, but one of the saturated differences is
+      // always zero
+      auto difference = _mm_or_si128(_mm_subs_epu8(pixelsA, pixelsB),
+                                     _mm_subs_epu8(pixelsB, pixelsA));
+      maxDifference = _mm_max_epu8(maxDifference, difference);
+
+      // a pixel differs when any of its bytes is over the tolerance, that
+      // makes its 32 bit lane non zero, the compare gives -1 for those
+      auto over = _mm_subs_epu8(difference, toleranceBytes);
+      differing = _mm_sub_epi32(
+          differing,
+          _mm_xor_si128(_mm_cmpeq_epi32(over, zero), _mm_set1_epi32(-1)));
+
+      auto low = _mm_unpacklo_epi8(difference, zero);
+      auto high = _mm_unpackhi_epi8(difference, zero);
+      squaredError = _mm_add_epi32(squaredError, _mm_madd_epi16(low, low));
+      squaredError = _mm_add_epi32(squaredError, _mm_madd_epi16(high, high));
+    }
+
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, squaredError);
+    sums->squaredError +=
+        (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    _mm_storeu_si128((__m128i *)lanes, differing);
+    sums->differingPixels += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  }
+
+  unsigned char maxBytes[16];
+  _mm_storeu_si128((__m128i *)maxBytes, maxDifference);
+  for (auto byte : maxBytes) {
+    if (byte > sums->maxDifference)
+      sums->maxDifference = byte;
+  }
+
+  return vectorPixels;
+}
+#endif
+
+ImageDiff compareImages(const unsigned char *a, const unsigned char *b,
+                        int width, int height, int tolerance) {
+  DiffSums sums = {0, 0, 0};
+  auto pixelCount = width * height;
+  auto done = 0;
+
+#if defined(__SSE2__)
+  done = compareSse2(a, b, pixelCount, tolerance, &sums);
+#endif
+  compareScalar(a + done * 4, b + done * 4, pixelCount - done, tolerance,
+                &sums);
+
+  ImageDiff diff;
+  diff.differingPixels = sums.differingPixels;
+  diff.maxDifference = sums.maxDifference;
+  diff.meanSquaredError =
+      pixelCount > 0 ? (double)sums.squaredError / (pixelCount * 3.0) : 0.0;
+  diff.psnr = diff.meanSquaredError > 0.0
+                  ? 10.0 * log10(255.0 * 255.0 / diff.meanSquaredError)
+                  : INFINITY;
+
+  return diff;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+struct ImageDiff {
+  // pixels with a color channel further apart than the tolerance
+  int differingPixels;
+  int maxDifference;
+  double meanSquaredError;
+  // infinite for identical images
+  double psnr;
+};
+
+// Compares two tightly packed RGBA8 images, alpha is ignored since the
+// default framebuffer does not keep a meaningful one. The tolerance must be
+// in [0, 255]
+ImageDiff compareImages(const unsigned char *a, const unsigned char *b,
+                        int width, int height, int tolerance);
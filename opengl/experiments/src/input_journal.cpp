@@ -0,0 +1,238 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <GLFW/glfw3.h>
+
+#include "camera.h"
+#include "input_journal.h"
+
+const char journalMagic[4] = {'O', 'G', 'I', 'J'};
+const uint32_t journalVersion = 1;
+
+enum JournalRecordType : uint8_t {
+  FrameRecord,
+  KeyRecord,
+  CursorRecord,
+  ScrollRecord,
+};
+
+// explicit little endian so journals replay on any machine
+static void appendBytes(std::vector<unsigned char> *out, uint64_t value,
+                        int size) {
+  for (auto i = 0; i < size; i++)
+    out->push_back((unsigned char)(value >> (i * 8)));
+}
+
+static void appendDouble(std::vector<unsigned char> *out, double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  appendBytes(out, bits, 8);
+}
+
+static bool readBytes(InputJournal *journal, int size, uint64_t *value) {
+  if (journal->position + size > journal->data.size())
+    return false;
+
+  *value = 0;
+  for (auto i = 0; i < size; i++)
+    *value |= (uint64_t)journal->data[journal->position++] << (i * 8);
+
+  return true;
+}
+
+static bool readDouble(InputJournal *journal, double *value) {
+  uint64_t bits;
+  if (!readBytes(journal, 8, &bits))
+    return false;
+
+  memcpy(value, &bits, sizeof(bits));
+  return true;
+}
+
+static void resetJournal(InputJournal *journal, InputJournalMode mode) {
+  journal->mode = mode;
+  journal->file = NULL;
+  journal->pendingEvents.clear();
+  journal->data.clear();
+  journal->position = 0;
+  memset(journal->keys, 0, sizeof(journal->keys));
+  journal->finished = false;
+  journal->frames = 0;
+  journal->events = 0;
+  journal->startTime = glfwGetTime();
+}
+
+bool startInputRecording(InputJournal *journal, const char *path) {
+  resetJournal(journal, JournalRecording);
+
+  journal->file = fopen(path, "wb");
+  if (journal->file == NULL) {
+    fprintf(stderr, "unable to open %s\n", path);
+    journal->mode = JournalOff;
+    return false;
+  }
+
+  std::vector<unsigned char> header(journalMagic, journalMagic + 4);
+  appendBytes(&header, journalVersion, 4);
+  fwrite(header.data(), 1, header.size(), journal->file);
+
+  return true;
+}
+
+bool startInputReplay(InputJournal *journal, const char *path) {
+  resetJournal(journal, JournalReplaying);
+
+  auto file = fopen(path, "rb");
+  if (file == NULL) {
+    fprintf(stderr, "unable to open %s\n", path);
+    journal->mode = JournalOff;
+    return false;
+  }
+
+  unsigned char chunk[65536];
+  size_t read;
+  while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    journal->data.insert(journal->data.end(), chunk, chunk + read);
+  fclose(file);
+
+  uint64_t version = 0;
+  if (journal->data.size() >= 8 &&
+      memcmp(journal->data.data(), journalMagic, 4) == 0) {
+    journal->position = 4;
+    readBytes(journal, 4, &version);
+  }
+  if (version != journalVersion) {
+    fprintf(stderr, "%s is not an input journal this build can replay\n",
+            path);
+    journal->mode = JournalOff;
+    return false;
+  }
+
+  return true;
+}
+
+void stopInputJournal(InputJournal *journal) {
+  auto seconds = glfwGetTime() - journal->startTime;
+
+  if (journal->mode == JournalRecording) {
+    fclose(journal->file);
+    printf("input journal: recorded %d frames and %d events\n",
+           journal->frames, journal->events);
+  } else if (journal->mode == JournalReplaying) {
+    printf("input journal: replayed %d frames and %d events in %.3f s, "
+           "%.3f ms per frame\n",
+           journal->frames, journal->events, seconds,
+           journal->frames > 0 ? seconds * 1000.0 / journal->frames : 0.0);
+  }
+
+  journal->mode = JournalOff;
+}
+
+static void replayFrame(InputJournal *journal, Camera *camera,
+                        float *frameTime) {
+  uint64_t type, time;
+  if (!readBytes(journal, 1, &type) || type != FrameRecord ||
+      !readBytes(journal, 4, &time)) {
+    journal->finished = true;
+    return;
+  }
+  memcpy(frameTime, &time, sizeof(*frameTime));
+  journal->frames++;
+
+  while (journal->position < journal->data.size() &&
+         journal->data[journal->position] != FrameRecord) {
+    readBytes(journal, 1, &type);
+
+    uint64_t key, action;
+    double x, y;
+    switch (type) {
+    case KeyRecord:
+      if (!readBytes(journal, 2, &key) || !readBytes(journal, 1, &action) ||
+          key > GLFW_KEY_LAST) {
+        journal->finished = true;
+        return;
+      }
+      journal->keys[key] = action == GLFW_PRESS;
+      break;
+    case CursorRecord:
+      if (!readDouble(journal, &x) || !readDouble(journal, &y)) {
+        journal->finished = true;
+        return;
+      }
+      cameraLookAround(camera, x, y);
+      break;
+    case ScrollRecord:
+      if (!readDouble(journal, &x) || !readDouble(journal, &y)) {
+        journal->finished = true;
+        return;
+      }
+      cameraZoomOut(camera, y);
+      break;
+    default:
+      fprintf(stderr, "corrupt input journal at byte %zu\n",
+              journal->position - 1);
+      journal->finished = true;
+      return;
+    }
+    journal->events++;
+  }
+}
+
+float beginInputFrame(InputJournal *journal, Camera *camera,
+                      float frameTime) {
+  if (journal->mode == JournalRecording) {
+    std::vector<unsigned char> frame;
+    frame.push_back(FrameRecord);
+    uint32_t time;
+    memcpy(&time, &frameTime, sizeof(time));
+    appendBytes(&frame, time, 4);
+
+    fwrite(frame.data(), 1, frame.size(), journal->file);
+    fwrite(journal->pendingEvents.data(), 1, journal->pendingEvents.size(),
+           journal->file);
+    journal->pendingEvents.clear();
+    journal->frames++;
+  } else if (journal->mode == JournalReplaying && !journal->finished) {
+    replayFrame(journal, camera, &frameTime);
+  }
+
+  return frameTime;
+}
+
+bool isKeyPressed(const InputJournal &journal, GLFWwindow *window, int key) {
+  if (journal.mode == JournalReplaying)
+    return journal.keys[key];
+
+  return glfwGetKey(window, key) == GLFW_PRESS;
+}
+
+void recordKey(InputJournal *journal, int key, int action) {
+  // repeats do not change the polled state
+  if (journal->mode != JournalRecording || key < 0 || action == GLFW_REPEAT)
+    return;
+
+  journal->pendingEvents.push_back(KeyRecord);
+  appendBytes(&journal->pendingEvents, key, 2);
+  appendBytes(&journal->pendingEvents, action, 1);
+  journal->events++;
+}
+
+void recordCursor(InputJournal *journal, double x, double y) {
+  if (journal->mode != JournalRecording)
+    return;
+
+  journal->pendingEvents.push_back(CursorRecord);
+  appendDouble(&journal->pendingEvents, x);
+  appendDouble(&journal->pendingEvents, y);
+  journal->events++;
+}
+
+void recordScroll(InputJournal *journal, double x, double y) {
+  if (journal->mode != JournalRecording)
+    return;
+
+  journal->pendingEvents.push_back(ScrollRecord);
+  appendDouble(&journal->pendingEvents, x);
+  appendDouble(&journal->pendingEvents, y);
+  journal->events++;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include <GLFW/glfw3.h>
+
+#include "camera.h"
+
+// Little endian records after an "OGIJ" magic and a uint32 version:
+//
+//   uint8 0 frame   float32 frame time, starts the next frame
+//   uint8 1 key     uint16 key, uint8 action (press or release)
+//   uint8 2 cursor  float64 x, float64 y
+//   uint8 3 scroll  float64 x, float64 y
+//
+// Events belong to the frame record before them and are applied at the
+// start of that frame, which is when the polled or callback input would
+// have reached the camera in the recorded session
+enum InputJournalMode {
+  JournalOff,
+  JournalRecording,
+  JournalReplaying,
+};
+
+struct InputJournal {
+  InputJournalMode mode;
+
+  // recording, events of the frame that has not started yet
+  FILE *file;
+  std::vector<unsigned char> pendingEvents;
+
+  // replaying, the whole journal
+  std::vector<unsigned char> data;
+  size_t position;
+  bool keys[GLFW_KEY_LAST + 1];
+  bool finished;
+
+  int frames;
+  int events;
+  double startTime;
+};
+
+bool startInputRecording(InputJournal *journal, const char *path);
+bool startInputReplay(InputJournal *journal, const char *path);
+// Closes the recording or prints how the replay went
+void stopInputJournal(InputJournal *journal);
+
+// Call once at the start of every frame. Recording stores the frame time,
+// replay applies the events of the frame to the camera and returns its
+// recorded time in place of the given one. `finished` is set once the
+// replay runs out
+float beginInputFrame(InputJournal *journal, Camera *camera, float frameTime);
+
+// Replaces glfwGetKey, replays answer from the journal
+bool isKeyPressed(const InputJournal &journal, GLFWwindow *window, int key);
+
+// Recording hooks for the GLFW callbacks
+void recordKey(InputJournal *journal, int key, int action);
+void recordCursor(InputJournal *journal, double x, double y);
+void recordScroll(InputJournal *journal, double x, double y);
@@ -0,0 +1,336 @@
+#include <float.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "json.h"
+
+const JsonValue *JsonValue::find(const char *key) const {
+  if (type != JsonObject)
+    return NULL;
+
+  for (auto &member : object) {
+    if (member.first == key)
+      return &member.second;
+  }
+
+  return NULL;
+}
+
+// numbers that do not fit the target type give the fallback, casting them
+// would be undefined behaviour
+int JsonValue::asInt(int fallback) const {
+  if (type != JsonNumber || !(number >= (double)INT_MIN) ||
+      !(number <= (double)INT_MAX))
+    return fallback;
+
+  return (int)number;
+}
+
+float JsonValue::asFloat(float fallback) const {
+  if (type != JsonNumber || !(number >= -(double)FLT_MAX) ||
+      !(number <= (double)FLT_MAX))
+    return fallback;
+
+  return (float)number;
+}
+
+size_t JsonValue::asSize(size_t fallback) const {
+  // (double)SIZE_MAX rounds up to 2^64, which is already out of range
+  if (type != JsonNumber || !(number >= 0.0) ||
+      !(number < (double)SIZE_MAX))
+    return fallback;
+
+  return (size_t)number;
+}
+
+struct JsonParser {
+  const char *cursor;
+  const char *end;
+  std::string *error;
+};
+
+// glTF documents are shallow, this only guards against malicious input
+const int maxJsonDepth = 64;
+
+static bool fail(JsonParser *parser, const char *message) {
+  if (parser->error->empty())
+    *parser->error = message;
+
+  return false;
+}
+
+static void skipWhitespace(JsonParser *parser) {
+  while (parser->cursor < parser->end &&
+         (*parser->cursor == ' ' || *parser->cursor == '\t' ||
+          *parser->cursor == '\n' || *parser->cursor == '\r'))
+    parser->cursor++;
+}
+
+static bool consumeLiteral(JsonParser *parser, const char *literal) {
+  auto length = strlen(literal);
+  if ((size_t)(parser->end - parser->cursor) < length ||
+      memcmp(parser->cursor, literal, length) != 0)
+    return fail(parser, "invalid literal");
+
+  parser->cursor += length;
+  return true;
+}
+
+static void appendUtf8(std::string *out, unsigned int codepoint) {
+  if (codepoint < 0x80) {
+    out->push_back((char)codepoint);
+  } else if (codepoint < 0x800) {
+    out->push_back((char)(0xC0 | (codepoint >> 6)));
+    out->push_back((char)(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back((char)(0xE0 | (codepoint >> 12)));
+    out->push_back((char)(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back((char)(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back((char)(0xF0 | (codepoint >> 18)));
+    out->push_back((char)(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back((char)(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back((char)(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+static bool parseHex4(JsonParser *parser, unsigned int *value) {
+  if (parser->end - parser->cursor < 4)
+    return fail(parser, "truncated unicode escape");
+
+  *value = 0;
+  for (auto i = 0; i < 4; i++) {
+    auto c = *parser->cursor++;
+    *value <<= 4;
+    if (c >= '0' && c <= '9')
+      *value |= c - '0';
+    else if (c >= 'a' && c <= 'f')
+      *value |= c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F')
+      *value |= c - 'A' + 10;
+    else
+      return fail(parser, "invalid unicode escape");
+  }
+
+  return true;
+}
+
+static bool parseString(JsonParser *parser, std::string *out) {
+  // opening quote was already checked by the caller
+  parser->cursor++;
+
+  while (parser->cursor < parser->end) {
+    // copy runs of plain characters in one go, most strings have no escapes
+    auto runStart = parser->cursor;
+    while (parser->cursor < parser->end && *parser->cursor != '"' &&
+           *parser->cursor != '\\')
+      parser->cursor++;
+    out->append(runStart, parser->cursor - runStart);
+
+    if (parser->cursor >= parser->end)
+      break;
+
+    if (*parser->cursor == '"') {
+      parser->cursor++;
+      return true;
+    }
+
+    // escape sequence
+    parser->cursor++;
+    if (parser->cursor >= parser->end)
+      break;
+
+    auto escaped = *parser->cursor++;
+    switch (escaped) {
+    case '"':
+    case '\\':
+    case '/':
+      out->push_back(escaped);
+      break;
+    case 'b':
+      out->push_back('\b');
+      break;
+    case 'f':
+      out->push_back('\f');
+      break;
+    case 'n':
+      out->push_back('\n');
+      break;
+    case 'r':
+      out->push_back('\r');
+      break;
+    case 't':
+      out->push_back('\t');
+      break;
+    case 'u': {
+      unsigned int codepoint;
+      if (!parseHex4(parser, &codepoint))
+        return false;
+
+      // surrogate pair
+      if (codepoint >= 0xD800 && codepoint <= 0xDBFF &&
+          parser->end - parser->cursor >= 6 && parser->cursor[0] == '\\' &&
+          parser->cursor[1] == 'u') {
+        parser->cursor += 2;
+        unsigned int low;
+        if (!parseHex4(parser, &low))
+          return false;
+        codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+      }
+
+      appendUtf8(out, codepoint);
+      break;
+    }
+    default:
+      return fail(parser, "invalid escape sequence");
+    }
+  }
+
+  return fail(parser, "unterminated string");
+}
+
+static bool parseNumber(JsonParser *parser, double *out) {
+  // strtod needs a terminated buffer and the chunk we parse from is not, so
+  // copy the (short) number literal out first
+  char literal[64];
+  size_t length = 0;
+  while (parser->cursor + length < parser->end && length < sizeof(literal) - 1) {
+    auto c = parser->cursor[length];
+    if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' ||
+        c == 'e' || c == 'E')
+      length++;
+    else
+      break;
+  }
+
+  if (length == 0)
+    return fail(parser, "unexpected character");
+
+  memcpy(literal, parser->cursor, length);
+  literal[length] = '\0';
+
+  char *numberEnd;
+  *out = strtod(literal, &numberEnd);
+  if (numberEnd != literal + length)
+    return fail(parser, "invalid number");
+
+  parser->cursor += length;
+  return true;
+}
+
+static bool parseValue(JsonParser *parser, JsonValue *value, int depth) {
+  if (depth > maxJsonDepth)
+    return fail(parser, "document nested too deeply");
+
+  skipWhitespace(parser);
+  if (parser->cursor >= parser->end)
+    return fail(parser, "unexpected end of document");
+
+  switch (*parser->cursor) {
+  case '{': {
+    value->type = JsonObject;
+    parser->cursor++;
+    skipWhitespace(parser);
+    if (parser->cursor < parser->end && *parser->cursor == '}') {
+      parser->cursor++;
+      return true;
+    }
+
+    while (true) {
+      skipWhitespace(parser);
+      if (parser->cursor >= parser->end || *parser->cursor != '"')
+        return fail(parser, "expected object key");
+
+      value->object.emplace_back();
+      auto &member = value->object.back();
+      if (!parseString(parser, &member.first))
+        return false;
+
+      skipWhitespace(parser);
+      if (parser->cursor >= parser->end || *parser->cursor != ':')
+        return fail(parser, "expected ':'");
+      parser->cursor++;
+
+      if (!parseValue(parser, &member.second, depth + 1))
+        return false;
+
+      skipWhitespace(parser);
+      if (parser->cursor < parser->end && *parser->cursor == ',') {
+        parser->cursor++;
+        continue;
+      }
+      if (parser->cursor < parser->end && *parser->cursor == '}') {
+        parser->cursor++;
+        return true;
+      }
+
+      return fail(parser, "expected ',' or '}'");
+    }
+  }
+  case '[': {
+    value->type = JsonArray;
+    parser->cursor++;
+    skipWhitespace(parser);
+    if (parser->cursor < parser->end && *parser->cursor == ']') {
+      parser->cursor++;
+      return true;
+    }
+
+    while (true) {
+      value->array.emplace_back();
+      if (!parseValue(parser, &value->array.back(), depth + 1))
+        return false;
+
+      skipWhitespace(parser);
+      if (parser->cursor < parser->end && *parser->cursor == ',') {
+        parser->cursor++;
+        continue;
+      }
+      if (parser->cursor < parser->end && *parser->cursor == ']') {
+        parser->cursor++;
+        return true;
+      }
+
+      return fail(parser, "expected ',' or ']'");
+    }
+  }
+  case '"':
+    value->type = JsonString;
+    return parseString(parser, &value->string);
+  case 't':
+    value->type = JsonBool;
+    value->boolean = true;
+    return consumeLiteral(parser, "true");
+  case 'f':
+    value->type = JsonBool;
+    value->boolean = false;
+    return consumeLiteral(parser, "false");
+  case 'n':
+    value->type = JsonNull;
+    return consumeLiteral(parser, "null");
+  default:
+    value->type = JsonNumber;
+    return parseNumber(parser, &value->number);
+  }
+}
+
+bool parseJson(const char *text, size_t length, JsonValue *document,
+               std::string *error) {
+  JsonParser parser;
+  parser.cursor = text;
+  parser.end = text + length;
+  parser.error = error;
+  error->clear();
+
+  if (!parseValue(&parser, document, 0))
+    return false;
+
+  // glb pads the JSON chunk with trailing spaces
+  skipWhitespace(&parser);
+  if (parser.cursor != parser.end)
+    return fail(&parser, "trailing characters after document");
+
+  return true;
+}
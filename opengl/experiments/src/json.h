@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum JsonType {
+  JsonNull,
+  JsonBool,
+  JsonNumber,
+  JsonString,
+  JsonArray,
+  JsonObject,
+};
+
+struct JsonValue {
+  JsonType type = JsonNull;
+  bool boolean = false;
+  double number = 0.0;
+  std::string string;
+  std::vector<JsonValue> array;
+  std::vector<std::pair<std::string, JsonValue>> object;
+
+  // returns NULL when this is not an object or the key is missing
+  const JsonValue *find(const char *key) const;
+
+  int asInt(int fallback = 0) const;
+  float asFloat(float fallback = 0.0f) const;
+  size_t asSize(size_t fallback = 0) const;
+};
+
+// Parses a complete JSON document, `error` gets a short description of the
+// first problem found when it returns false
+bool parseJson(const char *text, size_t length, JsonValue *document,
+               std::string *error);
@@ -1,5 +1,7 @@
 #include <stdio.h>
+#include <string.h>
 #include <cmath>
+#include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -13,39 +15,221 @@
 #include "textures.h"
 #include "camera.h"
 #include "window.h"
+#include "gltf.h"
+#include "meshes.h"
+#include "clustered.h"
+#include "shadows.h"
+#include "visibility.h"
+#include "dynamic_resolution.h"
+#include "capture.h"
+#include "regression.h"
+#include "input_journal.h"
+#include "frame_pacer.h"
+#include "multi_window.h"
+#include "render_thread.h"
+#include "overlay.h"
+#include "gpu_memory.h"
+#include "particles.h"
+
+// switched at runtime with V
+auto useVisibilityBuffer = false;
+// the camera only follows the regression script, never the real input
+auto runningRegression = false;
+// records the input or replays it in place of the real one, zero
+// initialized so it starts off
+InputJournal journal;
+// the one camera of the window, set up in main
+Camera camera;
 
 void framebufferSizeCallback(GLFWwindow *window, int width, int height) {
   glViewport(0, 0, width, height);
+  setCameraAspectRatio(&camera, width, height);
+}
+
+static bool keyPressed(GLFWwindow *window, int key) {
+  return isKeyPressed(journal, window, key);
 }
 
 void processInput(GLFWwindow *window, float timeSinceLastFrame) {
-  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+  if (keyPressed(window, GLFW_KEY_ESCAPE))
     glfwSetWindowShouldClose(window, true);
 
   //  camera movement
   auto cameraSpeed = timeSinceLastFrame * 2.5f;
-  if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS)
-    moveCamera(cameraSpeed, Forward);
-  if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS)
-    moveCamera(cameraSpeed, Backwards);
-  if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS)
-    moveCamera(cameraSpeed, Right);
-  if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS)
-    moveCamera(cameraSpeed, Left);
+  if (keyPressed(window, GLFW_KEY_UP))
+    moveCamera(&camera, cameraSpeed, Forward);
+  if (keyPressed(window, GLFW_KEY_DOWN))
+    moveCamera(&camera, cameraSpeed, Backwards);
+  if (keyPressed(window, GLFW_KEY_RIGHT))
+    moveCamera(&camera, cameraSpeed, Right);
+  if (keyPressed(window, GLFW_KEY_LEFT))
+    moveCamera(&camera, cameraSpeed, Left);
+
+  // render path, toggled once per key press
+  static auto visibilityKeyWasPressed = false;
+  auto visibilityKeyPressed = keyPressed(window, GLFW_KEY_V);
+  if (visibilityKeyPressed && !visibilityKeyWasPressed) {
+    useVisibilityBuffer = !useVisibilityBuffer;
+    printf("rendering with %s\n",
+           useVisibilityBuffer ? "the visibility buffer" : "forward shading");
+  }
+  visibilityKeyWasPressed = visibilityKeyPressed;
 }
 
 void cursorPositionCallback(GLFWwindow *window, double xPosition,
                             double yPosition) {
-  cameraLookAround(xPosition, yPosition);
+  if (runningRegression || journal.mode == JournalReplaying)
+    return;
+  recordCursor(&journal, xPosition, yPosition);
+  cameraLookAround(&camera, xPosition, yPosition);
 }
 
 void scrollCallback(GLFWwindow *window, double xoffset, double yoffset) {
-  cameraZoomOut(yoffset);
+  if (runningRegression || journal.mode == JournalReplaying)
+    return;
+  recordScroll(&journal, xoffset, yoffset);
+  cameraZoomOut(&camera, yoffset);
+}
+
+// keys are polled in processInput, this only feeds the journal
+void keyCallback(GLFWwindow *window, int key, int scancode, int action,
+                 int mods) {
+  recordKey(&journal, key, action);
 }
 
-int main(void) {
+enum Benchmark {
+  NoBenchmark,
+  GltfLoadBenchmark,
+  ClusteredLightingBenchmark,
+  VisibilityBufferBenchmark,
+  DynamicResolutionBenchmark,
+  CaptureBenchmark,
+  LatencyBenchmark,
+  MultiWindowBenchmark,
+  RenderThreadBenchmark,
+  ParticleBenchmark,
+  OverlayBenchmark,
+};
+
+int main(int argc, char **argv) {
+  // command line
+  auto benchmark = NoBenchmark;
+  const char *gltfBenchmarkPath = NULL;
+  const char *scenePath = NULL;
+  auto lightCount = 0;
+  auto useShadows = false;
+  auto useDynamicResolution = false;
+  auto useTemporalUpscaling = false;
+  auto frameTimeTarget = 16.0f;
+  const char *capturePath = NULL;
+  const char *regressionScriptPath = NULL;
+  const char *goldenDirectory = NULL;
+  auto updateGoldens = false;
+  const char *recordInputPath = NULL;
+  const char *replayInputPath = NULL;
+  auto headless = false;
+  auto windowCount = 1;
+  auto particleCount = 0;
+  auto useOverlay = false;
+  auto memoryBudgetMegabytes = 0;
+  auto swapMode = SwapVsync;
+  auto usePacer = false;
+  auto lowLatency = false;
+  for (auto i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--gltf-benchmark") == 0) {
+      benchmark = GltfLoadBenchmark;
+      if (i + 1 < argc && argv[i + 1][0] != '-')
+        gltfBenchmarkPath = argv[++i];
+    } else if (strcmp(argv[i], "--clustered-benchmark") == 0) {
+      benchmark = ClusteredLightingBenchmark;
+    } else if (strcmp(argv[i], "--visibility-benchmark") == 0) {
+      benchmark = VisibilityBufferBenchmark;
+    } else if (strcmp(argv[i], "--visibility-buffer") == 0) {
+      useVisibilityBuffer = true;
+    } else if (strcmp(argv[i], "--resolution-benchmark") == 0) {
+      benchmark = DynamicResolutionBenchmark;
+      frameTimeTarget = 8.0f;
+      if (i + 1 < argc && argv[i + 1][0] != '-')
+        frameTimeTarget = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--dynamic-resolution") == 0) {
+      useDynamicResolution = true;
+      if (i + 1 < argc && argv[i + 1][0] != '-')
+        frameTimeTarget = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--temporal") == 0) {
+      useTemporalUpscaling = true;
+    } else if (strcmp(argv[i], "--capture-benchmark") == 0) {
+      benchmark = CaptureBenchmark;
+    } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+      capturePath = argv[++i];
+    } else if (strcmp(argv[i], "--regression") == 0 && i + 2 < argc) {
+      regressionScriptPath = argv[++i];
+      goldenDirectory = argv[++i];
+    } else if (strcmp(argv[i], "--update-goldens") == 0) {
+      updateGoldens = true;
+    } else if (strcmp(argv[i], "--record-input") == 0 && i + 1 < argc) {
+      recordInputPath = argv[++i];
+    } else if (strcmp(argv[i], "--replay-input") == 0 && i + 1 < argc) {
+      replayInputPath = argv[++i];
+    } else if (strcmp(argv[i], "--headless") == 0) {
+      headless = true;
+    } else if (strcmp(argv[i], "--latency-benchmark") == 0) {
+      benchmark = LatencyBenchmark;
+    } else if (strcmp(argv[i], "--multi-window-benchmark") == 0) {
+      benchmark = MultiWindowBenchmark;
+    } else if (strcmp(argv[i], "--render-thread-benchmark") == 0) {
+      benchmark = RenderThreadBenchmark;
+    } else if (strcmp(argv[i], "--particle-benchmark") == 0) {
+      benchmark = ParticleBenchmark;
+    } else if (strcmp(argv[i], "--overlay-benchmark") == 0) {
+      benchmark = OverlayBenchmark;
+    } else if (strcmp(argv[i], "--overlay") == 0) {
+      useOverlay = true;
+    } else if (strcmp(argv[i], "--particles") == 0 && i + 1 < argc) {
+      particleCount = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--windows") == 0 && i + 1 < argc) {
+      windowCount = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc) {
+      i++;
+      swapMode = strcmp(argv[i], "adaptive") == 0 ? SwapAdaptive
+                 : atoi(argv[i]) == 0             ? SwapImmediate
+                                                  : SwapVsync;
+      usePacer = true;
+    } else if (strcmp(argv[i], "--low-latency") == 0) {
+      lowLatency = true;
+      usePacer = true;
+    } else if (strcmp(argv[i], "--memory-budget") == 0 && i + 1 < argc) {
+      memoryBudgetMegabytes = atoi(argv[++i]);
+      // 0 means unlimited, a negative budget would wrap to a huge one
+      if (memoryBudgetMegabytes < 0) {
+        fprintf(stderr, "--memory-budget must not be negative\n");
+        exit(EXIT_FAILURE);
+      }
+    } else if (strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+      scenePath = argv[++i];
+    } else if (strcmp(argv[i], "--shadows") == 0) {
+      useShadows = true;
+    } else if (strcmp(argv[i], "--lights") == 0 && i + 1 < argc) {
+      lightCount = atoi(argv[++i]);
+    } else {
+      fprintf(stderr, "unknown argument: %s\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  RegressionRun regression;
+  if (regressionScriptPath != NULL) {
+    if (!beginRegressionRun(&regression, regressionScriptPath,
+                            goldenDirectory, updateGoldens))
+      exit(EXIT_FAILURE);
+    runningRegression = true;
+  }
+  // ---
+
   // init glfw
   glfwInit();
+  if (benchmark != NoBenchmark || runningRegression || headless)
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
   auto window = createWindow(800, 600, framebufferSizeCallback, scrollCallback,
                              cursorPositionCallback);
   if (window == NULL) {
@@ -54,6 +238,15 @@ int main(void) {
     glfwTerminate();
     exit(EXIT_FAILURE);
   }
+  glfwSetKeyCallback(window, keyCallback);
+
+  // before anything can generate input events
+  if (recordInputPath != NULL &&
+      !startInputRecording(&journal, recordInputPath))
+    exit(EXIT_FAILURE);
+  if (replayInputPath != NULL &&
+      !startInputReplay(&journal, replayInputPath))
+    exit(EXIT_FAILURE);
 
   // Setup OpenGL
   if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
@@ -62,74 +255,83 @@ int main(void) {
   }
 
   glEnable(GL_DEPTH_TEST);
+
+  if (runningRegression)
+    glfwSetWindowSize(window, regression.script.width,
+                      regression.script.height);
+
+  // the size callback only runs on changes
+  int framebufferWidth, framebufferHeight;
+  glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+  initCamera(&camera, glm::vec3(0.0f, 0.0f, 3.0f), -90.0f, 0.0f, 60.0f,
+             (float)framebufferWidth / (float)framebufferHeight);
+  // look around offsets start from the middle of the window, the regression
+  // scripts rely on it
+  int windowWidth, windowHeight;
+  glfwGetWindowSize(window, &windowWidth, &windowHeight);
+  camera.lastCursor = glm::dvec2(windowWidth / 2.0, windowHeight / 2.0);
+  camera.hasCursor = true;
   // ---
 
+  if (benchmark != NoBenchmark) {
+    stbi_set_flip_vertically_on_load(true);
+
+    switch (benchmark) {
+    case GltfLoadBenchmark:
+      runGltfLoadBenchmark(gltfBenchmarkPath);
+      break;
+    case ClusteredLightingBenchmark:
+      runClusteredLightingBenchmark(window);
+      break;
+    case VisibilityBufferBenchmark:
+      runVisibilityBufferBenchmark(window);
+      break;
+    case DynamicResolutionBenchmark:
+      runDynamicResolutionBenchmark(window, frameTimeTarget);
+      break;
+    case CaptureBenchmark:
+      runCaptureBenchmark(window);
+      break;
+    case LatencyBenchmark:
+      runLatencyBenchmark(window);
+      break;
+    case MultiWindowBenchmark:
+      runMultiWindowBenchmark(window);
+      break;
+    case RenderThreadBenchmark:
+      runRenderThreadBenchmark(window);
+      break;
+    case ParticleBenchmark:
+      runParticleBenchmark(window);
+      break;
+    case OverlayBenchmark:
+      runOverlayBenchmark(window);
+      break;
+    case NoBenchmark:
+      break;
+    }
+
+    glfwTerminate();
+    return 0;
+  }
+
+  if (windowCount > 1) {
+    stbi_set_flip_vertically_on_load(true);
+    runMultiWindowViewer(window, windowCount);
+
+    glfwTerminate();
+    return 0;
+  }
+
+  // the scene is parsed in the background while the cubes are rendered
+  GltfPendingLoad *pendingScene = NULL;
+  GltfScene scene;
+  auto sceneLoaded = false;
+  if (scenePath != NULL)
+    pendingScene = beginGltfLoad(scenePath);
+
   // Copy the vertices data to the GPU
-  unsigned int vertexArrayObject;
-  glGenVertexArrays(1, &vertexArrayObject);
-  glBindVertexArray(vertexArrayObject);
-
-  // clang-format off
-  float vertices[] = {
-    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
-     0.5f, -0.5f, -0.5f,  1.0f, 0.0f,
-     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,
-
-    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
-     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,
-    -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,
-    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-
-    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-    -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-
-     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-     0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-     0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-     0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-
-    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-     0.5f, -0.5f, -0.5f,  1.0f, 1.0f,
-     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,
-    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,
-
-    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,
-     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,
-     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,
-    -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,
-    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f
-    };
-  // clang-format on
-
-  unsigned int vertexBuffer;
-  glGenBuffers(1, &vertexBuffer);
-  glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-  // --
-
-  // set the vertex attributes pointers
-  // position
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)0);
-  glEnableVertexAttribArray(0);
-
-  // texture coordinate
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float),
-                        (void *)(3 * sizeof(float)));
-  glEnableVertexAttribArray(1);
+  auto cube = createCubeMesh();
 
   auto shaderProgram = createShaderProgram();
   glUseProgram(shaderProgram);
@@ -143,6 +345,37 @@ int main(void) {
   glUniform1i(glGetUniformLocation(shaderProgram, "containerTexture"), 0);
   glUniform1i(glGetUniformLocation(shaderProgram, "awesomeFaceTexture"), 1);
 
+  // lit shading: clustered lights scattered around the cubes and/or a sun
+  // with cascaded shadows
+  auto useLitShading = lightCount > 0 || useShadows;
+  ClusteredLighting lighting;
+  ShadowCascades shadows;
+  unsigned int litShaderProgram = 0;
+  if (useLitShading) {
+    litShaderProgram = createLitShaderProgram();
+
+    createClusteredLighting(&lighting, lightCount > 0 ? lightCount : 1);
+    std::vector<Light> lights(lightCount);
+    generateLights(lights.data(), lightCount, glm::vec3(-6.0f, -4.0f, -17.0f),
+                   glm::vec3(6.0f, 6.0f, 3.0f), 1234);
+    uploadLights(&lighting, lights.data(), lightCount);
+  }
+  if (useShadows)
+    createShadowCascades(&shadows);
+  auto renderProgram = useLitShading ? litShaderProgram : shaderProgram;
+
+  VisibilityBuffer visibility;
+  createVisibilityBuffer(&visibility);
+
+  DynamicResolution resolution;
+  if (useDynamicResolution) {
+    createDynamicResolution(&resolution, frameTimeTarget,
+                            useTemporalUpscaling);
+    // the GPU timings differ on every run, the scale must not
+    if (runningRegression)
+      resolution.minimumScale = resolution.maximumScale = resolution.scale;
+  }
+
   glm::vec3 cubePositions[] = {
       glm::vec3(0.0f, 0.0f, 0.0f),    glm::vec3(2.0f, 5.0f, -15.0f),
       glm::vec3(-1.5f, -2.2f, -2.5f), glm::vec3(-3.8f, -2.0f, -12.3f),
@@ -150,14 +383,175 @@ int main(void) {
       glm::vec3(1.3f, -2.0f, -2.5f),  glm::vec3(1.5f, 2.0f, -2.5f),
       glm::vec3(1.5f, 0.2f, -1.5f),   glm::vec3(-1.3f, 1.0f, -1.5f)};
 
+  // with shadows on a floor is added below the cubes to receive them
+  const auto cubeCount = 10;
+  glm::mat4 cubeModels[cubeCount + 1];
+  cubeModels[cubeCount] =
+      glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -4.0f, -7.0f)),
+                 glm::vec3(30.0f, 0.2f, 30.0f));
+  auto drawnCubeCount = useShadows ? cubeCount + 1 : cubeCount;
+  ShadowCaster shadowCasters[cubeCount + 1];
+  auto sunDirection = glm::vec3(-0.4f, -1.0f, -0.3f);
+  auto lastShadowReportTime = 0.0;
+  auto lastVisibilityReportTime = 0.0;
+  auto lastResolutionReportTime = 0.0;
+
+  // a .y4m path records a video, anything else is a prefix for pngs
+  FrameCapture capture;
+  if (capturePath != NULL) {
+    auto pathLength = strlen(capturePath);
+    auto format = pathLength > 4 &&
+                          strcmp(capturePath + pathLength - 4, ".y4m") == 0
+                      ? CaptureY4m
+                      : CapturePng;
+    if (!createFrameCapture(&capture, capturePath, format, 2))
+      capturePath = NULL;
+  }
+  auto lastCaptureReportTime = 0.0;
+
+  // a fountain in front of the cubes
+  ParticleSystem particles;
+  if (particleCount > 0)
+    createParticleSystem(&particles, particleCount,
+                         glm::vec3(0.0f, -1.0f, -6.0f), 3.0f);
+  auto lastParticleReportTime = 0.0;
+
+  // frame time HUD, off by default so it never shows up in captures
+  Overlay overlay;
+  if (useOverlay && !createOverlay(&overlay, NULL, 13.0f))
+    useOverlay = false;
+  const int frameHistoryLength = 120;
+  float frameHistory[frameHistoryLength] = {};
+
+  FramePacer pacer;
+  if (usePacer)
+    createFramePacer(&pacer, window, swapMode, lowLatency);
+  auto lastPacerReportTime = 0.0;
+
+  // a regression run needs the scene from its first frame
+  if (runningRegression && pendingScene != NULL) {
+    sceneLoaded = finishGltfLoad(pendingScene, &scene, NULL);
+    pendingScene = NULL;
+  }
+
+  // streamed textures lose their top mips past it, least recently used
+  // first
+  setGpuMemoryBudget((size_t)memoryBudgetMegabytes * 1024 * 1024);
+  auto lastMemoryReportTime = 0.0;
+
+  auto frame = 0;
   auto lastFrameTime = 0.0f;
   while (!glfwWindowShouldClose(window)) {
-    // per frame time tracking
-    float currentFrameTime = glfwGetTime();
+    // the pacer polls as late as it can instead of right after the swap, so
+    // the frame is built from the freshest input
+    if (usePacer) {
+      waitForFrameStart(&pacer);
+      glfwPollEvents();
+      markInputSampled(&pacer);
+    }
+
+    // per frame time tracking, scripted runs advance a fixed step per frame
+    float currentFrameTime = runningRegression
+                                 ? frame * regression.script.timestep
+                                 : glfwGetTime();
+    // replays take the recorded time, which makes them deterministic
+    currentFrameTime = beginInputFrame(&journal, &camera, currentFrameTime);
+    if (journal.finished)
+      break;
     auto timeSinceLastFrame = currentFrameTime - lastFrameTime;
     lastFrameTime = currentFrameTime;
+    beginGpuMemoryFrame();
     // --
 
+    // input
+    if (runningRegression)
+      applyRegressionInput(&regression, &camera, frame);
+    else
+      processInput(window, timeSinceLastFrame);
+
+    // camera
+    updateCamera(&camera);
+    auto view = camera.view;
+    auto projection = camera.projection;
+
+    // with dynamic resolution everything below renders at a fraction of
+    // the window size, jittered when the frames are accumulated
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    auto renderProjection = projection;
+    if (useDynamicResolution) {
+      beginDynamicResolutionFrame(&resolution, width, height);
+      width = resolution.renderWidth;
+      height = resolution.renderHeight;
+      renderProjection = jitterProjection(resolution, projection);
+    }
+    // ----
+
+    for (auto i = 0; i < cubeCount; i++) {
+      auto model = glm::mat4(1.0f);
+      model = glm::translate(model, cubePositions[i]);
+
+      if (i % 3 == 0) {
+        /* float angle = 20.0f * i; */
+        /* model = glm::rotate(model, glm::radians(angle), */
+        model = glm::rotate(model, currentFrameTime,
+                            glm::vec3(1.0f, 0.3f, 0.5f));
+      }
+
+      auto angle = 20.0f * i;
+      model =
+          glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
+      cubeModels[i] = model;
+    }
+
+    // shadows
+    if (useShadows) {
+      for (auto i = 0; i < drawnCubeCount; i++) {
+        shadowCasters[i].model = cubeModels[i];
+        shadowCasters[i].center = glm::vec3(cubeModels[i][3]);
+        // half diagonal of the unit cube times the largest scale
+        shadowCasters[i].radius =
+            0.87f * fmaxf(glm::length(glm::vec3(cubeModels[i][0])),
+                          fmaxf(glm::length(glm::vec3(cubeModels[i][1])),
+                                glm::length(glm::vec3(cubeModels[i][2]))));
+      }
+
+      updateShadowCascades(&shadows, view, camera.fieldOfView,
+                           camera.aspectRatio, sunDirection);
+      renderShadowCascades(&shadows, cube, shadowCasters, drawnCubeCount,
+                           width, height);
+      useShadowCascades(shadows,
+                        useVisibilityBuffer ? visibility.shadeProgram
+                                            : renderProgram,
+                        glm::vec3(1.0f, 0.95f, 0.8f));
+
+      if (currentFrameTime - lastShadowReportTime > 1.0) {
+        printShadowStats(&shadows);
+        lastShadowReportTime = currentFrameTime;
+      }
+    }
+
+    if (useLitShading) {
+      // the jitter is well below a cluster, so the bounds are built without
+      // it and only rebuilt when the render size changes
+      updateClusters(&lighting, view, projection, width, height);
+      useClusteredLighting(lighting,
+                           useVisibilityBuffer ? visibility.shadeProgram
+                                               : renderProgram,
+                           width, height);
+    }
+
+    if (useVisibilityBuffer) {
+      resizeVisibilityBuffer(&visibility, width, height);
+      uploadVisibilityInstances(&visibility, cubeModels, drawnCubeCount);
+      renderVisibilityBuffer(&visibility, cube, drawnCubeCount, view,
+                             renderProjection);
+    }
+
+    if (useDynamicResolution)
+      bindDynamicResolutionTarget(resolution);
+    // ----
+
     glClearColor(0.2f, 0.3f, 0.4f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -167,52 +561,181 @@ int main(void) {
     glBindTexture(GL_TEXTURE_2D, containerTexture);
     glActiveTexture(GL_TEXTURE1);
     glBindTexture(GL_TEXTURE_2D, awesomeFaceTexture);
+    touchGpuTexture(containerTexture);
+    touchGpuTexture(awesomeFaceTexture);
 
-    // do I need to call this in the render loop?
-    glUseProgram(shaderProgram);
+    if (useVisibilityBuffer) {
+      shadeVisibilityBuffer(&visibility, cube, view, renderProjection,
+                            useLitShading);
 
-    // input
-    processInput(window, timeSinceLastFrame);
+      if (currentFrameTime - lastVisibilityReportTime > 1.0) {
+        printVisibilityStats(&visibility);
+        lastVisibilityReportTime = currentFrameTime;
+      }
+    }
 
-    // camera
-    auto view = cameraViewMatrix();
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE,
+    // do I need to call this in the render loop?
+    glUseProgram(renderProgram);
+
+    glUniformMatrix4fv(glGetUniformLocation(renderProgram, "view"), 1, GL_FALSE,
                        glm::value_ptr(view));
+    glUniformMatrix4fv(glGetUniformLocation(renderProgram, "projection"), 1,
+                       GL_FALSE, glm::value_ptr(renderProjection));
 
-    auto projection = cameraProjectionMatrix();
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1,
-                       GL_FALSE, glm::value_ptr(projection));
-    // ----
+    if (!useVisibilityBuffer) {
+      glBindVertexArray(cube.vertexArrayObject);
+      for (auto i = 0; i < drawnCubeCount; i++) {
+        glUniformMatrix4fv(glGetUniformLocation(renderProgram, "model"), 1,
+                           GL_FALSE, glm::value_ptr(cubeModels[i]));
 
-    glBindVertexArray(vertexArrayObject);
-    for (auto i = 0; i < 10; i++) {
-      auto model = glm::mat4(1.0f);
-      model = glm::translate(model, cubePositions[i]);
+        glDrawArrays(GL_TRIANGLES, 0, 36);
+      }
+    }
 
-      if (i % 3 == 0) {
-        /* float angle = 20.0f * i; */
-        /* model = glm::rotate(model, glm::radians(angle), */
-        model = glm::rotate(model, (float)glfwGetTime(),
-                            glm::vec3(1.0f, 0.3f, 0.5f));
+    if (pendingScene != NULL && isGltfLoadReady(pendingScene)) {
+      GltfLoadTimings timings;
+      sceneLoaded = finishGltfLoad(pendingScene, &scene, &timings);
+      pendingScene = NULL;
+
+      if (sceneLoaded) {
+        printf("loaded %s: parse %.2f ms, decode %.2f ms, upload %.2f ms\n",
+               scenePath, timings.parseSeconds * 1000.0,
+               timings.decodeSeconds * 1000.0, timings.uploadSeconds * 1000.0);
+      }
+    }
+
+    if (sceneLoaded) {
+      drawGltfScene(scene, glGetUniformLocation(renderProgram, "model"));
+    }
+
+    // blended, so after everything opaque
+    if (particleCount > 0) {
+      updateParticles(&particles, timeSinceLastFrame, camera.position);
+      drawParticles(&particles, view, renderProjection);
+
+      if (currentFrameTime - lastParticleReportTime > 1.0) {
+        printParticleStats(&particles);
+        lastParticleReportTime = currentFrameTime;
       }
+    }
 
-      auto angle = 20.0f * i;
-      model =
-          glm::rotate(model, glm::radians(angle), glm::vec3(1.0f, 0.3f, 0.5f));
-      glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1,
-                         GL_FALSE, glm::value_ptr(model));
+    if (useDynamicResolution) {
+      endDynamicResolutionFrame(&resolution, view, projection);
+
+      if (currentFrameTime - lastResolutionReportTime > 1.0) {
+        printDynamicResolutionStats(&resolution);
+        lastResolutionReportTime = currentFrameTime;
+      }
+    }
+
+    // at window resolution, after any upscaling
+    if (useOverlay) {
+      for (auto i = 1; i < frameHistoryLength; i++)
+        frameHistory[i - 1] = frameHistory[i];
+      frameHistory[frameHistoryLength - 1] = timeSinceLastFrame * 1000.0f;
+
+      int windowWidth, windowHeight;
+      glfwGetFramebufferSize(window, &windowWidth, &windowHeight);
+      beginOverlay(&overlay, windowWidth, windowHeight);
+      overlayRect(&overlay, 8.0f, 8.0f, 248.0f, 104.0f,
+                  overlayColor(0, 0, 0, 160));
+      overlayTextf(&overlay, 16.0f, 14.0f, overlayColor(255, 255, 255),
+                   "%.1f fps  %.2f ms\ncamera %.1f %.1f %.1f",
+                   timeSinceLastFrame > 0.0f ? 1.0f / timeSinceLastFrame : 0.0f,
+                   timeSinceLastFrame * 1000.0f, camera.position.x,
+                   camera.position.y, camera.position.z);
+      // 33 ms fills the graph, the line marks 16.7 ms
+      overlayGraph(&overlay, 16.0f, 48.0f, 224.0f, 48.0f, frameHistory,
+                   frameHistoryLength, 33.3f, overlayColor(96, 220, 96));
+      overlayRect(&overlay, 16.0f, 72.0f, 240.0f, 73.0f,
+                  overlayColor(255, 96, 96));
+
+      auto memory = gpuMemoryStats();
+      const auto megabyte = 1024.0f * 1024.0f;
+      overlayRect(&overlay, 8.0f, 112.0f, 248.0f, 215.0f,
+                  overlayColor(0, 0, 0, 160));
+      overlayTextf(&overlay, 16.0f, 118.0f, overlayColor(255, 255, 255),
+                   "gpu memory %.1f MB", memory.totalBytes / megabyte);
+      for (auto i = 0; i < gpuMemoryCategoryCount; i++) {
+        overlayTextf(&overlay, 16.0f, 131.0f + i * 13.0f,
+                     overlayColor(200, 200, 200), "  %-15s %6.1f MB",
+                     gpuMemoryCategoryName((GpuMemoryCategory)i),
+                     memory.bytes[i] / megabyte);
+      }
+      endOverlay(&overlay);
+    }
+
+    if (memoryBudgetMegabytes > 0 &&
+        currentFrameTime - lastMemoryReportTime > 1.0) {
+      printGpuMemoryStats();
+      lastMemoryReportTime = currentFrameTime;
+    }
+
+    if (capturePath != NULL) {
+      int windowWidth, windowHeight;
+      glfwGetFramebufferSize(window, &windowWidth, &windowHeight);
+      captureFrame(&capture, windowWidth, windowHeight);
+
+      if (currentFrameTime - lastCaptureReportTime > 1.0) {
+        printCaptureStats(&capture);
+        lastCaptureReportTime = currentFrameTime;
+      }
+    }
 
-      glDrawArrays(GL_TRIANGLES, 0, 36);
+    if (runningRegression) {
+      int windowWidth, windowHeight;
+      glfwGetFramebufferSize(window, &windowWidth, &windowHeight);
+      checkRegressionFrame(&regression, frame, windowWidth, windowHeight);
+
+      if (frame + 1 >= regression.script.frameCount)
+        glfwSetWindowShouldClose(window, true);
     }
 
-    glfwSwapBuffers(window);
-    glfwPollEvents();
+    if (usePacer) {
+      presentFrame(&pacer);
+
+      if (currentFrameTime - lastPacerReportTime > 1.0) {
+        printFramePacerStats(&pacer);
+        lastPacerReportTime = currentFrameTime;
+      }
+    } else {
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+    frame++;
   }
 
-  glDeleteVertexArrays(1, &vertexArrayObject);
-  glDeleteBuffers(1, &vertexBuffer);
+  if (capturePath != NULL)
+    finishFrameCapture(&capture);
+  stopInputJournal(&journal);
+
+  if (pendingScene != NULL)
+    finishGltfLoad(pendingScene, &scene, NULL);
+  deleteGltfScene(&scene);
+
+  deleteVisibilityBuffer(&visibility);
+  if (particleCount > 0)
+    deleteParticleSystem(&particles);
+  if (useOverlay)
+    deleteOverlay(&overlay);
+  if (useDynamicResolution)
+    deleteDynamicResolution(&resolution);
+  if (useShadows)
+    deleteShadowCascades(&shadows);
+  if (useLitShading) {
+    deleteClusteredLighting(&lighting);
+    deleteGpuProgram(litShaderProgram);
+  }
+
+  deleteGpuTextures(1, &containerTexture);
+  deleteGpuTextures(1, &awesomeFaceTexture);
+  deleteGpuProgram(shaderProgram);
+  deleteMesh(&cube);
 
   glfwTerminate();
 
+  if (runningRegression)
+    return finishRegressionRun(&regression);
+
   return 0;
 }
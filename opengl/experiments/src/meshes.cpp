@@ -0,0 +1,113 @@
+#include <glad/glad.h>
+
+#include "gpu_memory.h"
+#include "meshes.h"
+
+static void setupVertexAttributes() {
+  auto stride = 8 * sizeof(float);
+
+  // position
+  glVertexAttribPointer(meshPositionLocation, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void *)0);
+  glEnableVertexAttribArray(meshPositionLocation);
+
+  // texture coordinate
+  glVertexAttribPointer(meshTexCoordLocation, 2, GL_FLOAT, GL_FALSE, stride,
+                        (void *)(3 * sizeof(float)));
+  glEnableVertexAttribArray(meshTexCoordLocation);
+
+  // normal
+  glVertexAttribPointer(meshNormalLocation, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void *)(5 * sizeof(float)));
+  glEnableVertexAttribArray(meshNormalLocation);
+}
+
+Mesh createCubeMesh() {
+  Mesh mesh;
+  mesh.vertexCount = 36;
+
+  glGenVertexArrays(1, &mesh.vertexArrayObject);
+  glBindVertexArray(mesh.vertexArrayObject);
+
+  // clang-format off
+  float vertices[] = {
+    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+     0.5f, -0.5f, -0.5f,  1.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   0.0f,  0.0f, -1.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   0.0f,  0.0f, -1.0f,
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,   0.0f,  0.0f, -1.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f,   0.0f,  0.0f, -1.0f,
+
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,   0.0f,  0.0f,  1.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,   0.0f,  0.0f,  1.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    -0.5f,  0.5f,  0.5f,  0.0f, 1.0f,   0.0f,  0.0f,  1.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,   0.0f,  0.0f,  1.0f,
+
+    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f,  0.5f, -0.5f,  1.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f,  -1.0f,  0.0f,  0.0f,
+
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   1.0f,  0.0f,  0.0f,
+     0.5f, -0.5f, -0.5f,  0.0f, 1.0f,   1.0f,  0.0f,  0.0f,
+     0.5f, -0.5f, -0.5f,  0.0f, 1.0f,   1.0f,  0.0f,  0.0f,
+     0.5f, -0.5f,  0.5f,  0.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,   1.0f,  0.0f,  0.0f,
+
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,   0.0f, -1.0f,  0.0f,
+     0.5f, -0.5f, -0.5f,  1.0f, 1.0f,   0.0f, -1.0f,  0.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+     0.5f, -0.5f,  0.5f,  1.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f,   0.0f, -1.0f,  0.0f,
+    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f,   0.0f, -1.0f,  0.0f,
+
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,   0.0f,  1.0f,  0.0f,
+     0.5f,  0.5f, -0.5f,  1.0f, 1.0f,   0.0f,  1.0f,  0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+     0.5f,  0.5f,  0.5f,  1.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+    -0.5f,  0.5f,  0.5f,  0.0f, 0.0f,   0.0f,  1.0f,  0.0f,
+    -0.5f,  0.5f, -0.5f,  0.0f, 1.0f,   0.0f,  1.0f,  0.0f
+    };
+  // clang-format on
+
+  mesh.vertexBuffer = createGpuBuffer(GpuMemoryGeometry, GL_ARRAY_BUFFER,
+                                      sizeof(vertices), vertices,
+                                      GL_STATIC_DRAW);
+  setupVertexAttributes();
+
+  glBindVertexArray(0);
+
+  return mesh;
+}
+
+Mesh shareMesh(const Mesh &mesh) {
+  auto shared = mesh;
+
+  glGenVertexArrays(1, &shared.vertexArrayObject);
+  glBindVertexArray(shared.vertexArrayObject);
+  glBindBuffer(GL_ARRAY_BUFFER, shared.vertexBuffer);
+  setupVertexAttributes();
+  glBindVertexArray(0);
+
+  return shared;
+}
+
+void deleteMesh(Mesh *mesh) {
+  glDeleteVertexArrays(1, &mesh->vertexArrayObject);
+  deleteGpuBuffers(1, &mesh->vertexBuffer);
+}
+
+void attachInstanceOffsets(const Mesh &mesh, unsigned int offsetsBuffer) {
+  glBindVertexArray(mesh.vertexArrayObject);
+  glBindBuffer(GL_ARRAY_BUFFER, offsetsBuffer);
+  glVertexAttribPointer(meshInstanceOffsetLocation, 3, GL_FLOAT, GL_FALSE,
+                        3 * sizeof(float), (void *)0);
+  glVertexAttribDivisor(meshInstanceOffsetLocation, 1);
+  glEnableVertexAttribArray(meshInstanceOffsetLocation);
+  glBindVertexArray(0);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Attribute locations shared by every shader that draws these meshes
+const int meshPositionLocation = 0;
+const int meshTexCoordLocation = 1;
+const int meshNormalLocation = 2;
+const int meshInstanceOffsetLocation = 3;
+
+struct Mesh {
+  unsigned int vertexArrayObject;
+  unsigned int vertexBuffer;
+  int vertexCount;
+};
+
+// Unit cube centered at the origin, position/texture coordinate/normal
+Mesh createCubeMesh();
+void deleteMesh(Mesh *mesh);
+
+// The same vertex buffer behind a new vertex array, for contexts sharing
+// objects with the one that created the mesh since vertex arrays are never
+// shared. Only its vertexArrayObject belongs to it
+Mesh shareMesh(const Mesh &mesh);
+
+// Feeds a tightly packed vec3 per instance into meshInstanceOffsetLocation
+void attachInstanceOffsets(const Mesh &mesh, unsigned int offsetsBuffer);
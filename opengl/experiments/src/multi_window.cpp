@@ -0,0 +1,365 @@
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/constants.hpp>
+
+#include "multi_window.h"
+#include "window.h"
+
+static void setupContext(MultiWindowRenderer *renderer,
+                         ViewportWindow *viewport) {
+  viewport->cube = shareMesh(renderer->scene->cube);
+  attachInstanceOffsets(viewport->cube, renderer->scene->offsetsBuffer);
+  glEnable(GL_DEPTH_TEST);
+  glfwSwapInterval(0);
+  viewport->contextReady = true;
+}
+
+static void drawFrame(MultiWindowRenderer *renderer,
+                      const ViewportFrame *frames) {
+  auto pacingWindow = -1;
+  for (auto i = 0; i < renderer->windowCount; i++) {
+    auto &frame = frames[i];
+    auto viewport = &renderer->windows[i];
+    if (frame.skipped) {
+      renderer->skippedWindows++;
+      continue;
+    }
+    if (pacingWindow < 0)
+      pacingWindow = i;
+
+    glfwMakeContextCurrent(viewport->window);
+    if (!viewport->contextReady)
+      setupContext(renderer, viewport);
+
+    glViewport(0, 0, frame.width, frame.height);
+    drawBenchmarkScene(renderer->scene, viewport->cube, frame.view,
+                       frame.projection, frame.width, frame.height);
+    // the next window reads the cluster buffers this one wrote, from
+    // another context
+    glFlush();
+    renderer->drawnWindows++;
+  }
+
+  // only one window waits for the vertical blank, otherwise every window
+  // would cost a whole refresh
+  if (renderer->vsync && pacingWindow != renderer->pacingWindow) {
+    if (renderer->pacingWindow >= 0) {
+      glfwMakeContextCurrent(renderer->windows[renderer->pacingWindow].window);
+      glfwSwapInterval(0);
+    }
+    if (pacingWindow >= 0) {
+      glfwMakeContextCurrent(renderer->windows[pacingWindow].window);
+      glfwSwapInterval(1);
+    }
+    renderer->pacingWindow = pacingWindow;
+  }
+
+  // swaps batched after all the drawing, the paced one last so the others
+  // do not wait behind it
+  for (auto i = 0; i < renderer->windowCount; i++) {
+    if (frames[i].skipped || i == pacingWindow)
+      continue;
+    glfwMakeContextCurrent(renderer->windows[i].window);
+    glfwSwapBuffers(renderer->windows[i].window);
+  }
+  if (pacingWindow >= 0) {
+    glfwMakeContextCurrent(renderer->windows[pacingWindow].window);
+    glfwSwapBuffers(renderer->windows[pacingWindow].window);
+  }
+
+  renderer->frames++;
+}
+
+static void renderThread(MultiWindowRenderer *renderer) {
+  ViewportFrame frames[maxViewportWindows];
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(renderer->mutex);
+      renderer->frameSubmitted.wait(lock, [renderer] {
+        return renderer->hasSubmitted || renderer->quit;
+      });
+      // a frame submitted before quit is still drawn, so the last frame
+      // is never lost
+      if (!renderer->hasSubmitted)
+        break;
+
+      for (auto i = 0; i < renderer->windowCount; i++)
+        frames[i] = renderer->submitted[i];
+      renderer->hasSubmitted = false;
+    }
+    renderer->frameTaken.notify_one();
+
+    drawFrame(renderer, frames);
+  }
+
+  // vertex arrays can only be deleted from their own context
+  for (auto i = 0; i < renderer->windowCount; i++) {
+    auto viewport = &renderer->windows[i];
+    if (!viewport->contextReady)
+      continue;
+    glfwMakeContextCurrent(viewport->window);
+    glDeleteVertexArrays(1, &viewport->cube.vertexArrayObject);
+    viewport->contextReady = false;
+  }
+  glfwMakeContextCurrent(NULL);
+}
+
+void createMultiWindowRenderer(MultiWindowRenderer *renderer,
+                               BenchmarkScene *scene, GLFWwindow **windows,
+                               int windowCount, bool vsync) {
+  renderer->scene = scene;
+  renderer->windowCount =
+      windowCount < maxViewportWindows ? windowCount : maxViewportWindows;
+  renderer->vsync = vsync;
+
+  for (auto i = 0; i < renderer->windowCount; i++) {
+    auto viewport = &renderer->windows[i];
+    viewport->window = windows[i];
+    viewport->contextReady = false;
+
+    // spread around the field, all looking at its center
+    auto angle = i * glm::two_pi<float>() / renderer->windowCount;
+    auto distance = scene->halfField + 6.0f;
+    initCamera(&viewport->camera,
+               glm::vec3(sinf(angle) * distance, 0.0f, cosf(angle) * distance),
+               -90.0f - glm::degrees(angle), 0.0f, 60.0f, 1.0f);
+  }
+
+  renderer->hasSubmitted = false;
+  renderer->quit = false;
+  renderer->pacingWindow = -1;
+  renderer->frames = 0;
+  renderer->drawnWindows = 0;
+  renderer->skippedWindows = 0;
+
+  // everything the windows share must be there before another context
+  // reads it
+  glFinish();
+  glfwMakeContextCurrent(NULL);
+  renderer->thread = std::thread(renderThread, renderer);
+}
+
+void deleteMultiWindowRenderer(MultiWindowRenderer *renderer,
+                               GLFWwindow *owner) {
+  {
+    std::lock_guard<std::mutex> lock(renderer->mutex);
+    renderer->quit = true;
+  }
+  renderer->frameSubmitted.notify_one();
+  renderer->thread.join();
+
+  glfwMakeContextCurrent(owner);
+}
+
+void submitMultiWindowFrame(MultiWindowRenderer *renderer) {
+  ViewportFrame frames[maxViewportWindows];
+  for (auto i = 0; i < renderer->windowCount; i++) {
+    auto viewport = &renderer->windows[i];
+    auto &frame = frames[i];
+    glfwGetFramebufferSize(viewport->window, &frame.width, &frame.height);
+    frame.skipped =
+        !glfwGetWindowAttrib(viewport->window, GLFW_VISIBLE) ||
+        glfwGetWindowAttrib(viewport->window, GLFW_ICONIFIED) ||
+        frame.width <= 0 || frame.height <= 0;
+    if (frame.skipped)
+      continue;
+
+    setCameraAspectRatio(&viewport->camera, frame.width, frame.height);
+    updateCamera(&viewport->camera);
+    frame.view = viewport->camera.view;
+    frame.projection = viewport->camera.projection;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(renderer->mutex);
+    renderer->frameTaken.wait(lock,
+                              [renderer] { return !renderer->hasSubmitted; });
+    for (auto i = 0; i < renderer->windowCount; i++)
+      renderer->submitted[i] = frames[i];
+    renderer->hasSubmitted = true;
+  }
+  renderer->frameSubmitted.notify_one();
+}
+
+void processMultiWindowInput(MultiWindowRenderer *renderer,
+                             float timeSinceLastFrame) {
+  for (auto i = 0; i < renderer->windowCount; i++) {
+    auto viewport = &renderer->windows[i];
+    auto window = viewport->window;
+    if (!glfwGetWindowAttrib(window, GLFW_FOCUSED)) {
+      // the next drag starts from wherever the cursor is then
+      viewport->camera.hasCursor = false;
+      continue;
+    }
+
+    auto cameraSpeed = timeSinceLastFrame * 2.5f;
+    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS)
+      moveCamera(&viewport->camera, cameraSpeed, Forward);
+    if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS)
+      moveCamera(&viewport->camera, cameraSpeed, Backwards);
+    if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS)
+      moveCamera(&viewport->camera, cameraSpeed, Right);
+    if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS)
+      moveCamera(&viewport->camera, cameraSpeed, Left);
+
+    if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT) == GLFW_PRESS) {
+      double x, y;
+      glfwGetCursorPos(window, &x, &y);
+      cameraLookAround(&viewport->camera, x, y);
+    } else {
+      viewport->camera.hasCursor = false;
+    }
+  }
+}
+
+void printMultiWindowStats(MultiWindowRenderer *renderer) {
+  int frames = renderer->frames.exchange(0);
+  int drawn = renderer->drawnWindows.exchange(0);
+  int skipped = renderer->skippedWindows.exchange(0);
+
+  printf("windows | %d frames, %.1f drawn and %.1f skipped per frame\n",
+         frames, frames > 0 ? (float)drawn / frames : 0.0f,
+         frames > 0 ? (float)skipped / frames : 0.0f);
+}
+
+void runMultiWindowViewer(GLFWwindow *window, int windowCount) {
+  if (windowCount > maxViewportWindows)
+    windowCount = maxViewportWindows;
+
+  BenchmarkScene scene;
+  createBenchmarkScene(&scene, 24, 300);
+
+  // the main window is the first viewport, the others share its objects
+  GLFWwindow *windows[maxViewportWindows];
+  windows[0] = window;
+  glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+  // it would call GL on the main thread, the size is picked up every frame
+  glfwSetFramebufferSizeCallback(window, NULL);
+  for (auto i = 1; i < windowCount; i++) {
+    char title[32];
+    snprintf(title, sizeof(title), "OpenGL Fun! %d", i + 1);
+    windows[i] = createSharedWindow(640, 480, title, window);
+    if (windows[i] == NULL) {
+      fprintf(stderr, "unable to create window %d\n", i + 1);
+      windowCount = i;
+      break;
+    }
+  }
+
+  MultiWindowRenderer renderer;
+  createMultiWindowRenderer(&renderer, &scene, windows, windowCount, true);
+
+  auto lastFrameTime = glfwGetTime();
+  auto lastReportTime = lastFrameTime;
+  auto running = true;
+  while (running) {
+    glfwPollEvents();
+    auto currentFrameTime = glfwGetTime();
+    auto timeSinceLastFrame = (float)(currentFrameTime - lastFrameTime);
+    lastFrameTime = currentFrameTime;
+
+    for (auto i = 0; i < windowCount; i++) {
+      if (glfwWindowShouldClose(windows[i]) ||
+          glfwGetKey(windows[i], GLFW_KEY_ESCAPE) == GLFW_PRESS)
+        running = false;
+    }
+
+    processMultiWindowInput(&renderer, timeSinceLastFrame);
+    submitMultiWindowFrame(&renderer);
+
+    if (currentFrameTime - lastReportTime > 1.0) {
+      printMultiWindowStats(&renderer);
+      lastReportTime = currentFrameTime;
+    }
+  }
+
+  deleteMultiWindowRenderer(&renderer, window);
+  for (auto i = 1; i < windowCount; i++)
+    glfwDestroyWindow(windows[i]);
+  deleteBenchmarkScene(&scene);
+}
+
+void runMultiWindowBenchmark(GLFWwindow *window) {
+  const int measuredFrames = 300;
+  const int windowCounts[] = {1, 2, 4, 8};
+
+  BenchmarkScene scene;
+  createBenchmarkScene(&scene, 24, 300);
+
+  printf("multi window: 320x240 windows, %d cubes, no vsync, CPU time of "
+         "the whole process\n",
+         scene.cubeCount);
+
+  for (auto windowCount : windowCounts) {
+    // the hidden benchmark window only owns the shared objects
+    GLFWwindow *windows[maxViewportWindows];
+    auto created = 0;
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+    for (; created < windowCount; created++) {
+      windows[created] = createSharedWindow(320, 240, "benchmark", window);
+      if (windows[created] == NULL)
+        break;
+    }
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    if (created < windowCount) {
+      fprintf(stderr, "unable to create %d windows\n", windowCount);
+      for (auto i = 0; i < created; i++)
+        glfwDestroyWindow(windows[i]);
+      break;
+    }
+
+    // all of them, then with half hidden which must cost nothing
+    for (auto hidden = 0; hidden <= windowCount / 2;
+         hidden += windowCount / 2 > 0 ? windowCount / 2 : 1) {
+      for (auto i = 0; i < windowCount; i++) {
+        if (i < hidden)
+          glfwHideWindow(windows[i]);
+        else
+          glfwShowWindow(windows[i]);
+      }
+
+      MultiWindowRenderer renderer;
+      createMultiWindowRenderer(&renderer, &scene, windows, windowCount,
+                                false);
+
+      // warm up, every context builds its vertex array on its first frame
+      for (auto frame = 0; frame < 10; frame++) {
+        glfwPollEvents();
+        submitMultiWindowFrame(&renderer);
+      }
+
+      auto start = glfwGetTime();
+      auto cpuStart = clock();
+      for (auto frame = 0; frame < measuredFrames; frame++) {
+        glfwPollEvents();
+        for (auto i = 0; i < windowCount; i++) {
+          auto &camera = renderer.windows[i].camera;
+          setCameraPose(&camera, camera.position, camera.yaw + 0.2f,
+                        camera.pitch);
+        }
+        submitMultiWindowFrame(&renderer);
+      }
+      // joining waits for the last frame
+      deleteMultiWindowRenderer(&renderer, window);
+      auto seconds = glfwGetTime() - start;
+      auto cpuSeconds = (double)(clock() - cpuStart) / CLOCKS_PER_SEC;
+
+      auto drawn = windowCount - hidden;
+      printf("  %d windows (%d hidden): %.3f ms per frame, CPU %.3f ms per "
+             "frame, %.3f ms per drawn window\n",
+             windowCount, hidden, seconds * 1000.0 / measuredFrames,
+             cpuSeconds * 1000.0 / measuredFrames,
+             drawn > 0 ? cpuSeconds * 1000.0 / measuredFrames / drawn : 0.0);
+    }
+
+    for (auto i = 0; i < windowCount; i++)
+      glfwDestroyWindow(windows[i]);
+  }
+
+  deleteBenchmarkScene(&scene);
+}
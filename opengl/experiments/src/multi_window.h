@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "benchmark_scene.h"
+#include "camera.h"
+#include "meshes.h"
+
+const int maxViewportWindows = 8;
+
+struct ViewportWindow {
+  GLFWwindow *window;
+  Camera camera;
+  // vertex arrays are never shared, each context gets its own the first
+  // time the render thread draws into it
+  Mesh cube;
+  bool contextReady;
+};
+
+// What the render thread needs from a window, snapshotted by the main
+// thread so the two never touch the same camera
+struct ViewportFrame {
+  glm::mat4 view;
+  glm::mat4 projection;
+  int width;
+  int height;
+  // hidden, minimized or zero sized, neither drawn nor swapped
+  bool skipped;
+};
+
+// Draws a shared scene into several windows from one render thread. Every
+// context shares objects with the one that created the scene, so buffers,
+// textures and programs exist once and only vertex arrays are per window
+struct MultiWindowRenderer {
+  BenchmarkScene *scene;
+  ViewportWindow windows[maxViewportWindows];
+  int windowCount;
+  bool vsync;
+
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable frameSubmitted;
+  std::condition_variable frameTaken;
+  ViewportFrame submitted[maxViewportWindows];
+  bool hasSubmitted;
+  bool quit;
+
+  // render thread only
+  int pacingWindow;
+
+  // since the last report
+  std::atomic<int> frames;
+  std::atomic<int> drawnWindows;
+  std::atomic<int> skippedWindows;
+};
+
+// The windows must share objects with the context current on the calling
+// thread, which created the scene. That context is released, all of them
+// belong to the render thread until deleteMultiWindowRenderer
+void createMultiWindowRenderer(MultiWindowRenderer *renderer,
+                               BenchmarkScene *scene, GLFWwindow **windows,
+                               int windowCount, bool vsync);
+// Stops the render thread and makes `owner` current again on the calling
+// thread, the windows are left to the caller
+void deleteMultiWindowRenderer(MultiWindowRenderer *renderer,
+                               GLFWwindow *owner);
+
+// Snapshots the cameras and window sizes for the render thread, main thread
+// only. The render thread draws a frame behind, this waits only when it has
+// not picked up the previous one yet
+void submitMultiWindowFrame(MultiWindowRenderer *renderer);
+
+// Arrow keys move and a right button drag looks around in the focused
+// window, main thread only
+void processMultiWindowInput(MultiWindowRenderer *renderer,
+                             float timeSinceLastFrame);
+
+void printMultiWindowStats(MultiWindowRenderer *renderer);
+
+// Opens `windowCount` windows, `window` included, each with its own camera
+// on the cube field
+void runMultiWindowViewer(GLFWwindow *window, int windowCount);
+
+// CPU cost per frame for 1 to 8 windows, and with half of them hidden
+void runMultiWindowBenchmark(GLFWwindow *window);
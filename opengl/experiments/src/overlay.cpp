@@ -0,0 +1,436 @@
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <initializer_list>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#define NK_IMPLEMENTATION
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+#define NK_INCLUDE_FONT_BAKING
+#define NK_INCLUDE_DEFAULT_FONT
+#include <nuklear.h>
+
+#include "gpu_memory.h"
+#include "overlay.h"
+#include "shaders.h"
+
+// Attribute locations, see shaders/overlay_vertex.glsl
+const int rectangleLocation = 0;
+const int texCoordRectangleLocation = 1;
+const int colorLocation = 2;
+
+static bool bakeFont(Overlay *overlay, const char *fontPath,
+                     float pixelHeight) {
+  struct nk_font_atlas atlas;
+  nk_font_atlas_init_default(&atlas);
+  nk_font_atlas_begin(&atlas);
+
+  static const nk_rune asciiRange[] = {0x20, 0x7e, 0};
+  auto config = nk_font_config(pixelHeight);
+  config.range = asciiRange;
+  // crisp pixel fonts, this is for debug text at a fixed size
+  config.oversample_h = 1;
+  config.oversample_v = 1;
+  config.pixel_snap = 1;
+
+  auto font = fontPath != NULL ? nk_font_atlas_add_from_file(
+                                     &atlas, fontPath, pixelHeight, &config)
+                               : nk_font_atlas_add_default(
+                                     &atlas, pixelHeight, &config);
+  if (font == NULL) {
+    fprintf(stderr, "unable to load the font: %s\n", fontPath);
+    nk_font_atlas_clear(&atlas);
+    return false;
+  }
+
+  int width, height;
+  auto image = nk_font_atlas_bake(&atlas, &width, &height,
+                                  NK_FONT_ATLAS_ALPHA8);
+
+  overlay->fontTexture = createGpuTexture(GpuMemoryTextures, GL_TEXTURE_2D,
+                                          1, GL_R8, width, height, 1);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RED,
+                  GL_UNSIGNED_BYTE, image);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  // white with the coverage in alpha, so sprites and text share a shader
+  int swizzle[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
+  glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+
+  struct nk_draw_null_texture white;
+  nk_font_atlas_end(&atlas, nk_handle_id((int)overlay->fontTexture), &white);
+  overlay->whiteU = white.uv.x;
+  overlay->whiteV = white.uv.y;
+  overlay->lineHeight = font->info.height;
+
+  for (auto code = 0; code < 128; code++) {
+    auto wanted = code >= 0x20 && code <= 0x7e ? code : '?';
+    auto found = nk_font_find_glyph(font, wanted);
+    auto glyph = &overlay->glyphs[code];
+
+    // blank glyphs are not baked and come back as the fallback
+    if (found->codepoint != (nk_rune)wanted && wanted == ' ') {
+      *glyph = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                found->xadvance};
+      continue;
+    }
+    *glyph = {found->x0, found->y0, found->x1, found->y1, found->u0,
+              found->v0, found->u1, found->v1, found->xadvance};
+  }
+
+  nk_font_atlas_clear(&atlas);
+  return true;
+}
+
+bool createOverlay(Overlay *overlay, const char *fontPath, float pixelHeight) {
+  if (!bakeFont(overlay, fontPath, pixelHeight))
+    return false;
+
+  overlay->program = createShaderProgram("../shaders/overlay_vertex.glsl",
+                                         "../shaders/overlay_fragment.glsl");
+  glUseProgram(overlay->program);
+  glUniform1i(glGetUniformLocation(overlay->program, "overlayTexture"), 0);
+
+  // written by the CPU every frame and never remapped
+  auto frameBytes = overlayMaxQuadsPerFrame * sizeof(OverlayQuad);
+  auto flags =
+      GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  overlay->quadBuffer =
+      createGpuBufferStorage(GpuMemoryStaging, GL_ARRAY_BUFFER,
+                             frameBytes * overlayFramesInFlight, NULL, flags);
+  overlay->mappedQuads = (OverlayQuad *)glMapBufferRange(
+      GL_ARRAY_BUFFER, 0, frameBytes * overlayFramesInFlight, flags);
+
+  // one instance per quad, the corners come from gl_VertexID
+  glGenVertexArrays(1, &overlay->vertexArray);
+  glBindVertexArray(overlay->vertexArray);
+  glVertexAttribPointer(rectangleLocation, 4, GL_FLOAT, GL_FALSE,
+                        sizeof(OverlayQuad),
+                        (void *)offsetof(OverlayQuad, x0));
+  glVertexAttribPointer(texCoordRectangleLocation, 4, GL_FLOAT, GL_FALSE,
+                        sizeof(OverlayQuad),
+                        (void *)offsetof(OverlayQuad, u0));
+  glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+                        sizeof(OverlayQuad),
+                        (void *)offsetof(OverlayQuad, color));
+  for (auto location :
+       {rectangleLocation, texCoordRectangleLocation, colorLocation}) {
+    glEnableVertexAttribArray(location);
+    glVertexAttribDivisor(location, 1);
+  }
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  for (auto i = 0; i < overlayFramesInFlight; i++)
+    overlay->fences[i] = NULL;
+  overlay->ringFrame = 0;
+  overlay->quads = NULL;
+  overlay->quadCount = 0;
+  overlay->batchCount = 0;
+  overlay->droppedQuads = 0;
+  createGpuTimer(&overlay->timer);
+
+  return true;
+}
+
+void deleteOverlay(Overlay *overlay) {
+  for (auto i = 0; i < overlayFramesInFlight; i++) {
+    if (overlay->fences[i] != NULL)
+      glDeleteSync((GLsync)overlay->fences[i]);
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, overlay->quadBuffer);
+  glUnmapBuffer(GL_ARRAY_BUFFER);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  deleteGpuBuffers(1, &overlay->quadBuffer);
+  glDeleteVertexArrays(1, &overlay->vertexArray);
+  deleteGpuProgram(overlay->program);
+  deleteGpuTextures(1, &overlay->fontTexture);
+  deleteGpuTimer(&overlay->timer);
+}
+
+void beginOverlay(Overlay *overlay, int width, int height) {
+  auto fence = (GLsync)overlay->fences[overlay->ringFrame];
+  if (fence != NULL) {
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    glDeleteSync(fence);
+    overlay->fences[overlay->ringFrame] = NULL;
+  }
+
+  overlay->width = width;
+  overlay->height = height;
+  overlay->quads =
+      overlay->mappedQuads + overlay->ringFrame * overlayMaxQuadsPerFrame;
+  overlay->quadCount = 0;
+  overlay->batchCount = 0;
+  overlay->clips[0] = {0.0f, 0.0f, (float)width, (float)height};
+  overlay->clipDepth = 1;
+}
+
+void endOverlay(Overlay *overlay) {
+  if (overlay->batchCount > 0) {
+    beginGpuTimer(&overlay->timer);
+    auto depthTest = glIsEnabled(GL_DEPTH_TEST);
+    auto cullFace = glIsEnabled(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glUseProgram(overlay->program);
+    glUniform2f(glGetUniformLocation(overlay->program, "screenSize"),
+                (float)overlay->width, (float)overlay->height);
+    glBindVertexArray(overlay->vertexArray);
+    glActiveTexture(GL_TEXTURE0);
+
+    auto ringBase = overlay->ringFrame * overlayMaxQuadsPerFrame;
+    for (auto i = 0; i < overlay->batchCount; i++) {
+      auto &batch = overlay->batches[i];
+      glBindTexture(GL_TEXTURE_2D, batch.texture);
+      glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4,
+                                        batch.quadCount,
+                                        ringBase + batch.firstQuad);
+    }
+
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+    if (depthTest)
+      glEnable(GL_DEPTH_TEST);
+    if (cullFace)
+      glEnable(GL_CULL_FACE);
+    endGpuTimer(&overlay->timer);
+  }
+
+  overlay->fences[overlay->ringFrame] =
+      glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  overlay->ringFrame = (overlay->ringFrame + 1) % overlayFramesInFlight;
+  overlay->quads = NULL;
+}
+
+void pushOverlayClip(Overlay *overlay, float x0, float y0, float x1,
+                     float y1) {
+  if (overlay->clipDepth == overlayMaxClipDepth) {
+    fprintf(stderr, "overlay clips nested too deep\n");
+    return;
+  }
+
+  auto &outer = overlay->clips[overlay->clipDepth - 1];
+  overlay->clips[overlay->clipDepth++] = {
+      x0 > outer.x0 ? x0 : outer.x0, y0 > outer.y0 ? y0 : outer.y0,
+      x1 < outer.x1 ? x1 : outer.x1, y1 < outer.y1 ? y1 : outer.y1};
+}
+
+void popOverlayClip(Overlay *overlay) {
+  if (overlay->clipDepth > 1)
+    overlay->clipDepth--;
+}
+
+// Extends the last batch or starts one, false when there is no room
+static bool useTexture(Overlay *overlay, unsigned int texture) {
+  if (overlay->batchCount > 0 &&
+      overlay->batches[overlay->batchCount - 1].texture == texture)
+    return true;
+  if (overlay->batchCount == overlayMaxBatches)
+    return false;
+
+  overlay->batches[overlay->batchCount++] = {texture, overlay->quadCount, 0};
+  return true;
+}
+
+// False when the quad is entirely outside, trims it and its texture
+// coordinates when only partly
+static inline bool clipQuad(const OverlayClip &clip, OverlayQuad *quad) {
+  if (quad->x1 <= clip.x0 || quad->x0 >= clip.x1 || quad->y1 <= clip.y0 ||
+      quad->y0 >= clip.y1)
+    return false;
+  if (quad->x0 >= clip.x0 && quad->x1 <= clip.x1 && quad->y0 >= clip.y0 &&
+      quad->y1 <= clip.y1)
+    return true;
+
+  auto uScale = (quad->u1 - quad->u0) / (quad->x1 - quad->x0);
+  auto vScale = (quad->v1 - quad->v0) / (quad->y1 - quad->y0);
+  if (quad->x0 < clip.x0) {
+    quad->u0 += (clip.x0 - quad->x0) * uScale;
+    quad->x0 = clip.x0;
+  }
+  if (quad->x1 > clip.x1) {
+    quad->u1 -= (quad->x1 - clip.x1) * uScale;
+    quad->x1 = clip.x1;
+  }
+  if (quad->y0 < clip.y0) {
+    quad->v0 += (clip.y0 - quad->y0) * vScale;
+    quad->y0 = clip.y0;
+  }
+  if (quad->y1 > clip.y1) {
+    quad->v1 -= (quad->y1 - clip.y1) * vScale;
+    quad->y1 = clip.y1;
+  }
+  return true;
+}
+
+static void addQuad(Overlay *overlay, unsigned int texture,
+                    OverlayQuad quad) {
+  if (!clipQuad(overlay->clips[overlay->clipDepth - 1], &quad))
+    return;
+  if (overlay->quadCount == overlayMaxQuadsPerFrame ||
+      !useTexture(overlay, texture)) {
+    overlay->droppedQuads++;
+    return;
+  }
+
+  overlay->quads[overlay->quadCount++] = quad;
+  overlay->batches[overlay->batchCount - 1].quadCount++;
+}
+
+void overlayRect(Overlay *overlay, float x0, float y0, float x1, float y1,
+                 uint32_t color) {
+  auto u = overlay->whiteU;
+  auto v = overlay->whiteV;
+  addQuad(overlay, overlay->fontTexture,
+          {x0, y0, x1, y1, u, v, u, v, color});
+}
+
+void overlaySprite(Overlay *overlay, unsigned int texture, float x0, float y0,
+                   float x1, float y1, float u0, float v0, float u1, float v1,
+                   uint32_t color) {
+  addQuad(overlay, texture, {x0, y0, x1, y1, u0, v0, u1, v1, color});
+}
+
+float overlayText(Overlay *overlay, float x, float y, uint32_t color,
+                  const char *text) {
+  if (!useTexture(overlay, overlay->fontTexture))
+    return x;
+
+  // the hot loop, writes straight into the mapped ring
+  auto clip = overlay->clips[overlay->clipDepth - 1];
+  auto out = overlay->quads + overlay->quadCount;
+  auto end = overlay->quads + overlayMaxQuadsPerFrame;
+  auto penX = x;
+  for (auto character = text; *character != '\0'; character++) {
+    auto code = (unsigned char)*character;
+    if (code == '\n') {
+      penX = x;
+      y += overlay->lineHeight;
+      continue;
+    }
+
+    auto &glyph = overlay->glyphs[code < 128 ? code : '?'];
+    OverlayQuad quad = {penX + glyph.x0, y + glyph.y0,  penX + glyph.x1,
+                        y + glyph.y1,    glyph.u0,      glyph.v0,
+                        glyph.u1,        glyph.v1,      color};
+    penX += glyph.advance;
+
+    if (quad.x0 == quad.x1 || !clipQuad(clip, &quad))
+      continue;
+    if (out == end) {
+      overlay->droppedQuads++;
+      continue;
+    }
+    *out++ = quad;
+  }
+
+  auto added = (int)(out - (overlay->quads + overlay->quadCount));
+  overlay->quadCount += added;
+  overlay->batches[overlay->batchCount - 1].quadCount += added;
+  return penX;
+}
+
+float overlayTextf(Overlay *overlay, float x, float y, uint32_t color,
+                   const char *format, ...) {
+  char text[1024];
+  va_list arguments;
+  va_start(arguments, format);
+  vsnprintf(text, sizeof(text), format, arguments);
+  va_end(arguments);
+
+  return overlayText(overlay, x, y, color, text);
+}
+
+void overlayGraph(Overlay *overlay, float x, float y, float width,
+                  float height, const float *values, int valueCount,
+                  float maximum, uint32_t color) {
+  if (valueCount <= 0 || maximum <= 0.0f)
+    return;
+
+  auto barWidth = width / valueCount;
+  for (auto i = 0; i < valueCount; i++) {
+    auto fraction = values[i] / maximum;
+    fraction = fraction < 0.0f ? 0.0f : fraction > 1.0f ? 1.0f : fraction;
+    auto barX = x + i * barWidth;
+    overlayRect(overlay, barX, y + height * (1.0f - fraction),
+                barX + barWidth, y + height, color);
+  }
+}
+
+void runOverlayBenchmark(GLFWwindow *window) {
+  const int glyphsPerFrame = 100000;
+  const int charactersPerLine = 50;
+  const int warmupFrames = 10;
+  const int measuredFrames = 200;
+
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+  glViewport(0, 0, width, height);
+
+  Overlay overlay;
+  if (!createOverlay(&overlay, NULL, 13.0f))
+    return;
+
+  // printable characters only, so every one of them becomes a quad
+  char line[charactersPerLine + 1];
+  for (auto i = 0; i < charactersPerLine; i++)
+    line[i] = (char)('!' + i % ('~' - '!' + 1));
+  line[charactersPerLine] = '\0';
+  auto lineCount = glyphsPerFrame / charactersPerLine;
+
+  printf("overlay: %dx%d, %d glyphs per frame, all on screen\n", width,
+         height, glyphsPerFrame);
+
+  for (auto clipped : {false, true}) {
+    auto buildSeconds = 0.0;
+    auto quads = 0;
+    for (auto frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+      if (frame == warmupFrames) {
+        buildSeconds = 0.0;
+        resetGpuTimerAverage(&overlay.timer);
+      }
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+      // only the building, the fence wait and the draw are GPU time
+      beginOverlay(&overlay, width, height);
+      auto start = glfwGetTime();
+      if (clipped)
+        pushOverlayClip(&overlay, width * 0.1f, height * 0.1f, width * 0.9f,
+                        height * 0.9f);
+      for (auto i = 0; i < lineCount; i++) {
+        // overlapping lines, so none falls off the screen
+        auto y = (float)((i * 13 + frame) % (height - 13));
+        auto x = (float)((i * 37) % (width - charactersPerLine * 8));
+        overlayText(&overlay, x, y, overlayColor(255, 255, 255), line);
+      }
+      if (clipped)
+        popOverlayClip(&overlay);
+      buildSeconds += glfwGetTime() - start;
+      quads = overlay.quadCount;
+      endOverlay(&overlay);
+
+      glfwSwapBuffers(window);
+    }
+
+    printf("  %s: build %.3f ms per frame, GPU %.3f ms, %d quads in %d draw\n",
+           clipped ? "clipped to 80%" : "unclipped     ",
+           buildSeconds * 1000.0 / measuredFrames,
+           gpuTimerAverageMilliseconds(overlay.timer), quads,
+           overlay.batchCount);
+  }
+
+  deleteOverlay(&overlay);
+}
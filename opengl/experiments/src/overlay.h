@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <GLFW/glfw3.h>
+
+#include "gpu_timer.h"
+
+// Frames the quad ring holds, the CPU writes one while the GPU reads the
+// others
+const int overlayFramesInFlight = 3;
+const int overlayMaxQuadsPerFrame = 1 << 17;
+const int overlayMaxClipDepth = 16;
+const int overlayMaxBatches = 64;
+
+// Same layout as the attributes of shaders/overlay_vertex.glsl, one per quad
+struct OverlayQuad {
+  // pixels from the top left, min and max corners
+  float x0, y0, x1, y1;
+  float u0, v0, u1, v1;
+  // RGBA8, red in the low byte
+  uint32_t color;
+};
+
+struct OverlayGlyph {
+  // offsets from the pen, the top of the line is y 0
+  float x0, y0, x1, y1;
+  float u0, v0, u1, v1;
+  float advance;
+};
+
+// A run of quads sharing a texture, drawn with one call
+struct OverlayBatch {
+  unsigned int texture;
+  int firstQuad;
+  int quadCount;
+};
+
+struct OverlayClip {
+  float x0, y0, x1, y1;
+};
+
+// Immediate mode 2D quads for HUDs and debug views. Everything between
+// beginOverlay and endOverlay is written straight into a persistently
+// mapped ring and drawn with one call per texture run, the font atlas also
+// holds a white texel so text, rectangles and graphs are all one run
+struct Overlay {
+  unsigned int program;
+  unsigned int vertexArray;
+  unsigned int quadBuffer;
+  OverlayQuad *mappedQuads;
+  // GLsync, kept opaque so this header does not need glad
+  void *fences[overlayFramesInFlight];
+  int ringFrame;
+
+  unsigned int fontTexture;
+  // printable ASCII, anything else draws '?'
+  OverlayGlyph glyphs[128];
+  float lineHeight;
+  float whiteU, whiteV;
+
+  // the frame being built
+  int width;
+  int height;
+  OverlayQuad *quads;
+  int quadCount;
+  int droppedQuads;
+  OverlayBatch batches[overlayMaxBatches];
+  int batchCount;
+  OverlayClip clips[overlayMaxClipDepth];
+  int clipDepth;
+
+  GpuTimer timer;
+};
+
+constexpr uint32_t overlayColor(int r, int g, int b, int a = 255) {
+  return (uint32_t)r | (uint32_t)g << 8 | (uint32_t)b << 16 |
+         (uint32_t)a << 24;
+}
+
+// Bakes the glyph atlas from a TTF file, or from the ProggyClean font
+// embedded in nuklear when `fontPath` is NULL
+bool createOverlay(Overlay *overlay, const char *fontPath, float pixelHeight);
+void deleteOverlay(Overlay *overlay);
+
+// Waits if the GPU still reads the part of the ring this frame reuses
+void beginOverlay(Overlay *overlay, int width, int height);
+// Draws into the bound framebuffer, blended and without depth
+void endOverlay(Overlay *overlay);
+
+// Everything is clipped against the innermost rectangle, on the CPU so clips
+// never split a batch
+void pushOverlayClip(Overlay *overlay, float x0, float y0, float x1,
+                     float y1);
+void popOverlayClip(Overlay *overlay);
+
+void overlayRect(Overlay *overlay, float x0, float y0, float x1, float y1,
+                 uint32_t color);
+void overlaySprite(Overlay *overlay, unsigned int texture, float x0, float y0,
+                   float x1, float y1, float u0, float v0, float u1, float v1,
+                   uint32_t color);
+// `\n` starts a new line, returns the x where the text ended
+float overlayText(Overlay *overlay, float x, float y, uint32_t color,
+                  const char *text);
+float overlayTextf(Overlay *overlay, float x, float y, uint32_t color,
+                   const char *format, ...);
+// Bars of `values`, oldest first, scaled so `maximum` fills the height
+void overlayGraph(Overlay *overlay, float x, float y, float width,
+                  float height, const float *values, int valueCount,
+                  float maximum, uint32_t color);
+
+// CPU time to build frames of 100k glyphs and the GPU time to draw them
+void runOverlayBenchmark(GLFWwindow *window);
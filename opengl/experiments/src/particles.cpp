@@ -0,0 +1,599 @@
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "camera.h"
+#include "gpu_memory.h"
+#include "particles.h"
+#include "shaders.h"
+
+// Shader storage binding points, see shaders/particle_*
+const int particlesBinding = 7;
+const int deadListBinding = 8;
+const int aliveListsBinding = 9;
+const int countersBinding = 10;
+const int sortEntriesBinding = 11;
+const int cpuParticlesBinding = 12;
+
+// must match shaders/particle_sort.comp
+const int sortBlockSize = 1024;
+const int sortGlobalPass = 0;
+const int sortBlockPass = 1;
+const int sortMergePass = 2;
+
+const float particleSize = 0.03f;
+const auto particleGravity = glm::vec3(0.0f, -9.8f, 0.0f);
+
+// Same layout as `Counters` in shaders/particle_counters.comp
+struct ParticleCounters {
+  int32_t deadCount;
+  uint32_t aliveCounts[2];
+  uint32_t emitted;
+
+  uint32_t dispatch[3];
+  uint32_t padding;
+
+  // DrawArraysIndirectCommand
+  uint32_t vertexCount;
+  uint32_t instanceCount;
+  uint32_t firstVertex;
+  uint32_t baseInstance;
+};
+
+static unsigned int createStorageBuffer(size_t size, const void *data) {
+  auto buffer = createGpuBuffer(GpuMemoryStorage, GL_SHADER_STORAGE_BUFFER,
+                                size, data, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  return buffer;
+}
+
+static void bindParticleBuffers(const ParticleSystem &particles) {
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, particlesBinding,
+                   particles.particleBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, deadListBinding,
+                   particles.deadListBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, aliveListsBinding,
+                   particles.aliveListBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, countersBinding,
+                   particles.counterBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, sortEntriesBinding,
+                   particles.sortBuffer);
+}
+
+static void emitParticles(ParticleSystem *particles, int count,
+                          bool prewarm) {
+  auto program = particles->emitProgram;
+  glUseProgram(program);
+  glUniform1ui(glGetUniformLocation(program, "emitCount"), count);
+  glUniform1ui(glGetUniformLocation(program, "current"), particles->current);
+  glUniform1ui(glGetUniformLocation(program, "capacity"),
+               particles->capacity);
+  glUniform1ui(glGetUniformLocation(program, "seed"), particles->frame);
+  glUniform3fv(glGetUniformLocation(program, "emitterPosition"), 1,
+               glm::value_ptr(particles->emitterPosition));
+  glUniform1f(glGetUniformLocation(program, "lifetime"), particles->lifetime);
+  glUniform1f(glGetUniformLocation(program, "speed"), particles->speed);
+  glUniform1i(glGetUniformLocation(program, "prewarm"), prewarm);
+  glDispatchCompute((count + 255) / 256, 1, 1);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void createParticleSystem(ParticleSystem *particles, int capacity,
+                          glm::vec3 emitterPosition, float lifetime) {
+  particles->capacity = capacity;
+  particles->sortSize = sortBlockSize;
+  while (particles->sortSize < capacity)
+    particles->sortSize *= 2;
+  particles->current = 0;
+  particles->frame = 0;
+
+  particles->emitterPosition = emitterPosition;
+  particles->lifetime = lifetime;
+  particles->speed = 6.0f;
+  particles->emitRate = capacity / lifetime;
+  particles->emitRemainder = 0.0f;
+  particles->floorHeight = emitterPosition.y;
+  particles->sorted = true;
+
+  // every particle starts free
+  std::vector<uint32_t> deadList(capacity);
+  for (auto i = 0; i < capacity; i++)
+    deadList[i] = capacity - 1 - i;
+  ParticleCounters counters = {};
+  counters.deadCount = capacity;
+
+  particles->particleBuffer =
+      createStorageBuffer(capacity * sizeof(Particle), NULL);
+  particles->deadListBuffer =
+      createStorageBuffer(capacity * sizeof(uint32_t), deadList.data());
+  particles->aliveListBuffer =
+      createStorageBuffer(2 * capacity * sizeof(uint32_t), NULL);
+  particles->counterBuffer =
+      createStorageBuffer(sizeof(ParticleCounters), &counters);
+  particles->sortBuffer =
+      createStorageBuffer(particles->sortSize * 2 * sizeof(uint32_t), NULL);
+
+  particles->emitProgram =
+      createComputeProgram("../shaders/particle_emit.comp");
+  particles->countersProgram =
+      createComputeProgram("../shaders/particle_counters.comp");
+  particles->simulateProgram =
+      createComputeProgram("../shaders/particle_simulate.comp");
+  particles->sortProgram =
+      createComputeProgram("../shaders/particle_sort.comp");
+  particles->renderProgram =
+      createShaderProgram("../shaders/particle_vertex.glsl",
+                          "../shaders/particle_fragment.glsl");
+  glGenVertexArrays(1, &particles->vertexArray);
+
+  createGpuTimer(&particles->simulateTimer);
+  createGpuTimer(&particles->sortTimer);
+  createGpuTimer(&particles->drawTimer);
+
+  bindParticleBuffers(*particles);
+  emitParticles(particles, capacity, true);
+}
+
+void deleteParticleSystem(ParticleSystem *particles) {
+  unsigned int buffers[] = {particles->particleBuffer,
+                            particles->deadListBuffer,
+                            particles->aliveListBuffer,
+                            particles->counterBuffer, particles->sortBuffer};
+  deleteGpuBuffers(5, buffers);
+
+  deleteGpuProgram(particles->emitProgram);
+  deleteGpuProgram(particles->countersProgram);
+  deleteGpuProgram(particles->simulateProgram);
+  deleteGpuProgram(particles->sortProgram);
+  deleteGpuProgram(particles->renderProgram);
+  glDeleteVertexArrays(1, &particles->vertexArray);
+
+  deleteGpuTimer(&particles->simulateTimer);
+  deleteGpuTimer(&particles->sortTimer);
+  deleteGpuTimer(&particles->drawTimer);
+}
+
+static void updateCounters(ParticleSystem *particles, int stage) {
+  auto program = particles->countersProgram;
+  glUseProgram(program);
+  glUniform1ui(glGetUniformLocation(program, "stage"), stage);
+  glUniform1ui(glGetUniformLocation(program, "current"), particles->current);
+  glDispatchCompute(1, 1, 1);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+}
+
+static void sortParticles(ParticleSystem *particles) {
+  auto program = particles->sortProgram;
+  glUseProgram(program);
+  auto passLocation = glGetUniformLocation(program, "pass");
+  auto kLocation = glGetUniformLocation(program, "k");
+  auto jLocation = glGetUniformLocation(program, "j");
+  // the simulation compacted into the list after the current one
+  glUniform1ui(glGetUniformLocation(program, "aliveCounter"),
+               1 - particles->current);
+
+  auto blocks = particles->sortSize / sortBlockSize;
+  glUniform1ui(passLocation, sortBlockPass);
+  glDispatchCompute(blocks, 1, 1);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+  for (auto k = 2 * sortBlockSize; k <= particles->sortSize; k *= 2) {
+    glUniform1ui(kLocation, k);
+    glUniform1ui(passLocation, sortGlobalPass);
+    for (auto j = k / 2; j >= sortBlockSize; j /= 2) {
+      glUniform1ui(jLocation, j);
+      glDispatchCompute(blocks, 1, 1);
+      glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    }
+
+    glUniform1ui(passLocation, sortMergePass);
+    glDispatchCompute(blocks, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+  }
+}
+
+void updateParticles(ParticleSystem *particles, float deltaTime,
+                     glm::vec3 cameraPosition) {
+  bindParticleBuffers(*particles);
+
+  beginGpuTimer(&particles->simulateTimer);
+  auto toEmit = particles->emitRate * deltaTime + particles->emitRemainder;
+  auto emitCount = (int)toEmit;
+  particles->emitRemainder = toEmit - emitCount;
+  if (emitCount > 0)
+    emitParticles(particles, emitCount, false);
+
+  // sizes the simulation to the alive count without reading it back
+  updateCounters(particles, 0);
+
+  auto program = particles->simulateProgram;
+  glUseProgram(program);
+  glUniform1ui(glGetUniformLocation(program, "current"), particles->current);
+  glUniform1ui(glGetUniformLocation(program, "capacity"),
+               particles->capacity);
+  glUniform1f(glGetUniformLocation(program, "deltaTime"), deltaTime);
+  glUniform3fv(glGetUniformLocation(program, "gravity"), 1,
+               glm::value_ptr(particleGravity));
+  glUniform1f(glGetUniformLocation(program, "floorHeight"),
+              particles->floorHeight);
+  glUniform3fv(glGetUniformLocation(program, "cameraPosition"), 1,
+               glm::value_ptr(cameraPosition));
+  glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, particles->counterBuffer);
+  glDispatchComputeIndirect(offsetof(ParticleCounters, dispatch));
+  glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+  updateCounters(particles, 1);
+  endGpuTimer(&particles->simulateTimer);
+
+  beginGpuTimer(&particles->sortTimer);
+  if (particles->sorted)
+    sortParticles(particles);
+  endGpuTimer(&particles->sortTimer);
+
+  particles->current = 1 - particles->current;
+  particles->frame++;
+}
+
+void drawParticles(ParticleSystem *particles, const glm::mat4 &view,
+                   const glm::mat4 &projection) {
+  beginGpuTimer(&particles->drawTimer);
+  auto program = particles->renderProgram;
+  glUseProgram(program);
+  glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE,
+                     glm::value_ptr(view));
+  glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1,
+                     GL_FALSE, glm::value_ptr(projection));
+  glUniform1f(glGetUniformLocation(program, "particleSize"), particleSize);
+  glUniform1i(glGetUniformLocation(program, "fromCpu"), false);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, particlesBinding,
+                   particles->particleBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, sortEntriesBinding,
+                   particles->sortBuffer);
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glDepthMask(GL_FALSE);
+
+  glBindVertexArray(particles->vertexArray);
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, particles->counterBuffer);
+  glDrawArraysIndirect(GL_TRIANGLES,
+                       (void *)offsetof(ParticleCounters, vertexCount));
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+  glDepthMask(GL_TRUE);
+  glDisable(GL_BLEND);
+  endGpuTimer(&particles->drawTimer);
+}
+
+void printParticleStats(ParticleSystem *particles) {
+  printf("particles | %d capacity, simulate %.3f ms, sort %.3f ms, draw "
+         "%.3f ms\n",
+         particles->capacity,
+         gpuTimerAverageMilliseconds(particles->simulateTimer),
+         gpuTimerAverageMilliseconds(particles->sortTimer),
+         gpuTimerAverageMilliseconds(particles->drawTimer));
+  resetGpuTimerAverage(&particles->simulateTimer);
+  resetGpuTimerAverage(&particles->sortTimer);
+  resetGpuTimerAverage(&particles->drawTimer);
+}
+
+static float randomFloat(unsigned int *state) {
+  // xorshift32
+  auto x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return (x >> 8) / 16777216.0f;
+}
+
+// same distribution as shaders/particle_emit.comp
+static void respawnCpuParticle(CpuParticleSystem *particles, int i,
+                               float life, unsigned int *state) {
+  auto angle = randomFloat(state) * 6.2831853f;
+  auto spread = sqrtf(randomFloat(state)) * 0.35f;
+  auto direction = glm::normalize(
+      glm::vec3(cosf(angle) * spread, 1.0f, sinf(angle) * spread));
+  auto velocity =
+      direction * particles->speed * (0.75f + 0.5f * randomFloat(state));
+
+  particles->positionX[i] = particles->emitterPosition.x;
+  particles->positionY[i] = particles->emitterPosition.y;
+  particles->positionZ[i] = particles->emitterPosition.z;
+  particles->velocityX[i] = velocity.x;
+  particles->velocityY[i] = velocity.y;
+  particles->velocityZ[i] = velocity.z;
+  particles->life[i] = life;
+}
+
+void createCpuParticleSystem(CpuParticleSystem *particles, int count,
+                             glm::vec3 emitterPosition, float lifetime) {
+  particles->count = count;
+  particles->workerCount = (int)std::thread::hardware_concurrency();
+  if (particles->workerCount < 1)
+    particles->workerCount = 1;
+  particles->randomState = 0x9e3779b9u;
+  particles->emitterPosition = emitterPosition;
+  particles->lifetime = lifetime;
+  particles->speed = 6.0f;
+  particles->floorHeight = emitterPosition.y;
+
+  for (auto array :
+       {&particles->positionX, &particles->positionY, &particles->positionZ,
+        &particles->velocityX, &particles->velocityY, &particles->velocityZ,
+        &particles->life})
+    array->resize(count);
+  particles->packed.resize(count);
+
+  for (auto i = 0; i < count; i++) {
+    respawnCpuParticle(particles, i,
+                       lifetime * randomFloat(&particles->randomState),
+                       &particles->randomState);
+  }
+
+  particles->uploadBuffer =
+      createGpuBuffer(GpuMemoryStaging, GL_SHADER_STORAGE_BUFFER,
+                      count * sizeof(glm::vec4), NULL, GL_STREAM_DRAW);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void deleteCpuParticleSystem(CpuParticleSystem *particles) {
+  deleteGpuBuffers(1, &particles->uploadBuffer);
+}
+
+static void updateCpuParticleRange(CpuParticleSystem *particles, int begin,
+                                   int end, float deltaTime,
+                                   unsigned int seed) {
+  auto px = particles->positionX.data();
+  auto py = particles->positionY.data();
+  auto pz = particles->positionZ.data();
+  auto vx = particles->velocityX.data();
+  auto vy = particles->velocityY.data();
+  auto vz = particles->velocityZ.data();
+  auto life = particles->life.data();
+  auto packed = (float *)particles->packed.data();
+
+  auto gravityStep = particleGravity.y * deltaTime;
+  auto drag = 1.0f - 0.2f * deltaTime;
+  auto floor = particles->floorHeight;
+  auto inverseLifetime = 1.0f / particles->lifetime;
+  auto state = seed | 1;
+
+  auto i = begin;
+#if defined(__SSE2__)
+  auto dt4 = _mm_set1_ps(deltaTime);
+  auto gravity4 = _mm_set1_ps(gravityStep);
+  auto drag4 = _mm_set1_ps(drag);
+  auto floor4 = _mm_set1_ps(floor);
+  auto bounce4 = _mm_set1_ps(-0.4f);
+  auto inverseLifetime4 = _mm_set1_ps(inverseLifetime);
+  auto zero4 = _mm_setzero_ps();
+  for (; i + 4 <= end; i += 4) {
+    auto l = _mm_sub_ps(_mm_loadu_ps(life + i), dt4);
+
+    auto x = _mm_loadu_ps(vx + i);
+    auto y = _mm_loadu_ps(vy + i);
+    auto z = _mm_loadu_ps(vz + i);
+    x = _mm_mul_ps(x, drag4);
+    y = _mm_mul_ps(_mm_add_ps(y, gravity4), drag4);
+    z = _mm_mul_ps(z, drag4);
+
+    auto positionX = _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(x, dt4));
+    auto positionY = _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(y, dt4));
+    auto positionZ = _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(z, dt4));
+
+    // below the floor: clamp it and bounce with the mask
+    auto below = _mm_cmplt_ps(positionY, floor4);
+    positionY = _mm_or_ps(_mm_and_ps(below, floor4),
+                          _mm_andnot_ps(below, positionY));
+    y = _mm_or_ps(_mm_and_ps(below, _mm_mul_ps(y, bounce4)),
+                  _mm_andnot_ps(below, y));
+
+    _mm_storeu_ps(px + i, positionX);
+    _mm_storeu_ps(py + i, positionY);
+    _mm_storeu_ps(pz + i, positionZ);
+    _mm_storeu_ps(vx + i, x);
+    _mm_storeu_ps(vy + i, y);
+    _mm_storeu_ps(vz + i, z);
+    _mm_storeu_ps(life + i, l);
+
+    // the rare dead lanes respawn in scalar code
+    auto dead = _mm_movemask_ps(_mm_cmple_ps(l, zero4));
+    if (dead != 0) {
+      for (auto lane = 0; lane < 4; lane++) {
+        if (dead & (1 << lane)) {
+          respawnCpuParticle(particles, i + lane, particles->lifetime,
+                             &state);
+        }
+      }
+      positionX = _mm_loadu_ps(px + i);
+      positionY = _mm_loadu_ps(py + i);
+      positionZ = _mm_loadu_ps(pz + i);
+      l = _mm_loadu_ps(life + i);
+    }
+
+    // structure of arrays to the uploaded array of structures
+    auto fraction = _mm_mul_ps(l, inverseLifetime4);
+    _MM_TRANSPOSE4_PS(positionX, positionY, positionZ, fraction);
+    _mm_storeu_ps(packed + 4 * i, positionX);
+    _mm_storeu_ps(packed + 4 * i + 4, positionY);
+    _mm_storeu_ps(packed + 4 * i + 8, positionZ);
+    _mm_storeu_ps(packed + 4 * i + 12, fraction);
+  }
+#endif
+
+  for (; i < end; i++) {
+    life[i] -= deltaTime;
+    if (life[i] <= 0.0f) {
+      respawnCpuParticle(particles, i, particles->lifetime, &state);
+    } else {
+      vx[i] *= drag;
+      vy[i] = (vy[i] + gravityStep) * drag;
+      vz[i] *= drag;
+      px[i] += vx[i] * deltaTime;
+      py[i] += vy[i] * deltaTime;
+      pz[i] += vz[i] * deltaTime;
+      if (py[i] < floor) {
+        py[i] = floor;
+        vy[i] *= -0.4f;
+      }
+    }
+
+    particles->packed[i] =
+        glm::vec4(px[i], py[i], pz[i], life[i] * inverseLifetime);
+  }
+}
+
+void updateCpuParticles(CpuParticleSystem *particles, float deltaTime) {
+  // ranges rounded to whole SIMD groups
+  auto perWorker = ((particles->count / particles->workerCount) + 3) & ~3;
+  auto seed = particles->randomState;
+  particles->randomState = seed * 747796405u + 2891336453u;
+
+  std::vector<std::thread> workers;
+  for (auto worker = 1; worker < particles->workerCount; worker++) {
+    auto begin = worker * perWorker;
+    auto end = begin + perWorker < particles->count ? begin + perWorker
+                                                    : particles->count;
+    if (begin >= end)
+      break;
+    workers.push_back(std::thread(updateCpuParticleRange, particles, begin,
+                                  end, deltaTime, seed + worker * 7919u));
+  }
+  auto firstEnd = perWorker < particles->count ? perWorker : particles->count;
+  updateCpuParticleRange(particles, 0, firstEnd, deltaTime, seed);
+  for (auto &worker : workers)
+    worker.join();
+}
+
+void uploadCpuParticles(CpuParticleSystem *particles) {
+  // orphaned so the upload does not wait for last frame's draw
+  resizeGpuBuffer(particles->uploadBuffer, GL_SHADER_STORAGE_BUFFER,
+                  particles->count * sizeof(glm::vec4), NULL, GL_STREAM_DRAW);
+  glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0,
+                  particles->count * sizeof(glm::vec4),
+                  particles->packed.data());
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void drawCpuParticles(const CpuParticleSystem &particles,
+                      const ParticleSystem &renderer, const glm::mat4 &view,
+                      const glm::mat4 &projection) {
+  auto renderProgram = renderer.renderProgram;
+  glUseProgram(renderProgram);
+  glUniformMatrix4fv(glGetUniformLocation(renderProgram, "view"), 1,
+                     GL_FALSE, glm::value_ptr(view));
+  glUniformMatrix4fv(glGetUniformLocation(renderProgram, "projection"), 1,
+                     GL_FALSE, glm::value_ptr(projection));
+  glUniform1f(glGetUniformLocation(renderProgram, "particleSize"),
+              particleSize);
+  glUniform1i(glGetUniformLocation(renderProgram, "fromCpu"), true);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, cpuParticlesBinding,
+                   particles.uploadBuffer);
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glDepthMask(GL_FALSE);
+  glBindVertexArray(renderer.vertexArray);
+  glDrawArraysInstanced(GL_TRIANGLES, 0, 6, particles.count);
+  glDepthMask(GL_TRUE);
+  glDisable(GL_BLEND);
+}
+
+void runParticleBenchmark(GLFWwindow *window) {
+  const int particleCounts[] = {100000, 1000000, 10000000};
+  const int warmupFrames = 10;
+  const int measuredFrames = 60;
+  const float deltaTime = 1.0f / 60.0f;
+  const auto emitterPosition = glm::vec3(0.0f, -1.0f, -8.0f);
+
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+  glViewport(0, 0, width, height);
+  auto cameraPosition = glm::vec3(0.0f, 2.0f, 4.0f);
+  auto view = glm::lookAt(cameraPosition,
+                          emitterPosition + glm::vec3(0.0f, 3.0f, 0.0f),
+                          glm::vec3(0.0f, 1.0f, 0.0f));
+  auto projection =
+      glm::perspective(glm::radians(60.0f), (float)width / (float)height,
+                       cameraNearPlane, cameraFarPlane);
+
+  printf("particles: %dx%d, ms per frame, GPU times from timer queries\n",
+         width, height);
+
+  for (auto count : particleCounts) {
+    ParticleSystem gpu;
+    createParticleSystem(&gpu, count, emitterPosition, 4.0f);
+
+    for (auto sorted : {false, true}) {
+      gpu.sorted = sorted;
+      for (auto frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+        if (frame == warmupFrames) {
+          resetGpuTimerAverage(&gpu.simulateTimer);
+          resetGpuTimerAverage(&gpu.sortTimer);
+          resetGpuTimerAverage(&gpu.drawTimer);
+        }
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        updateParticles(&gpu, deltaTime, cameraPosition);
+        drawParticles(&gpu, view, projection);
+        glfwSwapBuffers(window);
+      }
+      printf("  %8d GPU%s: simulate %.3f, sort %.3f, draw %.3f\n", count,
+             sorted ? " sorted  " : " unsorted",
+             gpuTimerAverageMilliseconds(gpu.simulateTimer),
+             gpuTimerAverageMilliseconds(gpu.sortTimer),
+             gpuTimerAverageMilliseconds(gpu.drawTimer));
+    }
+
+    CpuParticleSystem cpu;
+    createCpuParticleSystem(&cpu, count, emitterPosition, 4.0f);
+    GpuTimer drawTimer;
+    createGpuTimer(&drawTimer);
+    auto updateSeconds = 0.0;
+    auto uploadSeconds = 0.0;
+    for (auto frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+      if (frame == warmupFrames) {
+        updateSeconds = 0.0;
+        uploadSeconds = 0.0;
+        resetGpuTimerAverage(&drawTimer);
+      }
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      auto start = glfwGetTime();
+      updateCpuParticles(&cpu, deltaTime);
+      auto updated = glfwGetTime();
+      uploadCpuParticles(&cpu);
+      auto uploaded = glfwGetTime();
+      updateSeconds += updated - start;
+      uploadSeconds += uploaded - updated;
+
+      beginGpuTimer(&drawTimer);
+      drawCpuParticles(cpu, gpu, view, projection);
+      endGpuTimer(&drawTimer);
+      glfwSwapBuffers(window);
+    }
+    printf("  %8d CPU %d threads: update %.3f, upload %.3f, draw %.3f\n",
+           count, cpu.workerCount, updateSeconds * 1000.0 / measuredFrames,
+           uploadSeconds * 1000.0 / measuredFrames,
+           gpuTimerAverageMilliseconds(drawTimer));
+
+    deleteGpuTimer(&drawTimer);
+    deleteCpuParticleSystem(&cpu);
+    deleteParticleSystem(&gpu);
+  }
+}
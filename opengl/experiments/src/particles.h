@@ -0,0 +1,107 @@
+#pragma once
+
+#include <vector>
+
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "gpu_timer.h"
+
+// Same layout as `Particle` in shaders/particle_*.comp (std430)
+struct Particle {
+  // xyz position, w remaining life in seconds
+  glm::vec4 positionLife;
+  // xyz velocity, w lifetime it was emitted with
+  glm::vec4 velocityLifetime;
+};
+
+// Emits, simulates, compacts, sorts and draws entirely on the GPU. Free
+// particles are recycled through a dead list, the living ones are compacted
+// every frame into the other of two alive lists, and the counts only ever
+// reach the draw through indirect arguments
+struct ParticleSystem {
+  unsigned int particleBuffer;
+  unsigned int deadListBuffer;
+  unsigned int aliveListBuffer;
+  // counters, then the indirect dispatch and draw arguments
+  unsigned int counterBuffer;
+  unsigned int sortBuffer;
+
+  unsigned int emitProgram;
+  unsigned int countersProgram;
+  unsigned int simulateProgram;
+  unsigned int sortProgram;
+  unsigned int renderProgram;
+  // the vertices come from gl_VertexID, but core profile refuses to draw
+  // without a vertex array, even an empty one
+  unsigned int vertexArray;
+
+  int capacity;
+  // power of two the bitonic sort runs over, at least one block
+  int sortSize;
+  // alive list the next frame starts from
+  int current;
+  unsigned int frame;
+
+  glm::vec3 emitterPosition;
+  float lifetime;
+  float speed;
+  // particles per second, capacity over lifetime keeps it about full
+  float emitRate;
+  float emitRemainder;
+  float floorHeight;
+  // back to front for alpha blending, skipped it is drawn in any order
+  bool sorted;
+
+  GpuTimer simulateTimer;
+  GpuTimer sortTimer;
+  GpuTimer drawTimer;
+};
+
+// Starts full, with the remaining lives spread over the lifetime
+void createParticleSystem(ParticleSystem *particles, int capacity,
+                          glm::vec3 emitterPosition, float lifetime);
+void deleteParticleSystem(ParticleSystem *particles);
+
+void updateParticles(ParticleSystem *particles, float deltaTime,
+                     glm::vec3 cameraPosition);
+// Blended over the bound framebuffer, depth tested but not written
+void drawParticles(ParticleSystem *particles, const glm::mat4 &view,
+                   const glm::mat4 &projection);
+
+void printParticleStats(ParticleSystem *particles);
+
+// The same fountain updated on the CPU in structure of arrays with SSE,
+// split over worker threads, and uploaded every frame like GLFW's
+// examples/particles.c
+struct CpuParticleSystem {
+  std::vector<float> positionX, positionY, positionZ;
+  std::vector<float> velocityX, velocityY, velocityZ;
+  std::vector<float> life;
+  // xyz position, w remaining life fraction, what gets uploaded
+  std::vector<glm::vec4> packed;
+
+  int count;
+  int workerCount;
+  unsigned int randomState;
+
+  glm::vec3 emitterPosition;
+  float lifetime;
+  float speed;
+  float floorHeight;
+
+  unsigned int uploadBuffer;
+};
+
+void createCpuParticleSystem(CpuParticleSystem *particles, int count,
+                             glm::vec3 emitterPosition, float lifetime);
+void deleteCpuParticleSystem(CpuParticleSystem *particles);
+void updateCpuParticles(CpuParticleSystem *particles, float deltaTime);
+void uploadCpuParticles(CpuParticleSystem *particles);
+// Uses the render program and vertex array of a GPU system, unsorted
+void drawCpuParticles(const CpuParticleSystem &particles,
+                      const ParticleSystem &renderer, const glm::mat4 &view,
+                      const glm::mat4 &projection);
+
+// GPU against CPU from 100k to 10M particles
+void runParticleBenchmark(GLFWwindow *window);
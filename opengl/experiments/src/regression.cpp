@@ -0,0 +1,266 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <glad/glad.h>
+#include <stb_image.h>
+#include <stb_image_write.h>
+
+#include "image_diff.h"
+#include "regression.h"
+
+static bool parseDirection(const char *name, CameraMovementType *direction) {
+  if (strcmp(name, "forward") == 0)
+    *direction = Forward;
+  else if (strcmp(name, "backwards") == 0)
+    *direction = Backwards;
+  else if (strcmp(name, "left") == 0)
+    *direction = Left;
+  else if (strcmp(name, "right") == 0)
+    *direction = Right;
+  else
+    return false;
+
+  return true;
+}
+
+bool loadRegressionScript(const char *path, RegressionScript *script) {
+  auto file = fopen(path, "r");
+  if (file == NULL) {
+    fprintf(stderr, "unable to open %s\n", path);
+    return false;
+  }
+
+  script->frameCount = 0;
+  script->timestep = 1.0 / 60.0;
+  script->width = 800;
+  script->height = 600;
+  script->tolerance = 2;
+  script->allowedPixels = 0;
+  script->minimumPsnr = 40.0;
+  script->commands.clear();
+
+  char line[1024];
+  auto lineNumber = 0;
+  auto valid = true;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    lineNumber++;
+    auto comment = strchr(line, '#');
+    if (comment != NULL)
+      *comment = '\0';
+
+    char word[256], argument[256];
+    RegressionCommand command;
+    command.direction = Forward;
+    command.x = 0.0f;
+    command.y = 0.0f;
+    auto fields = sscanf(line, "%255s", word);
+    if (fields <= 0)
+      continue;
+
+    if (sscanf(line, " frames %d", &script->frameCount) == 1 ||
+        sscanf(line, " timestep %lf", &script->timestep) == 1 ||
+        sscanf(line, " size %d %d", &script->width, &script->height) == 2 ||
+        sscanf(line, " tolerance %d", &script->tolerance) == 1 ||
+        sscanf(line, " allowed-pixels %d", &script->allowedPixels) == 1 ||
+        sscanf(line, " minimum-psnr %lf", &script->minimumPsnr) == 1)
+      continue;
+
+    if (sscanf(line, "%d %255s", &command.frame, word) == 2) {
+      if (strcmp(word, "move") == 0 &&
+          sscanf(line, "%*d move %255s %f", argument, &command.x) == 2 &&
+          parseDirection(argument, &command.direction)) {
+        command.type = RegressionMove;
+        script->commands.push_back(command);
+        continue;
+      }
+      if (strcmp(word, "look") == 0 &&
+          sscanf(line, "%*d look %f %f", &command.x, &command.y) == 2) {
+        command.type = RegressionLook;
+        script->commands.push_back(command);
+        continue;
+      }
+      if (strcmp(word, "zoom") == 0 &&
+          sscanf(line, "%*d zoom %f", &command.x) == 1) {
+        command.type = RegressionZoom;
+        script->commands.push_back(command);
+        continue;
+      }
+      if (strcmp(word, "capture") == 0 &&
+          sscanf(line, "%*d capture %255s", argument) == 1) {
+        command.type = RegressionCapture;
+        command.name = argument;
+        script->commands.push_back(command);
+        continue;
+      }
+    }
+
+    fprintf(stderr, "%s:%d: unable to parse: %s", path, lineNumber, line);
+    valid = false;
+  }
+  fclose(file);
+
+  std::stable_sort(script->commands.begin(), script->commands.end(),
+                   [](const RegressionCommand &a, const RegressionCommand &b) {
+                     return a.frame < b.frame;
+                   });
+
+  if (script->frameCount <= 0) {
+    fprintf(stderr, "%s: frames must be set\n", path);
+    valid = false;
+  }
+
+  // channels are bytes, the diff compares the tolerance as one
+  if (script->tolerance < 0 || script->tolerance > 255) {
+    fprintf(stderr, "%s: tolerance must be between 0 and 255\n", path);
+    valid = false;
+  }
+
+  return valid;
+}
+
+bool beginRegressionRun(RegressionRun *run, const char *scriptPath,
+                        const char *goldenDirectory, bool updateGoldens) {
+  if (!loadRegressionScript(scriptPath, &run->script))
+    return false;
+
+  run->goldenDirectory = goldenDirectory;
+  run->updateGoldens = updateGoldens;
+  run->nextInput = 0;
+  run->nextCapture = 0;
+  run->checked = 0;
+  run->failures = 0;
+
+  return true;
+}
+
+void applyRegressionInput(RegressionRun *run, Camera *camera, int frame) {
+  auto &commands = run->script.commands;
+  for (; run->nextInput < commands.size() &&
+         commands[run->nextInput].frame <= frame;
+       run->nextInput++) {
+    auto &command = commands[run->nextInput];
+    switch (command.type) {
+    case RegressionMove:
+      moveCamera(camera, command.x, command.direction);
+      break;
+    case RegressionLook:
+      cameraLookAround(camera, command.x, command.y);
+      break;
+    case RegressionZoom:
+      cameraZoomOut(camera, command.x);
+      break;
+    case RegressionCapture:
+      break;
+    }
+  }
+}
+
+// GL rows go bottom to top, pngs top to bottom
+static bool writeImage(const char *path, const unsigned char *pixels,
+                       int width, int height) {
+  return stbi_write_png(path, width, height, 4,
+                        pixels + (size_t)(height - 1) * width * 4,
+                        -width * 4) != 0;
+}
+
+static void checkCapture(RegressionRun *run, const RegressionCommand &command,
+                         const std::vector<unsigned char> &pixels, int width,
+                         int height) {
+  char goldenPath[1024];
+  snprintf(goldenPath, sizeof(goldenPath), "%s/%s.png", run->goldenDirectory,
+           command.name.c_str());
+  run->checked++;
+
+  if (run->updateGoldens) {
+    if (!writeImage(goldenPath, pixels.data(), width, height)) {
+      fprintf(stderr, "unable to write %s\n", goldenPath);
+      run->failures++;
+      return;
+    }
+    printf("frame %4d %-24s written\n", command.frame, command.name.c_str());
+    return;
+  }
+
+  // loaded bottom to top like the readback
+  stbi_set_flip_vertically_on_load(true);
+  int goldenWidth, goldenHeight, channels;
+  auto golden =
+      stbi_load(goldenPath, &goldenWidth, &goldenHeight, &channels, 4);
+
+  auto passed = false;
+  if (golden == NULL) {
+    printf("frame %4d %-24s FAIL missing golden %s\n", command.frame,
+           command.name.c_str(), goldenPath);
+  } else if (goldenWidth != width || goldenHeight != height) {
+    printf("frame %4d %-24s FAIL golden is %dx%d, frame is %dx%d\n",
+           command.frame, command.name.c_str(), goldenWidth, goldenHeight,
+           width, height);
+  } else {
+    auto diff = compareImages(pixels.data(), golden, width, height,
+                              run->script.tolerance);
+    passed = diff.differingPixels <= run->script.allowedPixels &&
+             diff.psnr >= run->script.minimumPsnr;
+    printf("frame %4d %-24s %s %d pixels over %d, max difference %d, "
+           "psnr %.2f dB\n",
+           command.frame, command.name.c_str(), passed ? "ok  " : "FAIL",
+           diff.differingPixels, run->script.tolerance, diff.maxDifference,
+           diff.psnr);
+  }
+  stbi_image_free(golden);
+
+  if (!passed) {
+    run->failures++;
+
+    char actualPath[1024];
+    snprintf(actualPath, sizeof(actualPath), "%s/%s_actual.png",
+             run->goldenDirectory, command.name.c_str());
+    writeImage(actualPath, pixels.data(), width, height);
+  }
+}
+
+void checkRegressionFrame(RegressionRun *run, int frame, int width,
+                          int height) {
+  auto &commands = run->script.commands;
+  std::vector<unsigned char> pixels;
+
+  for (; run->nextCapture < commands.size() &&
+         commands[run->nextCapture].frame <= frame;
+       run->nextCapture++) {
+    auto &command = commands[run->nextCapture];
+    if (command.type != RegressionCapture)
+      continue;
+
+    // determinism over speed, a plain blocking readback
+    if (pixels.empty()) {
+      pixels.resize((size_t)width * height * 4);
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+      glPixelStorei(GL_PACK_ALIGNMENT, 4);
+      glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                   pixels.data());
+
+      // the framebuffer alpha means nothing, keep the pngs opaque
+      for (size_t i = 3; i < pixels.size(); i += 4)
+        pixels[i] = 255;
+    }
+
+    checkCapture(run, command, pixels, width, height);
+  }
+}
+
+int finishRegressionRun(RegressionRun *run) {
+  // captures scheduled past the last frame never ran
+  for (; run->nextCapture < run->script.commands.size(); run->nextCapture++) {
+    auto &command = run->script.commands[run->nextCapture];
+    if (command.type == RegressionCapture) {
+      printf("frame %4d %-24s FAIL never reached\n", command.frame,
+             command.name.c_str());
+      run->failures++;
+    }
+  }
+
+  printf("regression: %d captures, %d failed\n", run->checked, run->failures);
+  return run->failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "camera.h"
+
+enum RegressionCommandType {
+  RegressionMove,
+  RegressionLook,
+  RegressionZoom,
+  RegressionCapture,
+};
+
+struct RegressionCommand {
+  int frame;
+  RegressionCommandType type;
+  // move only
+  CameraMovementType direction;
+  // move distance, look cursor position or zoom offset
+  float x;
+  float y;
+  // capture only, the golden is <golden directory>/<name>.png
+  std::string name;
+};
+
+// A text file, one setting or command per line, # starts a comment:
+//
+//   frames 120          frames to render
+//   timestep 0.016667   seconds of scene time per frame
+//   size 800 600        window size
+//   tolerance 2         per channel difference still counted as equal
+//   allowed-pixels 0    pixels over the tolerance before a capture fails
+//   minimum-psnr 40     dB below which a capture fails
+//   30 move forward 0.5
+//   30 look 420 310     cursor position, like the cursor callback
+//   40 zoom 1
+//   60 capture name
+struct RegressionScript {
+  int frameCount;
+  double timestep;
+  int width;
+  int height;
+  int tolerance;
+  int allowedPixels;
+  double minimumPsnr;
+  // sorted by frame
+  std::vector<RegressionCommand> commands;
+};
+
+bool loadRegressionScript(const char *path, RegressionScript *script);
+
+struct RegressionRun {
+  RegressionScript script;
+  const char *goldenDirectory;
+  // write the captures as the new goldens instead of comparing them
+  bool updateGoldens;
+
+  size_t nextInput;
+  size_t nextCapture;
+  int checked;
+  int failures;
+};
+
+bool beginRegressionRun(RegressionRun *run, const char *scriptPath,
+                        const char *goldenDirectory, bool updateGoldens);
+
+// Feeds the camera commands of this frame, in place of the real input
+void applyRegressionInput(RegressionRun *run, Camera *camera, int frame);
+
+// Reads back the default framebuffer when this frame has captures and
+// compares it with the goldens, call it right before swapping
+void checkRegressionFrame(RegressionRun *run, int frame, int width,
+                          int height);
+
+// Prints the summary, returns the process exit code
+int finishRegressionRun(RegressionRun *run);
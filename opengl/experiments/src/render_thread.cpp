@@ -0,0 +1,214 @@
+#include <stdio.h>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "camera.h"
+#include "gpu_memory.h"
+#include "meshes.h"
+#include "render_thread.h"
+#include "shaders.h"
+#include "textures.h"
+
+static void renderThreadLoop(RenderThread *renderThread) {
+  glfwMakeContextCurrent(renderThread->window);
+  // the benchmark measures the CPU side, not the refresh rate
+  glfwSwapInterval(0);
+
+  auto replaying = 0;
+  while (true) {
+    auto &submitted = renderThread->submitted[replaying];
+    // frames still in flight are replayed before quitting
+    while (!submitted.load(std::memory_order_acquire)) {
+      if (renderThread->quit.load(std::memory_order_acquire))
+        break;
+      std::this_thread::yield();
+    }
+    if (!submitted.load(std::memory_order_acquire))
+      break;
+
+    auto start = glfwGetTime();
+    replayCommandBuffer(renderThread->buffers[replaying]);
+    auto replayed = glfwGetTime();
+    glfwSwapBuffers(renderThread->window);
+    auto swapped = glfwGetTime();
+
+    renderThread->replaySeconds += replayed - start;
+    renderThread->swapSeconds += swapped - replayed;
+    renderThread->frames++;
+
+    submitted.store(false, std::memory_order_release);
+    replaying ^= 1;
+  }
+
+  glfwMakeContextCurrent(NULL);
+}
+
+void startRenderThread(RenderThread *renderThread, GLFWwindow *window) {
+  renderThread->window = window;
+  for (auto i = 0; i < 2; i++) {
+    resetCommandBuffer(&renderThread->buffers[i]);
+    renderThread->submitted[i] = false;
+  }
+  renderThread->quit = false;
+
+  renderThread->recording = 0;
+  renderThread->gameWaitSeconds = 0.0;
+  renderThread->replaySeconds = 0.0;
+  renderThread->swapSeconds = 0.0;
+  renderThread->frames = 0;
+
+  glfwMakeContextCurrent(NULL);
+  renderThread->thread = std::thread(renderThreadLoop, renderThread);
+}
+
+void stopRenderThread(RenderThread *renderThread) {
+  renderThread->quit.store(true, std::memory_order_release);
+  renderThread->thread.join();
+  glfwMakeContextCurrent(renderThread->window);
+}
+
+CommandBuffer *beginRenderFrame(RenderThread *renderThread) {
+  auto buffer = &renderThread->buffers[renderThread->recording];
+  resetCommandBuffer(buffer);
+  return buffer;
+}
+
+void submitRenderFrame(RenderThread *renderThread) {
+  auto submitted = renderThread->recording;
+  renderThread->submitted[submitted].store(true, std::memory_order_release);
+
+  auto next = submitted ^ 1;
+  if (renderThread->submitted[next].load(std::memory_order_acquire)) {
+    auto start = glfwGetTime();
+    while (renderThread->submitted[next].load(std::memory_order_acquire))
+      std::this_thread::yield();
+    renderThread->gameWaitSeconds += glfwGetTime() - start;
+  }
+  renderThread->recording = next;
+}
+
+// the game side of the benchmark, the same for both modes
+static glm::mat4 cubeModel(int index, int gridSize, float time) {
+  auto x = index % gridSize - gridSize / 2;
+  auto z = index / gridSize - gridSize / 2;
+  auto model = glm::translate(glm::mat4(1.0f),
+                              glm::vec3(x * 0.4f, 0.0f, z * 0.4f - 40.0f));
+  model = glm::rotate(model, time + index * 0.1f, glm::vec3(1.0f, 0.3f, 0.5f));
+  return glm::scale(model, glm::vec3(0.2f));
+}
+
+void runRenderThreadBenchmark(GLFWwindow *window) {
+  const int drawCounts[] = {1000, 5000, 20000, 50000};
+  const int measuredFrames = 200;
+
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+
+  auto cube = createCubeMesh();
+  auto program = createShaderProgram();
+  glUseProgram(program);
+  glUniform1i(glGetUniformLocation(program, "containerTexture"), 0);
+  glUniform1i(glGetUniformLocation(program, "awesomeFaceTexture"), 1);
+  auto containerTexture = buildContanierTexture();
+  auto awesomeFaceTexture = buildAwesomeFaceTexture();
+
+  // resolved up front, the game thread has no context to ask
+  auto modelLocation = glGetUniformLocation(program, "model");
+  auto viewLocation = glGetUniformLocation(program, "view");
+  auto projectionLocation = glGetUniformLocation(program, "projection");
+  auto view = glm::mat4(1.0f);
+  auto projection =
+      glm::perspective(glm::radians(60.0f), (float)width / (float)height,
+                       cameraNearPlane, cameraFarPlane);
+  glfwSwapInterval(0);
+
+  printf("render thread: %dx%d, one uniform update and draw per cube, ms per "
+         "frame\n",
+         width, height);
+
+  for (auto drawCount : drawCounts) {
+    auto gridSize = 1;
+    while (gridSize * gridSize < drawCount)
+      gridSize++;
+
+    // everything on one thread, GL called as the frame is built
+    auto gameSeconds = 0.0;
+    auto swapSeconds = 0.0;
+    for (auto frame = 0; frame < measuredFrames; frame++) {
+      auto start = glfwGetTime();
+      glViewport(0, 0, width, height);
+      glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      glUseProgram(program);
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_2D, containerTexture);
+      glActiveTexture(GL_TEXTURE1);
+      glBindTexture(GL_TEXTURE_2D, awesomeFaceTexture);
+      glBindVertexArray(cube.vertexArrayObject);
+      glUniformMatrix4fv(viewLocation, 1, GL_FALSE, glm::value_ptr(view));
+      glUniformMatrix4fv(projectionLocation, 1, GL_FALSE,
+                         glm::value_ptr(projection));
+      for (auto i = 0; i < drawCount; i++) {
+        auto model = cubeModel(i, gridSize, frame * 0.01f);
+        glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(model));
+        glDrawArrays(GL_TRIANGLES, 0, cube.vertexCount);
+      }
+      auto built = glfwGetTime();
+      glfwSwapBuffers(window);
+      gameSeconds += built - start;
+      swapSeconds += glfwGetTime() - built;
+    }
+    glFinish();
+
+    printf("  %5d draws inline:        game %.3f (swap %.3f)\n", drawCount,
+           gameSeconds * 1000.0 / measuredFrames,
+           swapSeconds * 1000.0 / measuredFrames);
+
+    // the game thread only records, the render thread owns the context
+    RenderThread renderThread;
+    startRenderThread(&renderThread, window);
+
+    auto recordSeconds = 0.0;
+    auto bytes = (size_t)0;
+    for (auto frame = 0; frame < measuredFrames; frame++) {
+      auto start = glfwGetTime();
+      auto commands = beginRenderFrame(&renderThread);
+      recordViewport(commands, 0, 0, width, height);
+      recordClear(commands, glm::vec4(0.2f, 0.3f, 0.3f, 1.0f),
+                  GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      recordUseProgram(commands, program);
+      recordBindTexture(commands, 0, GL_TEXTURE_2D, containerTexture);
+      recordBindTexture(commands, 1, GL_TEXTURE_2D, awesomeFaceTexture);
+      recordBindVertexArray(commands, cube.vertexArrayObject);
+      recordUniform(commands, viewLocation, view);
+      recordUniform(commands, projectionLocation, projection);
+      for (auto i = 0; i < drawCount; i++) {
+        recordUniform(commands, modelLocation,
+                      cubeModel(i, gridSize, frame * 0.01f));
+        recordDrawArrays(commands, GL_TRIANGLES, 0, cube.vertexCount);
+      }
+      bytes = commands->size;
+      recordSeconds += glfwGetTime() - start;
+
+      submitRenderFrame(&renderThread);
+    }
+    stopRenderThread(&renderThread);
+    glFinish();
+
+    printf("  %5d draws render thread: game %.3f (waited %.3f), render %.3f "
+           "(swap %.3f), %zu KB of commands\n",
+           drawCount, recordSeconds * 1000.0 / measuredFrames,
+           renderThread.gameWaitSeconds * 1000.0 / measuredFrames,
+           renderThread.replaySeconds * 1000.0 / renderThread.frames,
+           renderThread.swapSeconds * 1000.0 / renderThread.frames,
+           bytes / 1024);
+  }
+
+  deleteGpuTextures(1, &containerTexture);
+  deleteGpuTextures(1, &awesomeFaceTexture);
+  deleteGpuProgram(program);
+  deleteMesh(&cube);
+}
@@ -3,6 +3,8 @@
 
 #include <glad/glad.h>
 
+#include "gpu_memory.h"
+
 char *readShaderFile(const char *filePath) {
   auto file = fopen(filePath, "r");
   if (file == NULL) {
@@ -41,46 +43,63 @@ unsigned int createShader(unsigned int type, const char *source) {
   return shader;
 }
 
-unsigned int createVertexShader(const char *filePath) {
+unsigned int createShaderFromFile(unsigned int type, const char *filePath) {
   auto fileContent = readShaderFile(filePath);
-  auto shader = createShader(GL_VERTEX_SHADER, fileContent);
+  auto shader = createShader(type, fileContent);
 
   free(fileContent);
   return shader;
 }
 
-unsigned int createFragmentShader(const char *filePath) {
-  auto fileContent = readShaderFile(filePath);
-  auto shader = createShader(GL_FRAGMENT_SHADER, fileContent);
-
-  free(fileContent);
-  return shader;
+unsigned int createVertexShader(const char *filePath) {
+  return createShaderFromFile(GL_VERTEX_SHADER, filePath);
 }
 
-unsigned int createShaderProgram() {
-
-  auto vertexShader = createVertexShader("../shaders/vertex.glsl");
-  auto fragmentShader = createFragmentShader("../shaders/fragment.glsl");
+unsigned int createFragmentShader(const char *filePath) {
+  return createShaderFromFile(GL_FRAGMENT_SHADER, filePath);
+}
 
-  // shader program creation and linking
+// links and releases the given shaders
+unsigned int linkShaderProgram(const unsigned int *shaders, int shaderCount) {
   auto shaderProgram = glCreateProgram();
-  glAttachShader(shaderProgram, vertexShader);
-  glAttachShader(shaderProgram, fragmentShader);
+  for (auto i = 0; i < shaderCount; i++)
+    glAttachShader(shaderProgram, shaders[i]);
   glLinkProgram(shaderProgram);
 
   int success;
   glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
   if (!success) {
     int length;
-    auto message = (char *)alloca(length * sizeof(char));
-    glGetShaderiv(shaderProgram, GL_INFO_LOG_LENGTH, &length);
+    glGetProgramiv(shaderProgram, GL_INFO_LOG_LENGTH, &length);
 
-    glGetShaderInfoLog(shaderProgram, length, &length, message);
+    auto message = (char *)alloca(length * sizeof(char));
+    glGetProgramInfoLog(shaderProgram, length, &length, message);
     fprintf(stderr, "unable to create shader program: %s\n", message);
   }
 
-  glDeleteShader(vertexShader);
-  glDeleteShader(fragmentShader);
+  for (auto i = 0; i < shaderCount; i++)
+    glDeleteShader(shaders[i]);
 
+  registerGpuProgram(shaderProgram);
   return shaderProgram;
 }
+
+unsigned int createShaderProgram(const char *vertexShaderPath,
+                                 const char *fragmentShaderPath) {
+  unsigned int shaders[] = {createVertexShader(vertexShaderPath),
+                            createFragmentShader(fragmentShaderPath)};
+
+  return linkShaderProgram(shaders, 2);
+}
+
+unsigned int createShaderProgram() {
+  return createShaderProgram("../shaders/vertex.glsl",
+                             "../shaders/fragment.glsl");
+}
+
+unsigned int createComputeProgram(const char *computeShaderPath) {
+  unsigned int shader =
+      createShaderFromFile(GL_COMPUTE_SHADER, computeShaderPath);
+
+  return linkShaderProgram(&shader, 1);
+}
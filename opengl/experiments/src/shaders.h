@@ -1 +1,9 @@
+#pragma once
+
+unsigned int createShaderFromFile(unsigned int type, const char *filePath);
+unsigned int linkShaderProgram(const unsigned int *shaders, int shaderCount);
+
 unsigned int createShaderProgram();
+unsigned int createShaderProgram(const char *vertexShaderPath,
+                                 const char *fragmentShaderPath);
+unsigned int createComputeProgram(const char *computeShaderPath);
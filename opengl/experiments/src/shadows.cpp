@@ -0,0 +1,248 @@
+#include <math.h>
+#include <stdio.h>
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "camera.h"
+#include "gpu_memory.h"
+#include "shaders.h"
+#include "shadows.h"
+
+// blend between logarithmic and uniform splits, 1 is fully logarithmic
+const float cascadeSplitLambda = 0.8f;
+
+void createShadowCascades(ShadowCascades *shadows) {
+  shadows->depthTexture = createGpuTexture(
+      GpuMemoryRenderTargets, GL_TEXTURE_2D_ARRAY, 1, GL_DEPTH_COMPONENT32F,
+      shadowMapSize, shadowMapSize, shadowCascadeCount);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  // hardware depth comparison, filtered into 2x2 PCF for free
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE,
+                  GL_COMPARE_REF_TO_TEXTURE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+  glGenFramebuffers(1, &shadows->framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, shadows->framebuffer);
+  // layered attachment, the geometry shader picks the layer
+  glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                       shadows->depthTexture, 0);
+  glDrawBuffer(GL_NONE);
+  glReadBuffer(GL_NONE);
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    fprintf(stderr, "shadow map framebuffer is incomplete\n");
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+  unsigned int shaders[] = {
+      createShaderFromFile(GL_VERTEX_SHADER, "../shaders/shadow_vertex.glsl"),
+      createShaderFromFile(GL_GEOMETRY_SHADER,
+                           "../shaders/shadow_geometry.glsl")};
+  shadows->program = linkShaderProgram(shaders, 2);
+
+  shadows->instanceBuffer = createGpuBuffer(
+      GpuMemoryGeometry, GL_SHADER_STORAGE_BUFFER, 0, NULL, GL_STREAM_DRAW);
+  shadows->instanceCapacity = 0;
+
+  for (auto i = 0; i < shadowCascadeCount; i++) {
+    shadows->drawCounts[i] = 0;
+    createGpuTimer(&shadows->timers[i]);
+  }
+}
+
+void deleteShadowCascades(ShadowCascades *shadows) {
+  deleteGpuTextures(1, &shadows->depthTexture);
+  glDeleteFramebuffers(1, &shadows->framebuffer);
+  deleteGpuProgram(shadows->program);
+  deleteGpuBuffers(1, &shadows->instanceBuffer);
+
+  for (auto i = 0; i < shadowCascadeCount; i++)
+    deleteGpuTimer(&shadows->timers[i]);
+}
+
+void updateShadowCascades(ShadowCascades *shadows, const glm::mat4 &view,
+                          float fieldOfView, float aspectRatio,
+                          glm::vec3 lightDirection) {
+  lightDirection = glm::normalize(lightDirection);
+  shadows->lightDirection = lightDirection;
+
+  auto nearPlane = cameraNearPlane;
+  auto farPlane = fminf(cameraFarPlane, shadowDistance);
+  auto inverseView = glm::inverse(view);
+
+  // a light looking straight down would make lookAt degenerate
+  auto lightUp = fabsf(lightDirection.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f)
+                                                 : glm::vec3(0.0f, 1.0f, 0.0f);
+
+  auto sliceNear = nearPlane;
+  for (auto i = 0; i < shadowCascadeCount; i++) {
+    auto fraction = (float)(i + 1) / shadowCascadeCount;
+    auto logarithmic = nearPlane * powf(farPlane / nearPlane, fraction);
+    auto uniform = nearPlane + (farPlane - nearPlane) * fraction;
+    auto sliceFar = cascadeSplitLambda * logarithmic +
+                    (1.0f - cascadeSplitLambda) * uniform;
+    shadows->splitDistances[i] = sliceFar;
+
+    // corners of this slice of the camera frustum in world space
+    auto sliceProjection = glm::perspective(glm::radians(fieldOfView),
+                                            aspectRatio, sliceNear, sliceFar);
+    auto toWorld = inverseView * glm::inverse(sliceProjection);
+    glm::vec3 corners[8];
+    auto center = glm::vec3(0.0f);
+    for (auto corner = 0; corner < 8; corner++) {
+      auto ndc = glm::vec4(corner & 1 ? 1.0f : -1.0f, corner & 2 ? 1.0f : -1.0f,
+                           corner & 4 ? 1.0f : -1.0f, 1.0f);
+      auto world = toWorld * ndc;
+      corners[corner] = glm::vec3(world) / world.w;
+      center += corners[corner] / 8.0f;
+    }
+
+    // a bounding sphere keeps the projection size constant while the camera
+    // rotates, rounding the radius keeps float noise from changing it
+    auto radius = 0.0f;
+    for (auto &corner : corners)
+      radius = fmaxf(radius, glm::length(corner - center));
+    radius = ceilf(radius * 16.0f) / 16.0f;
+
+    auto lightView =
+        glm::lookAt(center - lightDirection * radius, center, lightUp);
+    auto lightProjection =
+        glm::ortho(-radius, radius, -radius, radius, 0.0f, 2.0f * radius);
+
+    // snap the projection to whole texels so the shadow edges do not
+    // shimmer when the camera moves
+    auto shadowMatrix = lightProjection * lightView;
+    auto origin = shadowMatrix * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    origin *= shadowMapSize / 2.0f;
+    auto snapOffset = (glm::round(origin) - origin) * (2.0f / shadowMapSize);
+    lightProjection[3][0] += snapOffset.x;
+    lightProjection[3][1] += snapOffset.y;
+
+    shadows->lightViewProjections[i] = lightProjection * lightView;
+    shadows->texelSizes[i] = 2.0f * radius / shadowMapSize;
+
+    sliceNear = sliceFar;
+  }
+}
+
+static bool casterInCascade(const glm::mat4 &lightViewProjection,
+                            const ShadowCaster &caster, float cascadeRadius) {
+  // the cascade is an orthographic box, so clip space is a linear scale of
+  // light space and the sphere radius maps with the same scale
+  auto clip = lightViewProjection * glm::vec4(caster.center, 1.0f);
+  auto radius = caster.radius / cascadeRadius;
+
+  // casters between the light and the near plane still cast into the
+  // cascade, depth clamping flattens them onto it
+  return clip.x + radius >= -1.0f && clip.x - radius <= 1.0f &&
+         clip.y + radius >= -1.0f && clip.y - radius <= 1.0f &&
+         clip.z - radius <= 1.0f;
+}
+
+void renderShadowCascades(ShadowCascades *shadows, const Mesh &mesh,
+                          const ShadowCaster *casters, int casterCount,
+                          int viewportWidth, int viewportHeight) {
+  // cull every caster against every cascade, instances end up grouped by
+  // cascade so each cascade is one contiguous range
+  shadows->instances.clear();
+  int firstInstance[shadowCascadeCount];
+  for (auto cascade = 0; cascade < shadowCascadeCount; cascade++) {
+    firstInstance[cascade] = (int)shadows->instances.size();
+    auto cascadeRadius = shadows->texelSizes[cascade] * shadowMapSize / 2.0f;
+
+    for (auto i = 0; i < casterCount; i++) {
+      if (!casterInCascade(shadows->lightViewProjections[cascade], casters[i],
+                           cascadeRadius))
+        continue;
+
+      ShadowInstance instance;
+      instance.model = casters[i].model;
+      instance.cascade = glm::uvec4(cascade, 0, 0, 0);
+      shadows->instances.push_back(instance);
+    }
+
+    shadows->drawCounts[cascade] =
+        (int)shadows->instances.size() - firstInstance[cascade];
+  }
+
+  auto instanceCount = (int)shadows->instances.size();
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, shadows->instanceBuffer);
+  if (instanceCount > shadows->instanceCapacity) {
+    shadows->instanceCapacity = instanceCount * 2;
+    resizeGpuBuffer(shadows->instanceBuffer, GL_SHADER_STORAGE_BUFFER,
+                    shadows->instanceCapacity * sizeof(ShadowInstance), NULL,
+                    GL_STREAM_DRAW);
+  }
+  glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0,
+                  instanceCount * sizeof(ShadowInstance),
+                  shadows->instances.data());
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, shadows->framebuffer);
+  glViewport(0, 0, shadowMapSize, shadowMapSize);
+  glClear(GL_DEPTH_BUFFER_BIT);
+
+  glEnable(GL_DEPTH_CLAMP);
+  glEnable(GL_POLYGON_OFFSET_FILL);
+  glPolygonOffset(2.0f, 4.0f);
+
+  glUseProgram(shadows->program);
+  glUniformMatrix4fv(
+      glGetUniformLocation(shadows->program, "lightViewProjections"),
+      shadowCascadeCount, GL_FALSE,
+      glm::value_ptr(shadows->lightViewProjections[0]));
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, shadows->instanceBuffer);
+  glBindVertexArray(mesh.vertexArrayObject);
+
+  for (auto cascade = 0; cascade < shadowCascadeCount; cascade++) {
+    beginGpuTimer(&shadows->timers[cascade]);
+    if (shadows->drawCounts[cascade] > 0) {
+      glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, mesh.vertexCount,
+                                        shadows->drawCounts[cascade],
+                                        firstInstance[cascade]);
+    }
+    endGpuTimer(&shadows->timers[cascade]);
+  }
+
+  glDisable(GL_POLYGON_OFFSET_FILL);
+  glDisable(GL_DEPTH_CLAMP);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glViewport(0, 0, viewportWidth, viewportHeight);
+}
+
+void useShadowCascades(const ShadowCascades &shadows,
+                       unsigned int shaderProgram, glm::vec3 lightColor) {
+  glUseProgram(shaderProgram);
+
+  glActiveTexture(GL_TEXTURE0 + shadowMapTextureUnit);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, shadows.depthTexture);
+
+  glUniformMatrix4fv(
+      glGetUniformLocation(shaderProgram, "cascadeViewProjections"),
+      shadowCascadeCount, GL_FALSE,
+      glm::value_ptr(shadows.lightViewProjections[0]));
+  glUniform1fv(glGetUniformLocation(shaderProgram, "cascadeSplits"),
+               shadowCascadeCount, shadows.splitDistances);
+  glUniform1fv(glGetUniformLocation(shaderProgram, "cascadeTexelSizes"),
+               shadowCascadeCount, shadows.texelSizes);
+
+  glUniform3fv(glGetUniformLocation(shaderProgram, "sunDirection"), 1,
+               glm::value_ptr(shadows.lightDirection));
+  glUniform3fv(glGetUniformLocation(shaderProgram, "sunColor"), 1,
+               glm::value_ptr(lightColor));
+}
+
+void printShadowStats(ShadowCascades *shadows) {
+  printf("shadows |");
+  for (auto i = 0; i < shadowCascadeCount; i++) {
+    printf(" cascade %d (%.1fm): %d draws %.3f ms%s", i,
+           shadows->splitDistances[i], shadows->drawCounts[i],
+           gpuTimerAverageMilliseconds(shadows->timers[i]),
+           i + 1 < shadowCascadeCount ? "," : "\n");
+    resetGpuTimerAverage(&shadows->timers[i]);
+  }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "gpu_timer.h"
+#include "meshes.h"
+
+const int shadowCascadeCount = 4;
+const int shadowMapTextureUnit = 2;
+const int shadowMapSize = 2048;
+// cascades stop here even if the camera sees further
+const float shadowDistance = 60.0f;
+
+// Same layout as `ShadowInstance` in shaders/shadow_vertex.glsl (std430)
+struct ShadowInstance {
+  glm::mat4 model;
+  glm::uvec4 cascade;
+};
+
+struct ShadowCaster {
+  glm::mat4 model;
+  // world space bounding sphere, used for the per cascade culling
+  glm::vec3 center;
+  float radius;
+};
+
+struct ShadowCascades {
+  unsigned int depthTexture;
+  unsigned int framebuffer;
+  unsigned int program;
+
+  unsigned int instanceBuffer;
+  int instanceCapacity;
+  std::vector<ShadowInstance> instances;
+
+  glm::vec3 lightDirection;
+  // view space distance where each cascade ends
+  float splitDistances[shadowCascadeCount];
+  float texelSizes[shadowCascadeCount];
+  glm::mat4 lightViewProjections[shadowCascadeCount];
+
+  int drawCounts[shadowCascadeCount];
+  GpuTimer timers[shadowCascadeCount];
+};
+
+void createShadowCascades(ShadowCascades *shadows);
+void deleteShadowCascades(ShadowCascades *shadows);
+
+// Fits one texel-snapped orthographic projection per cascade around the
+// slices of the camera frustum
+void updateShadowCascades(ShadowCascades *shadows, const glm::mat4 &view,
+                          float fieldOfView, float aspectRatio,
+                          glm::vec3 lightDirection);
+
+// Culls the casters against every cascade and renders them into the layers
+// of the shadow map, one instanced draw per cascade. It leaves the default
+// framebuffer bound with the given viewport
+void renderShadowCascades(ShadowCascades *shadows, const Mesh &mesh,
+                          const ShadowCaster *casters, int casterCount,
+                          int viewportWidth, int viewportHeight);
+
+// Sets the uniforms and binds the shadow map to shadowMapTextureUnit for the
+// lit shaders
+void useShadowCascades(const ShadowCascades &shadows,
+                       unsigned int shaderProgram, glm::vec3 lightColor);
+
+void printShadowStats(ShadowCascades *shadows);
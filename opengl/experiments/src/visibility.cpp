@@ -0,0 +1,385 @@
+#include <stdio.h>
+
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "camera.h"
+#include "clustered.h"
+#include "gpu_memory.h"
+#include "shaders.h"
+#include "textures.h"
+#include "visibility.h"
+
+// Shader storage binding points, see shaders/visibility_*
+const int verticesBinding = 5;
+const int instancesBinding = 6;
+
+const int shadeGroupSize = 8;
+
+void createVisibilityBuffer(VisibilityBuffer *visibility) {
+  visibility->geometryProgram =
+      createShaderProgram("../shaders/visibility_vertex.glsl",
+                          "../shaders/visibility_fragment.glsl");
+
+  visibility->shadeProgram =
+      createComputeProgram("../shaders/visibility_shade.comp");
+  glUseProgram(visibility->shadeProgram);
+  glUniform1i(glGetUniformLocation(visibility->shadeProgram, "containerTexture"),
+              0);
+  glUniform1i(
+      glGetUniformLocation(visibility->shadeProgram, "awesomeFaceTexture"), 1);
+  glUniform1i(glGetUniformLocation(visibility->shadeProgram, "shadowMap"), 2);
+  glUniform1i(
+      glGetUniformLocation(visibility->shadeProgram, "visibilityTexture"),
+      visibilityTextureUnit);
+
+  visibility->resolveProgram =
+      createShaderProgram("../shaders/fullscreen_vertex.glsl",
+                          "../shaders/visibility_resolve_fragment.glsl");
+  glUseProgram(visibility->resolveProgram);
+  glUniform1i(
+      glGetUniformLocation(visibility->resolveProgram, "visibilityTexture"),
+      visibilityTextureUnit);
+  glUniform1i(glGetUniformLocation(visibility->resolveProgram, "shadedTexture"),
+              visibilityShadedTextureUnit);
+  glUniform1i(glGetUniformLocation(visibility->resolveProgram, "depthTexture"),
+              visibilityDepthTextureUnit);
+  // core profile refuses to draw without a vertex array, even an empty one
+  glGenVertexArrays(1, &visibility->resolveVertexArray);
+
+  glGenFramebuffers(1, &visibility->framebuffer);
+  visibility->visibilityTexture = 0;
+  visibility->depthTexture = 0;
+  visibility->shadedTexture = 0;
+  visibility->width = 0;
+  visibility->height = 0;
+
+  visibility->instanceBuffer = createGpuBuffer(
+      GpuMemoryGeometry, GL_SHADER_STORAGE_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
+  visibility->instanceCapacity = 0;
+
+  createGpuTimer(&visibility->geometryTimer);
+  createGpuTimer(&visibility->shadingTimer);
+  createGpuTimer(&visibility->resolveTimer);
+}
+
+static void deleteTargets(VisibilityBuffer *visibility) {
+  unsigned int textures[] = {visibility->visibilityTexture,
+                             visibility->depthTexture,
+                             visibility->shadedTexture};
+  deleteGpuTextures(3, textures);
+}
+
+void deleteVisibilityBuffer(VisibilityBuffer *visibility) {
+  deleteTargets(visibility);
+  glDeleteFramebuffers(1, &visibility->framebuffer);
+  deleteGpuProgram(visibility->geometryProgram);
+  deleteGpuProgram(visibility->shadeProgram);
+  deleteGpuProgram(visibility->resolveProgram);
+  glDeleteVertexArrays(1, &visibility->resolveVertexArray);
+  deleteGpuBuffers(1, &visibility->instanceBuffer);
+
+  deleteGpuTimer(&visibility->geometryTimer);
+  deleteGpuTimer(&visibility->shadingTimer);
+  deleteGpuTimer(&visibility->resolveTimer);
+}
+
+static unsigned int createTarget(GLenum format, int width, int height) {
+  auto texture = createGpuTexture(GpuMemoryRenderTargets, GL_TEXTURE_2D, 1,
+                                  format, width, height, 1);
+  // only ever read with texelFetch
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+  return texture;
+}
+
+void resizeVisibilityBuffer(VisibilityBuffer *visibility, int width,
+                            int height) {
+  if (width == visibility->width && height == visibility->height)
+    return;
+  // minimized windows report a zero size
+  if (width <= 0 || height <= 0)
+    return;
+
+  deleteTargets(visibility);
+  visibility->width = width;
+  visibility->height = height;
+
+  visibility->visibilityTexture = createTarget(GL_RG32UI, width, height);
+  visibility->depthTexture =
+      createTarget(GL_DEPTH_COMPONENT32F, width, height);
+  visibility->shadedTexture = createTarget(GL_RGBA8, width, height);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, visibility->framebuffer);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         visibility->visibilityTexture, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D,
+                         visibility->depthTexture, 0);
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    fprintf(stderr, "visibility buffer framebuffer is incomplete\n");
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void uploadVisibilityInstances(VisibilityBuffer *visibility,
+                               const glm::mat4 *models, int instanceCount) {
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, visibility->instanceBuffer);
+  if (instanceCount > visibility->instanceCapacity) {
+    visibility->instanceCapacity = instanceCount;
+    resizeGpuBuffer(visibility->instanceBuffer, GL_SHADER_STORAGE_BUFFER,
+                    instanceCount * sizeof(glm::mat4), NULL, GL_DYNAMIC_DRAW);
+  }
+  glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0,
+                  instanceCount * sizeof(glm::mat4), models);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void renderVisibilityBuffer(VisibilityBuffer *visibility, const Mesh &mesh,
+                            int instanceCount, const glm::mat4 &view,
+                            const glm::mat4 &projection) {
+  beginGpuTimer(&visibility->geometryTimer);
+  glBindFramebuffer(GL_FRAMEBUFFER, visibility->framebuffer);
+
+  const unsigned int emptyPixel[] = {0, 0, 0, 0};
+  glClearBufferuiv(GL_COLOR, 0, emptyPixel);
+  glClear(GL_DEPTH_BUFFER_BIT);
+
+  auto viewProjection = projection * view;
+  glUseProgram(visibility->geometryProgram);
+  glUniformMatrix4fv(
+      glGetUniformLocation(visibility->geometryProgram, "viewProjection"), 1,
+      GL_FALSE, glm::value_ptr(viewProjection));
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, instancesBinding,
+                   visibility->instanceBuffer);
+
+  glBindVertexArray(mesh.vertexArrayObject);
+  glDrawArraysInstanced(GL_TRIANGLES, 0, mesh.vertexCount, instanceCount);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  endGpuTimer(&visibility->geometryTimer);
+}
+
+void shadeVisibilityBuffer(VisibilityBuffer *visibility, const Mesh &mesh,
+                           const glm::mat4 &view, const glm::mat4 &projection,
+                           bool lit) {
+  auto program = visibility->shadeProgram;
+
+  beginGpuTimer(&visibility->shadingTimer);
+  glUseProgram(program);
+  glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE,
+                     glm::value_ptr(view));
+  glUniformMatrix4fv(glGetUniformLocation(program, "inverseViewProjection"), 1,
+                     GL_FALSE,
+                     glm::value_ptr(glm::inverse(projection * view)));
+  glUniform3fv(glGetUniformLocation(program, "cameraPosition"), 1,
+               glm::value_ptr(glm::vec3(glm::inverse(view)[3])));
+  glUniform2f(glGetUniformLocation(program, "viewportSize"),
+              (float)visibility->width, (float)visibility->height);
+  glUniform1i(glGetUniformLocation(program, "lit"), lit);
+
+  glActiveTexture(GL_TEXTURE0 + visibilityTextureUnit);
+  glBindTexture(GL_TEXTURE_2D, visibility->visibilityTexture);
+  glBindImageTexture(0, visibility->shadedTexture, 0, GL_FALSE, 0,
+                     GL_WRITE_ONLY, GL_RGBA8);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, verticesBinding,
+                   mesh.vertexBuffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, instancesBinding,
+                   visibility->instanceBuffer);
+
+  glDispatchCompute((visibility->width + shadeGroupSize - 1) / shadeGroupSize,
+                    (visibility->height + shadeGroupSize - 1) / shadeGroupSize,
+                    1);
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+  endGpuTimer(&visibility->shadingTimer);
+
+  beginGpuTimer(&visibility->resolveTimer);
+  glActiveTexture(GL_TEXTURE0 + visibilityShadedTextureUnit);
+  glBindTexture(GL_TEXTURE_2D, visibility->shadedTexture);
+  glActiveTexture(GL_TEXTURE0 + visibilityDepthTextureUnit);
+  glBindTexture(GL_TEXTURE_2D, visibility->depthTexture);
+
+  glUseProgram(visibility->resolveProgram);
+  glDepthFunc(GL_ALWAYS);
+  glBindVertexArray(visibility->resolveVertexArray);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+  glDepthFunc(GL_LESS);
+  endGpuTimer(&visibility->resolveTimer);
+}
+
+void printVisibilityStats(VisibilityBuffer *visibility) {
+  printf("visibility buffer | geometry %.3f ms, shading %.3f ms, resolve "
+         "%.3f ms\n",
+         gpuTimerAverageMilliseconds(visibility->geometryTimer),
+         gpuTimerAverageMilliseconds(visibility->shadingTimer),
+         gpuTimerAverageMilliseconds(visibility->resolveTimer));
+  resetGpuTimerAverage(&visibility->geometryTimer);
+  resetGpuTimerAverage(&visibility->shadingTimer);
+  resetGpuTimerAverage(&visibility->resolveTimer);
+}
+
+void runVisibilityBufferBenchmark(GLFWwindow *window) {
+  const int layerCounts[] = {1, 4, 16, 32};
+  const int columns = 24;
+  const int rows = 14;
+  const float spacing = 1.2f;
+  const float layerSpacing = 2.0f;
+  const int lightCount = 2000;
+  const int warmupFrames = 30;
+  const int measuredFrames = 240;
+
+  auto cube = createCubeMesh();
+
+  auto offsetsBuffer = createGpuBuffer(GpuMemoryGeometry, GL_ARRAY_BUFFER, 0,
+                                       NULL, GL_STATIC_DRAW);
+  attachInstanceOffsets(cube, offsetsBuffer);
+
+  auto forwardProgram = createLitShaderProgram();
+
+  VisibilityBuffer visibility;
+  createVisibilityBuffer(&visibility);
+
+  auto containerTexture = buildContanierTexture();
+  auto awesomeFaceTexture = buildAwesomeFaceTexture();
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, containerTexture);
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, awesomeFaceTexture);
+
+  auto maxLayers = layerCounts[3];
+  auto halfWidth = columns * spacing * 0.5f;
+  auto halfHeight = rows * spacing * 0.5f;
+  auto fieldDepth = maxLayers * layerSpacing;
+
+  ClusteredLighting lighting;
+  createClusteredLighting(&lighting, lightCount);
+  std::vector<Light> lights(lightCount);
+  generateLights(lights.data(), lightCount,
+                 glm::vec3(-halfWidth, -halfHeight, -fieldDepth - 4.0f),
+                 glm::vec3(halfWidth, halfHeight, -3.0f), 4321);
+  uploadLights(&lighting, lights.data(), lightCount);
+
+  GpuTimer forwardTimer;
+  createGpuTimer(&forwardTimer);
+
+  int width, height;
+  glfwGetFramebufferSize(window, &width, &height);
+  glViewport(0, 0, width, height);
+  resizeVisibilityBuffer(&visibility, width, height);
+
+  // every layer of the wall of cubes covers the whole screen
+  auto view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f),
+                          glm::vec3(0.0f, 0.0f, -1.0f),
+                          glm::vec3(0.0f, 1.0f, 0.0f));
+  auto projection =
+      glm::perspective(glm::radians(60.0f), (float)width / (float)height,
+                       cameraNearPlane, cameraFarPlane);
+
+  printf("visibility buffer: %dx%d cubes per layer, %d lights, %dx%d\n",
+         columns, rows, lightCount, width, height);
+
+  for (auto layerCount : layerCounts) {
+    // back to front, the worst case for forward shading
+    std::vector<glm::vec3> offsets;
+    std::vector<glm::mat4> models;
+    for (auto layer = layerCount - 1; layer >= 0; layer--) {
+      for (auto row = 0; row < rows; row++) {
+        for (auto column = 0; column < columns; column++) {
+          // the layers are staggered so every one of them shows through
+          // the gaps of the others
+          auto stagger = (layer % 2) * spacing * 0.5f;
+          auto offset = glm::vec3(
+              column * spacing - halfWidth + stagger,
+              row * spacing - halfHeight + stagger,
+              -4.0f - layer * layerSpacing);
+          offsets.push_back(offset);
+          models.push_back(glm::translate(glm::mat4(1.0f), offset));
+        }
+      }
+    }
+    auto instanceCount = (int)models.size();
+
+    resizeGpuBuffer(offsetsBuffer, GL_ARRAY_BUFFER,
+                    offsets.size() * sizeof(glm::vec3), offsets.data(),
+                    GL_STATIC_DRAW);
+    uploadVisibilityInstances(&visibility, models.data(), instanceCount);
+
+    double forwardFrameMilliseconds = 0.0;
+    double visibilityFrameMilliseconds = 0.0;
+    for (auto useVisibility = 0; useVisibility < 2; useVisibility++) {
+      double cpuStart = 0.0;
+      for (auto frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+        if (frame == warmupFrames) {
+          resetGpuTimerAverage(&forwardTimer);
+          resetGpuTimerAverage(&visibility.geometryTimer);
+          resetGpuTimerAverage(&visibility.shadingTimer);
+          resetGpuTimerAverage(&visibility.resolveTimer);
+          cpuStart = glfwGetTime();
+        }
+
+        updateClusters(&lighting, view, projection, width, height);
+
+        if (useVisibility)
+          renderVisibilityBuffer(&visibility, cube, instanceCount, view,
+                                 projection);
+
+        glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        if (useVisibility) {
+          useClusteredLighting(lighting, visibility.shadeProgram, width,
+                               height);
+          shadeVisibilityBuffer(&visibility, cube, view, projection, true);
+        } else {
+          beginGpuTimer(&forwardTimer);
+          useClusteredLighting(lighting, forwardProgram, width, height);
+          glUniformMatrix4fv(glGetUniformLocation(forwardProgram, "view"), 1,
+                             GL_FALSE, glm::value_ptr(view));
+          glUniformMatrix4fv(
+              glGetUniformLocation(forwardProgram, "projection"), 1, GL_FALSE,
+              glm::value_ptr(projection));
+          glUniformMatrix4fv(glGetUniformLocation(forwardProgram, "model"), 1,
+                             GL_FALSE, glm::value_ptr(glm::mat4(1.0f)));
+
+          glBindVertexArray(cube.vertexArrayObject);
+          glDrawArraysInstanced(GL_TRIANGLES, 0, cube.vertexCount,
+                                instanceCount);
+          endGpuTimer(&forwardTimer);
+        }
+
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+      }
+
+      auto cpuMilliseconds =
+          (glfwGetTime() - cpuStart) * 1000.0 / measuredFrames;
+      if (useVisibility)
+        visibilityFrameMilliseconds = cpuMilliseconds;
+      else
+        forwardFrameMilliseconds = cpuMilliseconds;
+    }
+
+    auto geometry = gpuTimerAverageMilliseconds(visibility.geometryTimer);
+    auto shading = gpuTimerAverageMilliseconds(visibility.shadingTimer);
+    auto resolve = gpuTimerAverageMilliseconds(visibility.resolveTimer);
+    printf("%2d layers, %5d cubes | forward %.3f ms (frame %.3f ms) | "
+           "visibility geometry %.3f ms, shading %.3f ms, resolve %.3f ms, "
+           "total %.3f ms (frame %.3f ms)\n",
+           layerCount, instanceCount,
+           gpuTimerAverageMilliseconds(forwardTimer), forwardFrameMilliseconds,
+           geometry, shading, resolve, geometry + shading + resolve,
+           visibilityFrameMilliseconds);
+  }
+
+  deleteGpuTimer(&forwardTimer);
+  deleteClusteredLighting(&lighting);
+  deleteVisibilityBuffer(&visibility);
+  deleteGpuTextures(1, &containerTexture);
+  deleteGpuTextures(1, &awesomeFaceTexture);
+  deleteGpuProgram(forwardProgram);
+  deleteGpuBuffers(1, &offsetsBuffer);
+  deleteMesh(&cube);
+}
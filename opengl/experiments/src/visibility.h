@@ -0,0 +1,68 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "gpu_timer.h"
+#include "meshes.h"
+
+// Texture units used by the shading and resolve passes, 0 and 1 are the
+// material textures and 2 the shadow map
+const int visibilityTextureUnit = 3;
+const int visibilityShadedTextureUnit = 4;
+const int visibilityDepthTextureUnit = 5;
+
+// Triangle and instance ids are rasterized into a 64 bit target, then a
+// compute pass shades each covered pixel exactly once no matter how much
+// geometry was overdrawn
+struct VisibilityBuffer {
+  unsigned int framebuffer;
+  // RG32UI, x instance + 1 with 0 for empty pixels, y triangle
+  unsigned int visibilityTexture;
+  unsigned int depthTexture;
+  unsigned int shadedTexture;
+  int width;
+  int height;
+
+  unsigned int geometryProgram;
+  // lighting and shadows are set on it with useClusteredLighting and
+  // useShadowCascades like on the forward lit program
+  unsigned int shadeProgram;
+  unsigned int resolveProgram;
+  unsigned int resolveVertexArray;
+
+  unsigned int instanceBuffer;
+  int instanceCapacity;
+
+  GpuTimer geometryTimer;
+  GpuTimer shadingTimer;
+  GpuTimer resolveTimer;
+};
+
+void createVisibilityBuffer(VisibilityBuffer *visibility);
+void deleteVisibilityBuffer(VisibilityBuffer *visibility);
+
+// Reallocates the render targets when the size changed
+void resizeVisibilityBuffer(VisibilityBuffer *visibility, int width,
+                            int height);
+
+void uploadVisibilityInstances(VisibilityBuffer *visibility,
+                               const glm::mat4 *models, int instanceCount);
+
+// Rasterizes the ids of the uploaded instances of a non indexed mesh. It
+// leaves the default framebuffer bound
+void renderVisibilityBuffer(VisibilityBuffer *visibility, const Mesh &mesh,
+                            int instanceCount, const glm::mat4 &view,
+                            const glm::mat4 &projection);
+
+// Shades the visibility buffer and resolves color and depth into the bound
+// framebuffer, the material textures must be bound to units 0 and 1
+void shadeVisibilityBuffer(VisibilityBuffer *visibility, const Mesh &mesh,
+                           const glm::mat4 &view, const glm::mat4 &projection,
+                           bool lit);
+
+void printVisibilityStats(VisibilityBuffer *visibility);
+
+// Compares forward and visibility buffer shading on cube fields with more
+// and more layers of overdraw
+void runVisibilityBufferBenchmark(GLFWwindow *window);
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <GLFW/glfw3.h>
 
+#include "window.h"
+
 GLFWwindow *createWindow(int width, int height,
                          GLFWframebuffersizefun framebufferSizeCallback,
                          GLFWscrollfun scrollCallback,
@@ -21,3 +23,37 @@ GLFWwindow *createWindow(int width, int height,
 
   return window;
 }
+
+GLFWwindow *createSharedWindow(int width, int height, const char *title,
+                               GLFWwindow *share) {
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+  return glfwCreateWindow(width, height, title, NULL, share);
+}
+
+SwapMode setSwapMode(SwapMode mode) {
+  switch (mode) {
+  case SwapImmediate:
+    glfwSwapInterval(0);
+    break;
+  case SwapVsync:
+    glfwSwapInterval(1);
+    break;
+  case SwapAdaptive:
+    // GLFW passes negative intervals through only when one of these is
+    // there, EGL has no equivalent
+    if (glfwExtensionSupported("GLX_EXT_swap_control_tear") ||
+        glfwExtensionSupported("WGL_EXT_swap_control_tear")) {
+      glfwSwapInterval(-1);
+    } else {
+      fprintf(stderr, "adaptive vsync is not supported, using vsync\n");
+      glfwSwapInterval(1);
+      mode = SwapVsync;
+    }
+    break;
+  }
+
+  return mode;
+}
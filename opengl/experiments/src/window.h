@@ -1,6 +1,28 @@
+#pragma once
+
 #include <GLFW/glfw3.h>
 
+enum SwapMode {
+  // present as soon as the frame is done, tearing
+  SwapImmediate,
+  // wait for the vertical blank
+  SwapVsync,
+  // wait for the vertical blank unless the frame is late, then tear instead
+  // of waiting a whole extra refresh
+  SwapAdaptive,
+};
+
 GLFWwindow *createWindow(int width, int height,
                          GLFWframebuffersizefun framebufferSizeCallback,
                          GLFWscrollfun scrollCallback,
                          GLFWcursorposfun cursorPositionCallback);
+
+// Another window whose context shares objects with `share`, in the same
+// GL version. Its context is not made current
+GLFWwindow *createSharedWindow(int width, int height, const char *title,
+                               GLFWwindow *share);
+
+// Sets the swap interval of the current context. Adaptive vsync needs
+// *_EXT_swap_control_tear and falls back to plain vsync without it, the
+// mode actually set is returned
+SwapMode setSwapMode(SwapMode mode);